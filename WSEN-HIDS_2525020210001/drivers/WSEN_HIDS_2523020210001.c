@@ -24,22 +24,68 @@
 **/
 #include <stdio.h>
 #include "WSEN_HIDS_2523020210001.h"
+#include "platform_convert.h"
+
+
+/* images of the consecutive control registers CTRL_1 .. CTRL_3 */
+typedef struct
+{
+	HIDS_ctrl_1_t ctrl1;
+	HIDS_ctrl_2_t ctrl2;
+	HIDS_ctrl_3_t ctrl3;
+} HIDS_ctrl_block_t;
+
+#define HIDS_MAX_READ_LEN 16 /* longest run of consecutive registers read by the driver (calibration block) */
+
+static int8_t HIDS_readCtrlBlock(we_dev_t *dev, HIDS_average_config_t *avg, HIDS_ctrl_block_t *ctrl);
+
+/**
+* @brief  Read consecutive registers
+*         A single burst if the auto increment bit is set up (we_dev_t.multiByteMask). Without it the sensor
+*         repeats the first register, so each register is read as a block of its own in one batch.
+* @param  Address of the first register
+* @param  Number of registers, at most HIDS_MAX_READ_LEN
+* @param  Pointer to the register values
+* @retval Error code
+*/
+static int8_t HIDS_readRegs(we_dev_t *dev, uint8_t RegAdr, int count, uint8_t *data)
+{
+	we_reg_read_t reads[HIDS_MAX_READ_LEN];
+	int i;
+
+	if ((dev->multiByteMask != 0) || (count == 1))
+	{
+		return ReadReg(dev, RegAdr, count, data);
+	}
+
+	if (count > HIDS_MAX_READ_LEN)
+	return WE_FAIL;
+
+	for (i = 0; i < count; i++)
+	{
+		reads[i].RegAdr = (uint8_t)(RegAdr + i);
+		reads[i].NumByteToRead = 1;
+		reads[i].Data = &data[i];
+	}
+
+	return ReadRegBatch(dev, reads, count);
+}
 
 /**
 * @brief  Set the Humidity average configuration
 * @param  Humidity average parameter
 * @retval Error code
 */
-uint8_t HIDS_setHumAvg(HIDS_average_conf_t avgH)
+uint8_t HIDS_setHumAvg(we_dev_t *dev, HIDS_average_conf_t avgH)
 {
 	HIDS_average_config_t average_reg;
 
-	if (ReadReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (ReadReg(dev, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 
 	average_reg.avgHum = avgH;
 
-	if (WriteReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (WriteReg(dev, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -50,11 +96,11 @@ uint8_t HIDS_setHumAvg(HIDS_average_conf_t avgH)
 * @param  Pointer to the Humidity average configuration
 * @retval Error code
 */
-uint8_t HIDS_getHumAvg(HIDS_average_conf_t *avgH)
+uint8_t HIDS_getHumAvg(we_dev_t *dev, HIDS_average_conf_t *avgH)
 {
 	HIDS_average_config_t average_reg;
 
-	if (ReadReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (ReadReg(dev, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 	*avgH = (HIDS_average_conf_t)average_reg.avgHum;
 
@@ -66,16 +112,16 @@ uint8_t HIDS_getHumAvg(HIDS_average_conf_t *avgH)
 * @param  Temperature average parameter
 * @retval Error code
 */
-uint8_t HIDS_setTempAvg(HIDS_average_conf_t avgT)
+uint8_t HIDS_setTempAvg(we_dev_t *dev, HIDS_average_conf_t avgT)
 {
 	HIDS_average_config_t average_reg;
 
-	if (ReadReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (ReadReg(dev, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 
 	average_reg.avgTemp = avgT;
 
-	if (WriteReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (WriteReg(dev, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -86,11 +132,11 @@ uint8_t HIDS_setTempAvg(HIDS_average_conf_t avgT)
 * @param  Pointer to the Temperature average configuration
 * @retval Error code
 */
-uint8_t HIDS_getTempAvg(HIDS_average_conf_t *avgT)
+uint8_t HIDS_getTempAvg(we_dev_t *dev, HIDS_average_conf_t *avgT)
 {
 	HIDS_average_config_t average_reg;
 
-	if (ReadReg((uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
+	if (ReadReg(dev, (uint8_t)HIDS_Average_REG, 1, (uint8_t *)&average_reg))
 	return WE_FAIL;
 	*avgT = (HIDS_average_conf_t)average_reg.avgTemp;
 
@@ -102,17 +148,17 @@ uint8_t HIDS_getTempAvg(HIDS_average_conf_t *avgT)
 * @param  output data rate
 * @retval Error code
 */
-int8_t HIDS_setOdr(HIDS_output_data_rate_t odr)
+int8_t HIDS_setOdr(we_dev_t *dev, HIDS_output_data_rate_t odr)
 {
 
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.odr = odr;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -123,11 +169,11 @@ int8_t HIDS_setOdr(HIDS_output_data_rate_t odr)
 * @param  Pointer to Output Data Rate
 * @retval Error code
 */
-int8_t HIDS_getOdr(HIDS_output_data_rate_t *Odr)
+int8_t HIDS_getOdr(we_dev_t *dev, HIDS_output_data_rate_t *Odr)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*Odr = (HIDS_output_data_rate_t)ctrl_reg_1.odr;
@@ -139,16 +185,16 @@ int8_t HIDS_getOdr(HIDS_output_data_rate_t *Odr)
 * @param  BDU state
 * @retval Error code
 */
-int8_t HIDS_setBdu(HIDS_state_t bdu)
+int8_t HIDS_setBdu(we_dev_t *dev, HIDS_state_t bdu)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.bdu = bdu;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -159,11 +205,11 @@ int8_t HIDS_setBdu(HIDS_state_t bdu)
 * @param  Pointer to Block data update state
 * @retval Error code
 */
-int8_t HIDS_getBduState(HIDS_state_t *bdu)
+int8_t HIDS_getBduState(we_dev_t *dev, HIDS_state_t *bdu)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*bdu = (HIDS_state_t)ctrl_reg_1.bdu;
@@ -175,16 +221,16 @@ int8_t HIDS_getBduState(HIDS_state_t *bdu)
 * @param  Power Control Mode
 * @retval Error code
 */
-int8_t HIDS_setPowerMode(HIDS_power_mode_t pd)
+int8_t HIDS_setPowerMode(we_dev_t *dev, HIDS_power_mode_t pd)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.powerControlMode = pd;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -195,11 +241,11 @@ int8_t HIDS_setPowerMode(HIDS_power_mode_t pd)
 * @param  Pointer to Power Control Mode
 * @retval Error code
 */
-int8_t HIDS_getPowerMode(HIDS_power_mode_t *pd)
+int8_t HIDS_getPowerMode(we_dev_t *dev, HIDS_power_mode_t *pd)
 {
 	HIDS_ctrl_1_t ctrl_reg_1;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_1, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*pd = (HIDS_power_mode_t)ctrl_reg_1.powerControlMode;
@@ -211,16 +257,16 @@ int8_t HIDS_getPowerMode(HIDS_power_mode_t *pd)
 * @param  One shot bit state
 * @retval Error code
 */
-int8_t HIDS_enOneShot(HIDS_state_t oneShot)
+int8_t HIDS_enOneShot(we_dev_t *dev, HIDS_state_t oneShot)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.oneShotBit = oneShot;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -231,11 +277,11 @@ int8_t HIDS_enOneShot(HIDS_state_t oneShot)
 * @param  Pointer to One shot bit state
 * @retval Error code
 */
-int8_t HIDS_getOneShotState(HIDS_state_t *oneShot)
+int8_t HIDS_getOneShotState(we_dev_t *dev, HIDS_state_t *oneShot)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*oneShot = (HIDS_state_t)ctrl_reg_2.oneShotBit;
@@ -247,16 +293,16 @@ int8_t HIDS_getOneShotState(HIDS_state_t *oneShot)
 * @param  Heater state
 * @retval Error code
 */
-int8_t HIDS_enHeater(HIDS_state_t heater)
+int8_t HIDS_enHeater(we_dev_t *dev, HIDS_state_t heater)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.heater = heater;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -267,11 +313,11 @@ int8_t HIDS_enHeater(HIDS_state_t heater)
 * @param  Pointer to Heater state
 * @retval Error code
 */
-int8_t HIDS_getHeaterState(HIDS_state_t *heater)
+int8_t HIDS_getHeaterState(we_dev_t *dev, HIDS_state_t *heater)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*heater = (HIDS_state_t)ctrl_reg_2.heater;
@@ -283,18 +329,21 @@ int8_t HIDS_getHeaterState(HIDS_state_t *heater)
 * @param  Reboot state
 * @retval Error code
 */
-int8_t HIDS_enRebootMemory(HIDS_state_t reboot)
+int8_t HIDS_enRebootMemory(we_dev_t *dev, HIDS_state_t reboot)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.rebootMemory = reboot;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
+	/* registers are reloaded from the non-volatile memory */
+	RegCacheInvalidate(dev);
+
 	return WE_SUCCESS;
 }
 
@@ -303,11 +352,11 @@ int8_t HIDS_enRebootMemory(HIDS_state_t reboot)
 * @param  Pointer to reboot state
 * @retval Error code
 */
-int8_t HIDS_getRebootMemoryState(HIDS_state_t *reboot)
+int8_t HIDS_getRebootMemoryState(we_dev_t *dev, HIDS_state_t *reboot)
 {
 	HIDS_ctrl_2_t ctrl_reg_2;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_2, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*reboot = (HIDS_state_t)ctrl_reg_2.rebootMemory;
@@ -319,16 +368,16 @@ int8_t HIDS_getRebootMemoryState(HIDS_state_t *reboot)
 * @param  data Ready
 * @retval Error code
 */
-int8_t HIDS_enInt(HIDS_state_t Drdy)
+int8_t HIDS_enInt(we_dev_t *dev, HIDS_state_t Drdy)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.enDataReady = Drdy;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -339,11 +388,11 @@ int8_t HIDS_enInt(HIDS_state_t Drdy)
 * @param  Pointer to data Ready state
 * @retval Error code
 */
-int8_t HIDS_getIntState(HIDS_state_t *Drdy)
+int8_t HIDS_getIntState(we_dev_t *dev, HIDS_state_t *Drdy)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*Drdy = (HIDS_state_t)ctrl_reg_3.enDataReady;
@@ -355,16 +404,16 @@ int8_t HIDS_getIntState(HIDS_state_t *Drdy)
 * @param  data Ready
 * @retval Error code
 */
-int8_t HIDS_setIntPinType(HIDS_PP_OD_t PP_OD)
+int8_t HIDS_setIntPinType(we_dev_t *dev, HIDS_PP_OD_t PP_OD)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.interruptPinConfig = PP_OD;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -375,11 +424,11 @@ int8_t HIDS_setIntPinType(HIDS_PP_OD_t PP_OD)
 * @param  Pointer to the Interrupt pin Type
 * @retval Error code
 */
-int8_t HIDS_getIntPinType(HIDS_PP_OD_t *PP_OD)
+int8_t HIDS_getIntPinType(we_dev_t *dev, HIDS_PP_OD_t *PP_OD)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*PP_OD = (HIDS_PP_OD_t)ctrl_reg_3.interruptPinConfig;
@@ -391,16 +440,16 @@ int8_t HIDS_getIntPinType(HIDS_PP_OD_t *PP_OD)
 * @param  data ready output level
 * @retval Error code
 */
-int8_t HIDS_setIntLevel(HIDS_active_level_t Drdy_H_L)
+int8_t HIDS_setIntLevel(we_dev_t *dev, HIDS_active_level_t Drdy_H_L)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.drdyOutputLevel = Drdy_H_L;
 
-	if (WriteReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (WriteReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -411,11 +460,11 @@ int8_t HIDS_setIntLevel(HIDS_active_level_t Drdy_H_L)
 * @param  Pointer to the data ready output level
 * @retval Error code
 */
-int8_t HIDS_getIntLevel(HIDS_active_level_t *Drdy_H_L)
+int8_t HIDS_getIntLevel(we_dev_t *dev, HIDS_active_level_t *Drdy_H_L)
 {
 	HIDS_ctrl_3_t ctrl_reg_3;
 
-	if (ReadReg((uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
+	if (ReadReg(dev, (uint8_t)HIDS_CTRL_REG_3, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*Drdy_H_L = (HIDS_active_level_t)ctrl_reg_3.drdyOutputLevel;
@@ -427,24 +476,46 @@ int8_t HIDS_getIntLevel(HIDS_active_level_t *Drdy_H_L)
 * @param  Pointer to device ID.
 * @retval Error code
 */
-int8_t HIDS_getDeviceID(uint8_t *devID)
+int8_t HIDS_getDeviceID(we_dev_t *dev, uint8_t *devID)
 {
-	if (ReadReg((uint8_t)HIDS_DEVICE_ID_REG, 1, devID))
+	if (ReadReg(dev, (uint8_t)HIDS_DEVICE_ID_REG, 1, devID))
 	return WE_FAIL;
 
 	return WE_SUCCESS; /* expected value is HIDS_DEVICE_ID_VALUE */
 }
 
+/* control registers without self-clearing bits (CTRL_2 is read from the sensor every time) and the calibration constants */
+static const uint8_t HIDS_cachedRegs[] = {
+	HIDS_Average_REG, HIDS_CTRL_REG_1, HIDS_CTRL_REG_3,
+	HIDS_H0_RH_X2, HIDS_H1_RH_X2, HIDS_T0_DEGC_X8, HIDS_T1_DEGC_X8, HIDS_T0_T1_DEGC_H2,
+	HIDS_H0_T0_OUT_L, HIDS_H0_T0_OUT_H, HIDS_H1_T0_OUT_L, HIDS_H1_T0_OUT_H,
+	HIDS_T0_OUT_L, HIDS_T0_OUT_H, HIDS_T1_OUT_L, HIDS_T1_OUT_H
+};
+
+/**
+* @brief  Attach a register shadow cache and load it from the sensor
+*         Setters then need a single bus write, configuration getters are served from memory.
+* @param  Pointer to the cache storage, must stay valid as long as the device is used
+* @retval Error code
+*/
+int8_t HIDS_enableRegisterCache(we_dev_t *dev, we_reg_cache_t *cache)
+{
+	if (RegCacheInit(dev, cache, HIDS_cachedRegs, sizeof(HIDS_cachedRegs)))
+	return WE_FAIL;
+
+	return RegCacheSync(dev);
+}
+
 /**
 * @brief Read the humidity Data availability
 * @param  Pointer to the humidity Data availability state
 * @retval Error code
 */
-int8_t HIDS_getHumStatus(HIDS_state_t *humidity_state)
+int8_t HIDS_getHumStatus(we_dev_t *dev, HIDS_state_t *humidity_state)
 {
 	HIDS_status_t status_reg;
 
-	if (ReadReg((uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (ReadReg(dev, (uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*humidity_state = (HIDS_state_t)status_reg.humDataAvailable;
@@ -456,11 +527,11 @@ int8_t HIDS_getHumStatus(HIDS_state_t *humidity_state)
 * @param  Pointer to the temperature Data availability state
 * @retval Error code
 */
-int8_t HIDS_getTempStatus(HIDS_state_t *temp_state)
+int8_t HIDS_getTempStatus(we_dev_t *dev, HIDS_state_t *temp_state)
 {
 	HIDS_status_t status_reg;
 
-	if (ReadReg((uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (ReadReg(dev, (uint8_t)HIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*temp_state = (HIDS_state_t)status_reg.tempDataAvailable;
@@ -472,11 +543,11 @@ int8_t HIDS_getTempStatus(HIDS_state_t *temp_state)
 * @param  Pointer to rawHumidity and  rawTemp
 * @retval Error code
 */
-int8_t HIDS_getRAWValues(int16_t *rawHumidity, int16_t *rawTemp)
+int8_t HIDS_getRAWValues(we_dev_t *dev, int16_t *rawHumidity, int16_t *rawTemp)
 {
 
 	uint8_t raw[4] = {0};
-	if (ReadReg((uint8_t)HIDS_H_OUT_L_REG, 4, (uint8_t *)&raw))
+	if (HIDS_readRegs(dev, (uint8_t)HIDS_H_OUT_L_REG, 4, raw))
 	return WE_FAIL;
 
 	*rawHumidity = (int16_t)(raw[1] << 8);
@@ -496,15 +567,15 @@ int8_t HIDS_getRAWValues(int16_t *rawHumidity, int16_t *rawTemp)
 * @retval Humidity Output
 */
 
-uint16_t HIDS_get_H_T_out()
+uint16_t HIDS_get_H_T_out(we_dev_t *dev)
 {
 	uint8_t buffer;
 	uint16_t H_T_out = 0;
-	if (ReadReg(HIDS_H_OUT_H_REG, 1, &buffer))
+	if (ReadReg(dev, HIDS_H_OUT_H_REG, 1, &buffer))
 	return WE_FAIL;
 	H_T_out = (uint16_t)buffer << 8;
 
-	if (ReadReg(HIDS_H_OUT_L_REG, 1, &buffer))
+	if (ReadReg(dev, HIDS_H_OUT_L_REG, 1, &buffer))
 	return WE_FAIL;
 	H_T_out |= buffer;
 
@@ -516,15 +587,15 @@ uint16_t HIDS_get_H_T_out()
 * @param  no parameter.
 * @retval H0_T0_out calibration
 */
-uint16_t HIDS_get_H0_T0_out()
+uint16_t HIDS_get_H0_T0_out(we_dev_t *dev)
 {
 	uint8_t buffer;
 	uint16_t H0_T0_out = 0;
-	if (ReadReg(HIDS_H0_T0_OUT_H, 1, &buffer))
+	if (ReadReg(dev, HIDS_H0_T0_OUT_H, 1, &buffer))
 	return WE_FAIL;
 	H0_T0_out = (((uint16_t)buffer) << 8);
 
-	if (ReadReg(HIDS_H0_T0_OUT_L, 1, &buffer))
+	if (ReadReg(dev, HIDS_H0_T0_OUT_L, 1, &buffer))
 	return WE_FAIL;
 	H0_T0_out |= buffer;
 
@@ -536,15 +607,15 @@ uint16_t HIDS_get_H0_T0_out()
 * @param  no parameter.
 * @retval H1_T0_out calibration
 */
-uint16_t HIDS_get_H1_T0_out()
+uint16_t HIDS_get_H1_T0_out(we_dev_t *dev)
 {
 	uint8_t buffer;
 	uint16_t H1_T0_out = 0;
-	if (ReadReg(HIDS_H1_T0_OUT_H, 1, &buffer))
+	if (ReadReg(dev, HIDS_H1_T0_OUT_H, 1, &buffer))
 	return WE_FAIL;
 	H1_T0_out = (((uint16_t)buffer) << 8);
 
-	if (ReadReg(HIDS_H1_T0_OUT_L, 1, &buffer))
+	if (ReadReg(dev, HIDS_H1_T0_OUT_L, 1, &buffer))
 	return WE_FAIL;
 	H1_T0_out |= buffer;
 
@@ -557,11 +628,11 @@ uint16_t HIDS_get_H1_T0_out()
 * @retval H0_rh calibration
 */
 
-uint16_t HIDS_get_H0_rh()
+uint16_t HIDS_get_H0_rh(we_dev_t *dev)
 {
 	uint8_t H0_rh = 0;
 
-	if (ReadReg(HIDS_H0_RH_X2, 1, &H0_rh))
+	if (ReadReg(dev, HIDS_H0_RH_X2, 1, &H0_rh))
 	return WE_FAIL;
 
 	return H0_rh;
@@ -572,11 +643,11 @@ uint16_t HIDS_get_H0_rh()
 * @param  no parameter.
 * @retval H1_rh calibration
 */
-uint16_t HIDS_get_H1_rh()
+uint16_t HIDS_get_H1_rh(we_dev_t *dev)
 {
 	uint8_t H1_rh = 0;
 
-	if (ReadReg((uint8_t)HIDS_H1_RH_X2, 1, &H1_rh))
+	if (ReadReg(dev, (uint8_t)HIDS_H1_RH_X2, 1, &H1_rh))
 	return WE_FAIL;
 
 	return H1_rh;
@@ -587,15 +658,15 @@ uint16_t HIDS_get_H1_rh()
 * @param  no parameter.
 * @retval Temperature Output
 */
-uint16_t HIDS_get_T_OUT()
+uint16_t HIDS_get_T_OUT(we_dev_t *dev)
 {
 	uint8_t buffer;
 	uint16_t T_OUT = 0;
-	if (ReadReg(HIDS_T_OUT_H_REG, 1, &buffer))
+	if (ReadReg(dev, HIDS_T_OUT_H_REG, 1, &buffer))
 	return WE_FAIL;
 	T_OUT = (uint16_t)buffer << 8;
 
-	if (ReadReg(HIDS_T_OUT_L_REG, 1, &buffer))
+	if (ReadReg(dev, HIDS_T_OUT_L_REG, 1, &buffer))
 	return WE_FAIL;
 	T_OUT |= buffer;
 
@@ -608,15 +679,15 @@ uint16_t HIDS_get_T_OUT()
 * @retval T1_OUT calibration
 */
 
-uint16_t HIDS_get_T1_OUT()
+uint16_t HIDS_get_T1_OUT(we_dev_t *dev)
 {
 	uint8_t buffer;
 	uint16_t T1_OUT = 0;
-	if (ReadReg(HIDS_T1_OUT_H, 1, &buffer))
+	if (ReadReg(dev, HIDS_T1_OUT_H, 1, &buffer))
 	return WE_FAIL;
 	T1_OUT = ((uint16_t)buffer) << 8;
 
-	if (ReadReg(HIDS_T1_OUT_L, 1, &buffer))
+	if (ReadReg(dev, HIDS_T1_OUT_L, 1, &buffer))
 	return WE_FAIL;
 	T1_OUT |= buffer;
 
@@ -628,119 +699,437 @@ uint16_t HIDS_get_T1_OUT()
 * @param  no parameter.
 * @retval T0_OUT calibration
 */
-uint16_t HIDS_get_T0_OUT()
+uint16_t HIDS_get_T0_OUT(we_dev_t *dev)
 {
 	uint8_t buffer;
 	uint16_t T0_OUT = 0;
-	if (ReadReg(HIDS_T0_OUT_H, 1, &buffer))
+	if (ReadReg(dev, HIDS_T0_OUT_H, 1, &buffer))
 	return WE_FAIL;
 	T0_OUT = ((uint16_t)buffer) << 8;
 
-	if (ReadReg(HIDS_T0_OUT_L, 1, &buffer))
+	if (ReadReg(dev, HIDS_T0_OUT_L, 1, &buffer))
 	return WE_FAIL;
 	T0_OUT |= buffer;
 
 	return T0_OUT;
 }
 
+/* Calibration */
+
 /**
-* @brief  Read the Humidity data
-* @param  Pointer to the Humidity data in %
+* @brief  Read the calibration block and precompute the conversion coefficients
+*         H0_RH_X2 .. T1_OUT_H (0x30 .. 0x3F) are read in a single burst (a single batch without multiByteMask).
+*         The float conversions use the calibration points truncated to whole %RH / °C, as before,
+*         the integer conversions use their full resolution (0.5 %RH, 0.125 °C).
+* @param  Pointer to the calibration
 * @retval error code
 */
-
-int8_t HIDS_getHumidity(float *humidity)
+int8_t HIDS_readCalibration(we_dev_t *dev, HIDS_calibration_t *calibration)
 {
+	uint8_t block[16];
+	int16_t H0_rh, H1_rh, T0_degC, T1_degC;
 
-	uint16_t H0_T0_out, H1_T0_out, H_T_out;
-	uint16_t H0_rh, H1_rh;
-	float h_temp = 0.0;
-	float hum = 0.0;
+	if (HIDS_readRegs(dev, HIDS_H0_RH_X2, sizeof(block), block))
+	return WE_FAIL;
 
-	H_T_out = HIDS_get_H_T_out();
+	calibration->H0_rh_x2 = block[HIDS_H0_RH_X2 - HIDS_H0_RH_X2];
+	calibration->H1_rh_x2 = block[HIDS_H1_RH_X2 - HIDS_H0_RH_X2];
+	calibration->T0_degC_x8 = (int16_t)((((uint16_t)(block[HIDS_T0_T1_DEGC_H2 - HIDS_H0_RH_X2] & 0x03)) << 8) | block[HIDS_T0_DEGC_X8 - HIDS_H0_RH_X2]);
+	calibration->T1_degC_x8 = (int16_t)((((uint16_t)(block[HIDS_T0_T1_DEGC_H2 - HIDS_H0_RH_X2] & 0x0C)) << 6) | block[HIDS_T1_DEGC_X8 - HIDS_H0_RH_X2]);
+	calibration->H0_T0_out = (int16_t)(((uint16_t)block[HIDS_H0_T0_OUT_H - HIDS_H0_RH_X2] << 8) | block[HIDS_H0_T0_OUT_L - HIDS_H0_RH_X2]);
+	calibration->H1_T0_out = (int16_t)(((uint16_t)block[HIDS_H1_T0_OUT_H - HIDS_H0_RH_X2] << 8) | block[HIDS_H1_T0_OUT_L - HIDS_H0_RH_X2]);
+	calibration->T0_out = (int16_t)(((uint16_t)block[HIDS_T0_OUT_H - HIDS_H0_RH_X2] << 8) | block[HIDS_T0_OUT_L - HIDS_H0_RH_X2]);
+	calibration->T1_out = (int16_t)(((uint16_t)block[HIDS_T1_OUT_H - HIDS_H0_RH_X2] << 8) | block[HIDS_T1_OUT_L - HIDS_H0_RH_X2]);
 
-	H0_rh = HIDS_get_H0_rh();
-	H0_rh = H0_rh >> 1;
+	if ((calibration->H1_T0_out == calibration->H0_T0_out) || (calibration->T1_out == calibration->T0_out))
+	return WE_FAIL;
 
-	H1_rh = HIDS_get_H1_rh();
-	H1_rh = H1_rh >> 1;
+	// remove 2x and 8x multiple
+	H0_rh = calibration->H0_rh_x2 >> 1;
+	H1_rh = calibration->H1_rh_x2 >> 1;
+	T0_degC = calibration->T0_degC_x8 >> 3;
+	T1_degC = calibration->T1_degC_x8 >> 3;
 
-	hum = H1_rh - H0_rh;
+	// H = H0 + (H_out - H0_T0_out) * (H1 - H0) / (H1_T0_out - H0_T0_out) = H_out * slope + offset
+	calibration->humiditySlope = (float)(H1_rh - H0_rh) / (float)(calibration->H1_T0_out - calibration->H0_T0_out);
+	calibration->humidityOffset = (float)H0_rh - (float)calibration->H0_T0_out * calibration->humiditySlope;
 
-	H0_T0_out = HIDS_get_H0_T0_out();
+	// T = T0 + (T_out - T0_out) * (T1 - T0) / (T1_out - T0_out) = T_out * slope + offset
+	calibration->temperatureSlope = (float)(T1_degC - T0_degC) / (float)(calibration->T1_out - calibration->T0_out);
+	calibration->temperatureOffset = (float)T0_degC - (float)calibration->T0_out * calibration->temperatureSlope;
 
-	H1_T0_out = HIDS_get_H1_T0_out();
+	return WE_SUCCESS;
+}
 
-	// Decode Humidity
+/**
+* @brief  Read the calibration once and use it for all following conversions of this device
+*         Call after DeviceInit(). Without it, each conversion reads the calibration block again.
+* @param  Pointer to the calibration storage, must stay valid as long as the device is used
+* @retval error code
+*/
+int8_t HIDS_enableCalibrationCache(we_dev_t *dev, HIDS_calibration_t *calibration)
+{
+	if (HIDS_readCalibration(dev, calibration))
+	return WE_FAIL;
 
-	// Calculate humidity in decimal i.e. 15.0 = 150.
+	dev->driverData = calibration;
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Get the calibration of a device
+* @param  Storage used if the calibration is not cached
+* @param  Pointer set to the cached calibration or to the storage
+* @retval error code
+*/
+static int8_t HIDS_getCalibration(we_dev_t *dev, HIDS_calibration_t *storage, const HIDS_calibration_t **calibration)
+{
+	if (dev->driverData != NULL)
+	{
+		*calibration = (const HIDS_calibration_t *)dev->driverData;
+		return WE_SUCCESS;
+	}
+
+	if (HIDS_readCalibration(dev, storage))
+	return WE_FAIL;
+
+	*calibration = storage;
+	return WE_SUCCESS;
+}
 
-	h_temp = (float)(((int16_t)H_T_out - (int16_t)H0_T0_out) * hum) /
+/**
+* @brief  Read the Humidity data
+* @param  Pointer to the Humidity data in %
+* @retval error code
+*/
+int8_t HIDS_getHumidity(we_dev_t *dev, float *humidity)
+{
+	HIDS_calibration_t storage;
+	const HIDS_calibration_t *calibration;
+	uint8_t raw[2];
 
-	(float)((int16_t)H1_T0_out - (int16_t)H0_T0_out);
+	if (HIDS_getCalibration(dev, &storage, &calibration))
+	return WE_FAIL;
 
-	hum = (float)H0_rh;
+	if (HIDS_readRegs(dev, HIDS_H_OUT_L_REG, 2, raw))
+	return WE_FAIL;
 
-	*humidity = hum + h_temp; // provide signed % measurement unit
+	*humidity = (float)((int16_t)(((uint16_t)raw[1] << 8) | raw[0])) * calibration->humiditySlope + calibration->humidityOffset;
 
 	return WE_SUCCESS;
 }
+
 /**
 * @brief  Read the Temperature data
 * @param  Pointer to the Temperature data on °C
 * @retval error code
 */
+int8_t HIDS_getTemperature(we_dev_t *dev, float *tempDegC)
+{
+	HIDS_calibration_t storage;
+	const HIDS_calibration_t *calibration;
+	uint8_t raw[2];
+
+	if (HIDS_getCalibration(dev, &storage, &calibration))
+	return WE_FAIL;
+
+	if (HIDS_readRegs(dev, HIDS_T_OUT_L_REG, 2, raw))
+	return WE_FAIL;
+
+	*tempDegC = (float)((int16_t)(((uint16_t)raw[1] << 8) | raw[0])) * calibration->temperatureSlope + calibration->temperatureOffset;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read humidity and temperature together
+*         STATUS_REG and H_OUT_L .. T_OUT_H are consecutive and read in a single 5 byte burst (or batch), both values
+*         are converted with the cached calibration (HIDS_enableCalibrationCache()).
+* @param  Pointer to the Humidity data in %
+* @param  Pointer to the Temperature data on °C
+* @param  Pointer to the data state: HIDS_enable if both values were new (H_DA and T_DA set), may be NULL
+* @retval error code
+*/
+int8_t HIDS_getHumidityAndTemperature(we_dev_t *dev, float *humidity, float *tempDegC, HIDS_state_t *newData)
+{
+	HIDS_calibration_t storage;
+	const HIDS_calibration_t *calibration;
+	uint8_t raw[5];
+	HIDS_status_t *status_reg = (HIDS_status_t *)&raw[0];
+
+	if (HIDS_getCalibration(dev, &storage, &calibration))
+	return WE_FAIL;
+
+	/* the status is transferred first, i.e. before reading the outputs clears the data available flags */
+	if (HIDS_readRegs(dev, HIDS_STATUS_REG, 5, raw))
+	return WE_FAIL;
+
+	*humidity = (float)((int16_t)(((uint16_t)raw[2] << 8) | raw[1])) * calibration->humiditySlope + calibration->humidityOffset;
+	*tempDegC = (float)((int16_t)(((uint16_t)raw[4] << 8) | raw[3])) * calibration->temperatureSlope + calibration->temperatureOffset;
+
+	if (newData != NULL)
+	{
+		*newData = (status_reg->humDataAvailable && status_reg->tempDataAvailable) ? HIDS_enable : HIDS_disable;
+	}
+
+	return WE_SUCCESS;
+}
+
+/* Integer output */
 
-int8_t HIDS_getTemperature(float *tempDegC)
+/**
+* @brief  Read the relative humidity in 0.001 %RH, integer arithmetic only
+*         Unlike HIDS_getHumidity() the calibration points are used at their full 0.5 %RH resolution.
+* @param  Pointer to the humidity in 0.001 %RH
+* @retval error code
+*/
+int8_t HIDS_getHumidityMilliRH(we_dev_t *dev, int32_t *humidityMilliRH)
 {
+	HIDS_calibration_t storage;
+	const HIDS_calibration_t *calibration;
+	uint8_t raw[2];
+	int16_t rawHumidity;
+	int32_t den;
+	int64_t num;
+
+	if (HIDS_getCalibration(dev, &storage, &calibration))
+	return WE_FAIL;
+
+	if (HIDS_readRegs(dev, HIDS_H_OUT_L_REG, 2, raw))
+	return WE_FAIL;
+
+	rawHumidity = (int16_t)(((uint16_t)raw[1] << 8) | raw[0]);
+
+	// H = (H0_rh_x2 + (H_out - H0_T0_out) * (H1_rh_x2 - H0_rh_x2) / (H1_T0_out - H0_T0_out)) / 2
+	den = (int32_t)calibration->H1_T0_out - calibration->H0_T0_out;
+	num = ((int64_t)calibration->H0_rh_x2 * den +
+		((int64_t)rawHumidity - calibration->H0_T0_out) * (calibration->H1_rh_x2 - calibration->H0_rh_x2)) * 500;
+	if (den < 0)
+	{
+		num = -num;
+		den = -den;
+	}
 
-	uint16_t T0_out, T1_out, T_out, T0_degC_x8_u16, T1_degC_x8_u16;
-	uint16_t T0_degC, T1_degC;
-	uint8_t buffer, tmp;
-	float t_temp = 0.0;
-	float deg = 0.0;
+	*humidityMilliRH = (int32_t)WE_DIV_ROUND(num, (int64_t)den);
 
-	if (ReadReg(HIDS_T0_T1_DEGC_H2, 1, &tmp))
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read the temperature in 0.01 °C, integer arithmetic only
+*         Unlike HIDS_getTemperature() the calibration points are used at their full 0.125 °C resolution.
+* @param  Pointer to the temperature in 0.01 °C
+* @retval error code
+*/
+int8_t HIDS_getTemperatureCentiDegC(we_dev_t *dev, int32_t *tempCentiDegC)
+{
+	HIDS_calibration_t storage;
+	const HIDS_calibration_t *calibration;
+	uint8_t raw[2];
+	int16_t rawTemp;
+	int32_t den;
+	int64_t num;
+
+	if (HIDS_getCalibration(dev, &storage, &calibration))
 	return WE_FAIL;
 
-	if (ReadReg(HIDS_T0_DEGC_X8, 1, &buffer))
+	if (HIDS_readRegs(dev, HIDS_T_OUT_L_REG, 2, raw))
 	return WE_FAIL;
 
-	T0_degC_x8_u16 = (((uint16_t)(tmp & 0x03)) << 8) | ((uint16_t)buffer);
+	rawTemp = (int16_t)(((uint16_t)raw[1] << 8) | raw[0]);
+
+	// T = (T0_degC_x8 + (T_out - T0_out) * (T1_degC_x8 - T0_degC_x8) / (T1_out - T0_out)) / 8
+	den = ((int32_t)calibration->T1_out - calibration->T0_out) * 8;
+	num = ((int64_t)calibration->T0_degC_x8 * (calibration->T1_out - calibration->T0_out) +
+		((int64_t)rawTemp - calibration->T0_out) * (calibration->T1_degC_x8 - calibration->T0_degC_x8)) * 100;
+	if (den < 0)
+	{
+		num = -num;
+		den = -den;
+	}
+
+	*tempCentiDegC = (int32_t)WE_DIV_ROUND(num, (int64_t)den);
+
+	return WE_SUCCESS;
+}
+
+/* Conversion of sample buffers */
 
-	// remove 8x multiple
-	T0_degC = T0_degC_x8_u16 >> 3;
+/**
+* @brief  Convert a buffer of raw temperature values to °C
+*         Uses the cached calibration (or reads it once per call), the samples are converted by the
+*         SIMD kernel of the platform (ConvertInt16ToFloat()).
+* @param  Raw temperature values as returned by HIDS_getRAWValues()
+* @param  Converted temperature values in °C
+* @param  Number of values
+* @retval error code
+*/
+int8_t HIDS_convertTemperatureBuffer(we_dev_t *dev, const int16_t *rawTemp, float *tempDegC, int count)
+{
+	HIDS_calibration_t storage;
+	const HIDS_calibration_t *calibration;
 
-	if (ReadReg(HIDS_T1_DEGC_X8, 1, &buffer))
+	if (HIDS_getCalibration(dev, &storage, &calibration))
 	return WE_FAIL;
 
-	T1_degC_x8_u16 = (((uint16_t)(tmp & 0x0C)) << 6) | ((uint16_t)buffer);
+	ConvertInt16ToFloat(rawTemp, tempDegC, count, 0, calibration->temperatureSlope, calibration->temperatureOffset);
 
-	// remove 8x multiple
-	T1_degC = T1_degC_x8_u16 >> 3;
+	return WE_SUCCESS;
+}
 
-	T0_out = HIDS_get_T0_OUT();
-	T1_out = HIDS_get_T1_OUT();
-	T_out = HIDS_get_T_OUT();
+/* Configuration */
 
-	// Decode Temperature
+/**
+* @brief  Read AV_CONF and CTRL_1 .. CTRL_3 in a single batch
+* @param  Pointer to the average configuration register image
+* @param  Pointer to the control register images
+* @retval error code
+*/
+static int8_t HIDS_readCtrlBlock(we_dev_t *dev, HIDS_average_config_t *avg, HIDS_ctrl_block_t *ctrl)
+{
+	we_reg_read_t reads[4];
+	int i;
+
+	reads[0].RegAdr = HIDS_Average_REG;
+	reads[0].NumByteToRead = 1;
+	reads[0].Data = (uint8_t *)avg;
+	for (i = 0; i < 3; i++)
+	{
+		reads[i + 1].RegAdr = (uint8_t)(HIDS_CTRL_REG_1 + i);
+		reads[i + 1].NumByteToRead = 1;
+		reads[i + 1].Data = (uint8_t *)ctrl + i;
+	}
+
+	return ReadRegBatch(dev, reads, 4);
+}
 
-	deg = (float)((int16_t)(T1_degC) - (int16_t)(T0_degC));
+/**
+* @brief  Apply a complete configuration, the bus lock is held by the caller
+* @param  Pointer to the configuration
+* @retval error code
+*/
+static int8_t HIDS_writeConfig(we_dev_t *dev, const HIDS_config_t *config)
+{
+	HIDS_average_config_t avgCurrent, avgTarget;
+	HIDS_ctrl_block_t current, target;
 
-	// Calculate Temperature in decimal of degree
-	// centigrade i.e. 15.0 = 150.
+	if (HIDS_readCtrlBlock(dev, &avgCurrent, &current))
+	return WE_FAIL;
 
-	t_temp = (float)(((int16_t)T_out - (int16_t)T0_out) * deg) /
+	avgTarget = avgCurrent;
+	target = current;
 
-	(float)((int16_t)T1_out - (int16_t)T0_out);
+	/* never re-trigger self-clearing functions */
+	target.ctrl2.oneShotBit = 0;
+	target.ctrl2.rebootMemory = 0;
 
-	deg = (float)((int16_t)T0_degC);
+	avgTarget.avgHum = config->humidityAverage;
+	avgTarget.avgTemp = config->temperatureAverage;
+	target.ctrl1.odr = config->outputDataRate;
+	target.ctrl1.bdu = config->blockDataUpdate;
+	target.ctrl1.powerControlMode = config->powerMode;
+	target.ctrl2.heater = config->heater;
+	target.ctrl3.enDataReady = config->dataReadyInt;
+	target.ctrl3.interruptPinConfig = config->intPinType;
+	target.ctrl3.drdyOutputLevel = config->intActiveLevel;
 
-	// provide signed celsius measurement unit
+	if (WriteRegDiff(dev, HIDS_Average_REG, 1, (uint8_t *)&avgCurrent, (uint8_t *)&avgTarget, false))
+	return WE_FAIL;
 
-	*tempDegC = deg + t_temp;
+	if (WriteRegDiff(dev, HIDS_CTRL_REG_1, sizeof(HIDS_ctrl_block_t), (uint8_t *)&current, (uint8_t *)&target, dev->multiByteMask != 0))
+	return WE_FAIL;
 
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Apply a complete configuration
+*         The final register images are computed first; only the registers that change are written,
+*         CTRL_1 .. CTRL_3 in one burst (if the multi-byte address bit is set up in the device context) and AV_CONF separately.
+*         Runs as one bus transaction, no other thread can access the bus between reading the current
+*         and writing the new register images.
+* @param  Pointer to the configuration
+* @retval error code
+*/
+int8_t HIDS_applyConfig(we_dev_t *dev, const HIDS_config_t *config)
+{
+	int8_t ret;
+
+	BusLock(dev->bus);
+	ret = HIDS_writeConfig(dev, config);
+	BusUnlock(dev->bus);
+
+	return ret;
+}
+
+/**
+* @brief  Read the current configuration in a single batch
+* @param  Pointer to the configuration
+* @retval error code
+*/
+int8_t HIDS_readConfig(we_dev_t *dev, HIDS_config_t *config)
+{
+	HIDS_average_config_t avg;
+	HIDS_ctrl_block_t ctrl;
+
+	if (HIDS_readCtrlBlock(dev, &avg, &ctrl))
+	return WE_FAIL;
+
+	config->humidityAverage = (HIDS_average_conf_t)avg.avgHum;
+	config->temperatureAverage = (HIDS_average_conf_t)avg.avgTemp;
+	config->outputDataRate = (HIDS_output_data_rate_t)ctrl.ctrl1.odr;
+	config->blockDataUpdate = (HIDS_state_t)ctrl.ctrl1.bdu;
+	config->powerMode = (HIDS_power_mode_t)ctrl.ctrl1.powerControlMode;
+	config->heater = (HIDS_state_t)ctrl.ctrl2.heater;
+	config->dataReadyInt = (HIDS_state_t)ctrl.ctrl3.enDataReady;
+	config->intPinType = (HIDS_PP_OD_t)ctrl.ctrl3.interruptPinConfig;
+	config->intActiveLevel = (HIDS_active_level_t)ctrl.ctrl3.drdyOutputLevel;
+
+	return WE_SUCCESS;
+}
+
+/* Interrupt driven acquisition */
+
+/**
+* @brief  Wait for a new humidity sample
+*         Sleeps on the interrupt line connected to DRDY (enabled with HIDS_enInt()); the bus is only accessed
+*         if no edge arrives within the timeout. Without an interrupt line (NULL) the status is polled once per ms.
+* @param  Interrupt line connected to DRDY, or NULL
+* @param  Maximum time to wait in ms, -1: no timeout
+* @param  Pointer to humidity data available state, HIDS_disable on timeout
+* @retval error code
+*/
+int8_t HIDS_waitForDataReady(we_dev_t *dev, we_int_line_t *intLine, int timeoutMs, HIDS_state_t *drdy)
+{
+	bool fired;
+	int elapsedMs = 0;
+
+	if (intLine == NULL)
+	{
+		while (1)
+		{
+			if (HIDS_getHumStatus(dev, drdy))
+			return WE_FAIL;
+
+			if ((*drdy == HIDS_enable) || ((timeoutMs >= 0) && (elapsedMs >= timeoutMs)))
+			return WE_SUCCESS;
+
+			BusDelay(dev->bus, 1);
+			elapsedMs++;
+		}
+	}
+
+	if (IntLineWait(intLine, timeoutMs, &fired))
+	return WE_FAIL;
+
+	if (fired)
+	{
+		*drdy = HIDS_enable;
+		return WE_SUCCESS;
+	}
+
+	/* DRDY may already have been active when waiting started */
+	return HIDS_getHumStatus(dev, drdy);
+}
+
 /**         EOF         */
@@ -35,6 +35,12 @@
 
 #define HIDS_ADDRESS_I2C_0 (uint8_t)0x5F
 
+/**         Multi-byte access: register address bit to be set for auto increment (we_dev_t.multiByteMask)         */
+/* Optional: with multiByteMask = 0 the driver reads consecutive registers as one batch of single byte blocks. */
+
+#define HIDS_MULTI_BYTE_I2C (uint8_t)0x80 /* MSB of the sub-address on I2C */
+#define HIDS_MULTI_BYTE_SPI (uint8_t)0x40 /* M/S bit of the address byte on SPI */
+
 /**         HIDS 2511020213301 DEVICE_ID         */
 
 #define HIDS_DEVICE_ID_VALUE (uint8_t)0xBC /* Device ID of HIDS Sensor */
@@ -205,69 +211,129 @@ typedef enum
 	openDrain = 1
 } HIDS_PP_OD_t;
 
+/**
+* Sensor configuration applied with HIDS_applyConfig() and read with HIDS_readConfig()
+* Covers AV_CONF, CTRL_1, CTRL_2 (heater) and CTRL_3.
+*/
+typedef struct
+{
+	HIDS_average_conf_t humidityAverage;    /* AV_CONF AVGH[2:0] */
+	HIDS_average_conf_t temperatureAverage; /* AV_CONF AVGT[2:0] */
+	HIDS_output_data_rate_t outputDataRate; /* CTRL_1 ODR[1:0] */
+	HIDS_state_t blockDataUpdate;           /* CTRL_1 BDU */
+	HIDS_power_mode_t powerMode;            /* CTRL_1 PD */
+	HIDS_state_t heater;                    /* CTRL_2 HEATER */
+	HIDS_state_t dataReadyInt;              /* CTRL_3 DRDY_EN */
+	HIDS_PP_OD_t intPinType;                /* CTRL_3 PP_OD */
+	HIDS_active_level_t intActiveLevel;     /* CTRL_3 DRDY_H_L */
+} HIDS_config_t;
+
+/**
+* Calibration coefficients, see HIDS_readCalibration() / HIDS_enableCalibrationCache()
+* The factory calibration never changes, reading it once turns each conversion into a single output register read.
+*/
+typedef struct
+{
+	int16_t H0_rh_x2;           /* humidity calibration points in 0.5 %RH */
+	int16_t H1_rh_x2;
+	int16_t H0_T0_out;          /* raw humidity at the calibration points */
+	int16_t H1_T0_out;
+	int16_t T0_degC_x8;         /* temperature calibration points in 0.125 °C */
+	int16_t T1_degC_x8;
+	int16_t T0_out;             /* raw temperature at the calibration points */
+	int16_t T1_out;
+	float humiditySlope;        /* %RH per digit */
+	float humidityOffset;       /* %RH at raw value 0 */
+	float temperatureSlope;     /* °C per digit */
+	float temperatureOffset;    /* °C at raw value 0 */
+} HIDS_calibration_t;
+
 /**         Functions definition         */
+/* all functions take the device context opened with DeviceInit() as first argument */
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-	int8_t HIDS_getDeviceID(uint8_t *devID);
+	int8_t HIDS_getDeviceID(we_dev_t *dev, uint8_t *devID);
+
+	/* Register shadow cache (optional) */
+	int8_t HIDS_enableRegisterCache(we_dev_t *dev, we_reg_cache_t *cache);
+
+	/* Complete configuration in one batched read and at most two writes */
+	int8_t HIDS_applyConfig(we_dev_t *dev, const HIDS_config_t *config);
+	int8_t HIDS_readConfig(we_dev_t *dev, HIDS_config_t *config);
+
+	/* Interrupt driven acquisition: sleep on the GPIO connected to DRDY instead of polling STATUS */
+	int8_t HIDS_waitForDataReady(we_dev_t *dev, we_int_line_t *intLine, int timeoutMs, HIDS_state_t *drdy);
 
 	/* Standard Configurations */
-	uint8_t HIDS_setHumAvg(HIDS_average_conf_t avgH);
-	uint8_t HIDS_getHumAvg(HIDS_average_conf_t *avgH);
-	uint8_t HIDS_setTempAvg(HIDS_average_conf_t avgT);
-	uint8_t HIDS_getTempAvg(HIDS_average_conf_t *avgT);
+	uint8_t HIDS_setHumAvg(we_dev_t *dev, HIDS_average_conf_t avgH);
+	uint8_t HIDS_getHumAvg(we_dev_t *dev, HIDS_average_conf_t *avgH);
+	uint8_t HIDS_setTempAvg(we_dev_t *dev, HIDS_average_conf_t avgT);
+	uint8_t HIDS_getTempAvg(we_dev_t *dev, HIDS_average_conf_t *avgT);
 
-	int8_t HIDS_setOdr(HIDS_output_data_rate_t odr);
-	int8_t HIDS_getOdr(HIDS_output_data_rate_t *odr);
+	int8_t HIDS_setOdr(we_dev_t *dev, HIDS_output_data_rate_t odr);
+	int8_t HIDS_getOdr(we_dev_t *dev, HIDS_output_data_rate_t *odr);
 
-	int8_t HIDS_setBdu(HIDS_state_t bdu);
-	int8_t HIDS_getBduState(HIDS_state_t *bdu);
+	int8_t HIDS_setBdu(we_dev_t *dev, HIDS_state_t bdu);
+	int8_t HIDS_getBduState(we_dev_t *dev, HIDS_state_t *bdu);
 
-	int8_t HIDS_setPowerMode(HIDS_power_mode_t pd);
-	int8_t HIDS_getPowerMode(HIDS_power_mode_t *pd);
-	int8_t HIDS_enOneShot(HIDS_state_t oneShot);
-	int8_t HIDS_getOneShotState(HIDS_state_t *oneShot);
+	int8_t HIDS_setPowerMode(we_dev_t *dev, HIDS_power_mode_t pd);
+	int8_t HIDS_getPowerMode(we_dev_t *dev, HIDS_power_mode_t *pd);
+	int8_t HIDS_enOneShot(we_dev_t *dev, HIDS_state_t oneShot);
+	int8_t HIDS_getOneShotState(we_dev_t *dev, HIDS_state_t *oneShot);
 
-	int8_t HIDS_enHeater(HIDS_state_t heater);
-	int8_t HIDS_getHeaterState(HIDS_state_t *heater);
+	int8_t HIDS_enHeater(we_dev_t *dev, HIDS_state_t heater);
+	int8_t HIDS_getHeaterState(we_dev_t *dev, HIDS_state_t *heater);
 
-	int8_t HIDS_enRebootMemory(HIDS_state_t reboot);
-	int8_t HIDS_getRebootMemoryState(HIDS_state_t *reboot);
+	int8_t HIDS_enRebootMemory(we_dev_t *dev, HIDS_state_t reboot);
+	int8_t HIDS_getRebootMemoryState(we_dev_t *dev, HIDS_state_t *reboot);
 
-	int8_t HIDS_enInt(HIDS_state_t Drdy);
-	int8_t HIDS_getIntState(HIDS_state_t *Drdy);
+	int8_t HIDS_enInt(we_dev_t *dev, HIDS_state_t Drdy);
+	int8_t HIDS_getIntState(we_dev_t *dev, HIDS_state_t *Drdy);
 
-	int8_t HIDS_setIntPinType(HIDS_PP_OD_t PP_OD);
-	int8_t HIDS_getIntPinType(HIDS_PP_OD_t *PP_OD);
+	int8_t HIDS_setIntPinType(we_dev_t *dev, HIDS_PP_OD_t PP_OD);
+	int8_t HIDS_getIntPinType(we_dev_t *dev, HIDS_PP_OD_t *PP_OD);
 
-	int8_t HIDS_setIntLevel(HIDS_active_level_t Drdy_H_L);
-	int8_t HIDS_getIntLevel(HIDS_active_level_t *Drdy_H_L);
+	int8_t HIDS_setIntLevel(we_dev_t *dev, HIDS_active_level_t Drdy_H_L);
+	int8_t HIDS_getIntLevel(we_dev_t *dev, HIDS_active_level_t *Drdy_H_L);
 
 	/*get the temperature and Humidity Output data  */
 
-	uint16_t HIDS_get_H_T_out();
-	uint16_t HIDS_get_T_OUT();
+	uint16_t HIDS_get_H_T_out(we_dev_t *dev);
+	uint16_t HIDS_get_T_OUT(we_dev_t *dev);
 
 	/*get the calibration parameters */
 
-	uint16_t HIDS_get_H0_T0_out();
-	uint16_t HIDS_get_H1_T0_out();
-	uint16_t HIDS_get_H0_rh();
-	uint16_t HIDS_get_H1_rh();
+	uint16_t HIDS_get_H0_T0_out(we_dev_t *dev);
+	uint16_t HIDS_get_H1_T0_out(we_dev_t *dev);
+	uint16_t HIDS_get_H0_rh(we_dev_t *dev);
+	uint16_t HIDS_get_H1_rh(we_dev_t *dev);
 
-	uint16_t HIDS_get_T1_OUT();
-	uint16_t HIDS_get_T0_OUT();
+	uint16_t HIDS_get_T1_OUT(we_dev_t *dev);
+	uint16_t HIDS_get_T0_OUT(we_dev_t *dev);
 	/* Temperature and Humidity data available State */
 
-	int8_t HIDS_getTempStatus(HIDS_state_t *temp_state);
-	int8_t HIDS_getHumStatus(HIDS_state_t *humidity_state);
+	int8_t HIDS_getTempStatus(we_dev_t *dev, HIDS_state_t *temp_state);
+	int8_t HIDS_getHumStatus(we_dev_t *dev, HIDS_state_t *humidity_state);
+
+	/* Calibration coefficients, read once */
+	int8_t HIDS_readCalibration(we_dev_t *dev, HIDS_calibration_t *calibration);
+	int8_t HIDS_enableCalibrationCache(we_dev_t *dev, HIDS_calibration_t *calibration);
+
+	int8_t HIDS_getRAWValues(we_dev_t *dev, int16_t *rawHumidity, int16_t *rawTemp);
+	int8_t HIDS_getHumidity(we_dev_t *dev, float *humidity);
+	int8_t HIDS_getTemperature(we_dev_t *dev, float *tempDegC);
+	int8_t HIDS_getHumidityAndTemperature(we_dev_t *dev, float *humidity, float *tempDegC, HIDS_state_t *newData);
+
+	/* Integer output */
+	int8_t HIDS_getHumidityMilliRH(we_dev_t *dev, int32_t *humidityMilliRH);
+	int8_t HIDS_getTemperatureCentiDegC(we_dev_t *dev, int32_t *tempCentiDegC);
 
-	int8_t HIDS_getRAWValues(int16_t *rawHumidity, int16_t *rawTemp);
-	int8_t HIDS_getHumidity(float *humidity);
-	int8_t HIDS_getTemperature(float *tempDegC);
+	/* Conversion of sample buffers */
+	int8_t HIDS_convertTemperatureBuffer(we_dev_t *dev, const int16_t *rawTemp, float *tempDegC, int count);
 
 #ifdef __cplusplus
 }
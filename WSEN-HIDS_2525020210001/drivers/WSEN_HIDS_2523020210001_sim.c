@@ -0,0 +1,156 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "WSEN_HIDS_2523020210001_sim.h"
+#include "WSEN_HIDS_2523020210001.h"
+#include <string.h>
+
+#define HIDS_SIM_ONE_SHOT_US         5000 /* duration of a one-shot conversion */
+
+/* output data period in us for ODR[1:0] */
+static const uint32_t HIDS_simPeriodUs[4] = { 0, 1000000, 142857, 80000 };
+
+
+/**
+* @brief  Store one sample in the output registers
+* @param  -sim : simulated device
+* @retval None
+*/
+static void HIDS_simSample(we_sim_device_t *sim)
+{
+	int16_t humidity;
+	int16_t temperature;
+
+	sim->sampleCount++;
+	/* calibration below: 33 %rH at -1000, 75 %rH at 9000; 20 degC at 300, 30 degC at 800 */
+	humidity = (int16_t)(3762 + SimWave(sim->sampleCount, 500, 100));   /* 45 %rH */
+	temperature = (int16_t)(550 + SimWave(sim->sampleCount, 20, 200));  /* 22.5 degC */
+
+	sim->regs[HIDS_H_OUT_L_REG] = (uint8_t)(humidity & 0xFF);
+	sim->regs[HIDS_H_OUT_H_REG] = (uint8_t)((uint16_t)humidity >> 8);
+	sim->regs[HIDS_T_OUT_L_REG] = (uint8_t)(temperature & 0xFF);
+	sim->regs[HIDS_T_OUT_H_REG] = (uint8_t)((uint16_t)temperature >> 8);
+	sim->regs[HIDS_STATUS_REG] |= 0x03;
+}
+
+/**
+* @brief  Load the power-on register values and the calibration coefficients
+* @param  -sim : simulated device
+* @retval None
+*/
+static void HIDS_simReset(we_sim_device_t *sim)
+{
+	memset(sim->regs, 0, sizeof(sim->regs));
+	sim->regs[HIDS_DEVICE_ID_REG] = HIDS_DEVICE_ID_VALUE;
+	sim->regs[HIDS_Average_REG] = 0x1B;
+	sim->regs[HIDS_H0_RH_X2] = 66;
+	sim->regs[HIDS_H1_RH_X2] = 150;
+	sim->regs[HIDS_T0_DEGC_X8] = 160;
+	sim->regs[HIDS_T1_DEGC_X8] = 240;
+	sim->regs[HIDS_T0_T1_DEGC_H2] = 0x00;
+	sim->regs[HIDS_H0_T0_OUT_L] = (uint8_t)(-1000 & 0xFF);
+	sim->regs[HIDS_H0_T0_OUT_H] = (uint8_t)((uint16_t)-1000 >> 8);
+	sim->regs[HIDS_H1_T0_OUT_L] = (uint8_t)(9000 & 0xFF);
+	sim->regs[HIDS_H1_T0_OUT_H] = (uint8_t)(9000 >> 8);
+	sim->regs[HIDS_T0_OUT_L] = (uint8_t)(300 & 0xFF);
+	sim->regs[HIDS_T0_OUT_H] = (uint8_t)(300 >> 8);
+	sim->regs[HIDS_T1_OUT_L] = (uint8_t)(800 & 0xFF);
+	sim->regs[HIDS_T1_OUT_H] = (uint8_t)(800 >> 8);
+	sim->periodUs = 0;
+	sim->conversionDoneUs = 0;
+}
+
+/**
+* @brief  Produce the samples due up to the current time, nothing is converted in power down
+* @param  -sim : simulated device
+* @retval None
+*/
+static void HIDS_simUpdate(we_sim_device_t *sim)
+{
+	uint8_t ctrl1 = sim->regs[HIDS_CTRL_REG_1];
+	uint32_t due;
+
+	for (due = SimSamplesDue(sim, (ctrl1 & 0x80) ? HIDS_simPeriodUs[ctrl1 & 0x03] : 0); due > 0; due--)
+	{
+		HIDS_simSample(sim);
+	}
+
+	if (sim->conversionDoneUs != 0 && sim->conversionDoneUs <= sim->nowUs)
+	{
+		sim->conversionDoneUs = 0;
+		sim->regs[HIDS_CTRL_REG_2] &= (uint8_t)~0x01;
+		HIDS_simSample(sim);
+	}
+}
+
+/**
+* @brief  Read one register, reading the MSB of an output clears its data available flag
+* @param  -sim : simulated device
+*         -RegAdr : register address
+* @retval register value
+*/
+static uint8_t HIDS_simRead(we_sim_device_t *sim, uint8_t RegAdr)
+{
+	if (RegAdr == HIDS_H_OUT_H_REG)
+	{
+		sim->regs[HIDS_STATUS_REG] &= (uint8_t)~0x01;
+	}
+	else if (RegAdr == HIDS_T_OUT_H_REG)
+	{
+		sim->regs[HIDS_STATUS_REG] &= (uint8_t)~0x02;
+	}
+	return sim->regs[RegAdr];
+}
+
+/**
+* @brief  Write one register including the one-shot trigger
+* @param  -sim : simulated device
+*         -RegAdr : register address
+*         -value : value to write
+* @retval None
+*/
+static void HIDS_simWrite(we_sim_device_t *sim, uint8_t RegAdr, uint8_t value)
+{
+	if (RegAdr == HIDS_DEVICE_ID_REG || RegAdr == HIDS_STATUS_REG || RegAdr >= HIDS_H_OUT_L_REG)
+	{
+		return; /* read only */
+	}
+	if (RegAdr == HIDS_CTRL_REG_2 && (value & 0x01) && (sim->regs[HIDS_CTRL_REG_1] & 0x80))
+	{
+		sim->conversionDoneUs = sim->nowUs + HIDS_SIM_ONE_SHOT_US;
+	}
+	sim->regs[RegAdr] = value;
+}
+
+const we_sim_model_t HIDS_simModel = {
+	HIDS_simReset,
+	HIDS_simUpdate,
+	HIDS_simRead,
+	HIDS_simWrite,
+	NULL,
+	{ HIDS_MULTI_BYTE_I2C, HIDS_MULTI_BYTE_SPI }
+};
+
+/**         EOF         */
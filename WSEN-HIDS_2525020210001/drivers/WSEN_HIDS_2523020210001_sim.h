@@ -0,0 +1,52 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef _WSEN_HIDS_SIM_H
+#define _WSEN_HIDS_SIM_H
+
+/*
+ * #### INFORMATIVE ####
+ * Simulation model of the HIDS for the simulator backend (platform_sim.h): calibration registers, output
+ * data rate, one-shot conversion and status flags.
+ * Attach it to a simulated bus with SimDeviceInit(&dev, &bus, address, &sim, &HIDS_simModel).
+ */
+
+/**         Includes         */
+
+#include "platform_sim.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+	extern const we_sim_model_t HIDS_simModel;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WSEN_HIDS_SIM_H */
+/**         EOF         */
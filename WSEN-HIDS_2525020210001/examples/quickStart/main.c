@@ -40,6 +40,10 @@
 bool AbortMainLoop = false;
 pthread_t thread_main;
 
+static we_bus_t bus;  /* bus the sensor is attached to */
+static we_dev_t hids; /* sensor device context */
+static HIDS_calibration_t calibration; /* factory calibration, read once */
+
 static void Application(void);
 int initPlatform(void);
 
@@ -140,7 +144,12 @@ static void Application()
 	int spi_channel = 1;
 
 	/* initialize the platform SPI drivers */
-	status = SpiInit(spi_channel);
+	status = SpiBusInit(&bus, &WE_wiringPiBusOps, 0, 4000000, 0); /* /dev/spidev0.x, 4MHz, SPI mode 0 */
+	if (status == WE_SUCCESS)
+	{
+		status = DeviceInit(&hids, &bus, spi_channel);
+		hids.multiByteMask = HIDS_MULTI_BYTE_SPI;
+	}
 
 	if (status != WE_SUCCESS)
 	{
@@ -153,7 +162,12 @@ static void Application()
 	const int addr_hids = HIDS_ADDRESS_I2C_0;
 
 	/* initialize the platform I2C drivers */
-	status = I2CInit(addr_hids);
+	status = I2CBusInit(&bus, &WE_wiringPiBusOps, 1); /* /dev/i2c-1 on the Raspberry Pi header */
+	if (status == WE_SUCCESS)
+	{
+		status = DeviceInit(&hids, &bus, addr_hids);
+		hids.multiByteMask = HIDS_MULTI_BYTE_I2C;
+	}
 
 	if (status != WE_SUCCESS)
 	{
@@ -163,7 +177,7 @@ static void Application()
 #endif
 
 	/* first communication test */
-	retVal = HIDS_getDeviceID(&deviceIdValue);
+	retVal = HIDS_getDeviceID(&hids, &deviceIdValue);
 
 	if ((retVal == WE_SUCCESS) && (deviceIdValue == HIDS_DEVICE_ID_VALUE))
 	{
@@ -176,20 +190,22 @@ static void Application()
 		return;
 	}
 
+	/* read the calibration once instead of with every measurement */
+	if (HIDS_enableCalibrationCache(&hids, &calibration) != WE_SUCCESS)
+	{
+		Debug_out("HIDS calibration read fail\r\n", false);
+		return;
+	}
+
 	/* set ODR to 1Hz */
-	HIDS_setOdr(odr1HZ);
+	HIDS_setOdr(&hids, odr1HZ);
 
 	while (1)
 	{
-		float tempDegC;
-		if (HIDS_getTemperature(&tempDegC) == WE_SUCCESS)
+		float tempDegC, humidity;
+		if (HIDS_getHumidityAndTemperature(&hids, &humidity, &tempDegC, NULL) == WE_SUCCESS)
 		{
 			printf("temp is %f °C \r\n", tempDegC);
-		}
-
-		float humidity;
-		if (HIDS_getHumidity(&humidity) == WE_SUCCESS)
-		{
 			printf("Humidity is %f %% \r\n", humidity);
 		}
 		delay(DELAY_1_HZ_IN_MS);
@@ -23,18 +23,32 @@
 ***************************************************************************************************
 **/
 #include "WSEN_ITDS_2533020201601.h"
+#include "platform_convert.h"
 #include <stdio.h>
 
 
+/* images of the consecutive control registers CTRL_1 .. CTRL_6 */
+typedef struct {
+	ITDS_ctrl_1_t ctrl1;
+	ITDS_ctrl_2_t ctrl2;
+	ITDS_ctrl_3_t ctrl3;
+	ITDS_ctrl_4_t ctrl4;
+	ITDS_ctrl_5_t ctrl5;
+	ITDS_ctrl_6_t ctrl6;
+}ITDS_ctrl_block_t;
+
+static int8_t ITDS_readCtrlBlock(we_dev_t *dev, ITDS_ctrl_block_t *ctrl, ITDS_fifo_ctrl_t *fifoCtrl);
+
+
 /**
 * @brief  Read the device ID
 * @param  Pointer to Device Id .
 * @retval Error code
 */
-int8_t ITDS_getDeviceID(uint8_t *device_id)
+int8_t ITDS_getDeviceID(we_dev_t *dev, uint8_t *device_id)
 {
 	uint8_t deviceID = 0;
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_DEVICE_ID_REG, 1, &deviceID))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_DEVICE_ID_REG, 1, &deviceID))
 	return WE_FAIL;
 
 	*device_id=deviceID;
@@ -42,6 +56,28 @@ int8_t ITDS_getDeviceID(uint8_t *device_id)
 	return (WE_SUCCESS);
 }
 
+/* control registers without self-clearing bits (CTRL_2 and CTRL_3 are read from the sensor every time) */
+static const uint8_t ITDS_cachedRegs[] = {
+	ITDS_CTRL_1_REG, ITDS_CTRL_4_REG, ITDS_CTRL_5_REG, ITDS_CTRL_6_REG, ITDS_FIFO_CTRL_REG,
+	ITDS_TAP_X_TH_REG, ITDS_TAP_Y_TH_REG, ITDS_TAP_Z_TH_REG, ITDS_INT_DUR_REG, ITDS_WAKE_UP_TH_REG,
+	ITDS_WAKE_UP_DUR_REG, ITDS_FREE_FALL_REG, ITDS_X_OFS_USR_REG, ITDS_Y_OFS_USR_REG, ITDS_Z_OFS_USR_REG,
+	ITDS_CTRL_7_REG
+};
+
+/**
+* @brief  Attach a register shadow cache and load it from the sensor
+*         Setters then need a single bus write, configuration getters are served from memory.
+* @param  Pointer to the cache storage, must stay valid as long as the device is used
+* @retval Error code
+*/
+int8_t ITDS_enableRegisterCache(we_dev_t *dev, we_reg_cache_t *cache)
+{
+	if (WE_FAIL == RegCacheInit(dev, cache, ITDS_cachedRegs, sizeof(ITDS_cachedRegs)))
+	return WE_FAIL;
+
+	return RegCacheSync(dev);
+}
+
 /*CTRL_1 */
 
 /**
@@ -49,17 +85,17 @@ int8_t ITDS_getDeviceID(uint8_t *device_id)
 * @param  output data rate
 * @retval Error code
 */
-int8_t ITDS_setOutputDataRate(ITDS_output_Data_Rate odr)
+int8_t ITDS_setOutputDataRate(we_dev_t *dev, ITDS_output_Data_Rate odr)
 {
 
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.outputDataRate = odr;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -70,11 +106,11 @@ int8_t ITDS_setOutputDataRate(ITDS_output_Data_Rate odr)
 * @param  Pointer to output data rate .
 * @retval Error code
 */
-int8_t ITDS_getOutputDataRate(uint8_t *odr)
+int8_t ITDS_getOutputDataRate(we_dev_t *dev, uint8_t *odr)
 {
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*odr=ctrl_reg_1.outputDataRate;
@@ -86,17 +122,17 @@ int8_t ITDS_getOutputDataRate(uint8_t *odr)
 * @param  operating mode
 * @retval Error code
 */
-int8_t ITDS_setOperatingMode(ITDS_operating_mode Mode)
+int8_t ITDS_setOperatingMode(we_dev_t *dev, ITDS_operating_mode Mode)
 {
 
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.operatingMode = Mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -107,11 +143,11 @@ int8_t ITDS_setOperatingMode(ITDS_operating_mode Mode)
 * @param  Pointer to the operating mode.
 * @retval Error code
 */
-int8_t ITDS_getOperatingMode(uint8_t *opMode)
+int8_t ITDS_getOperatingMode(we_dev_t *dev, uint8_t *opMode)
 {
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*opMode=ctrl_reg_1.operatingMode;
@@ -123,17 +159,17 @@ int8_t ITDS_getOperatingMode(uint8_t *opMode)
 * @param  operating mode
 * @retval Error code
 */
-int8_t ITDS_setpowerMode(ITDS_power_mode lowOrNormalMode)
+int8_t ITDS_setpowerMode(we_dev_t *dev, ITDS_power_mode lowOrNormalMode)
 {
 
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.powerMode = lowOrNormalMode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -144,11 +180,11 @@ int8_t ITDS_setpowerMode(ITDS_power_mode lowOrNormalMode)
 * @param  Pointer to the power mode  .
 * @retval Error code
 */
-int8_t ITDS_getpowerMode(uint8_t *powerMode)
+int8_t ITDS_getpowerMode(we_dev_t *dev, uint8_t *powerMode)
 {
 	ITDS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*powerMode=ctrl_reg_1.powerMode;
@@ -162,18 +198,21 @@ int8_t ITDS_getpowerMode(uint8_t *powerMode)
 * @param  boot state
 * @retval Error code
 */
-int8_t ITDS_reboot(ITDS_state_t rebootmode)
+int8_t ITDS_reboot(we_dev_t *dev, ITDS_state_t rebootmode)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.boot = rebootmode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
+	/* all registers are reloaded with their default values */
+	RegCacheInvalidate(dev);
+
 	return WE_SUCCESS;
 }
 
@@ -182,11 +221,11 @@ int8_t ITDS_reboot(ITDS_state_t rebootmode)
 * @param  Pointer to the Boot state .
 * @retval Error code
 */
-int8_t ITDS_getBootState(ITDS_state_t *boot)
+int8_t ITDS_getBootState(we_dev_t *dev, ITDS_state_t *boot)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*boot=(ITDS_state_t)(ctrl_reg_2.boot);
@@ -198,18 +237,21 @@ int8_t ITDS_getBootState(ITDS_state_t *boot)
 * @param  software reset state
 * @retval Error code
 */
-int8_t ITDS_softReset(ITDS_state_t Swreset_mode)
+int8_t ITDS_softReset(we_dev_t *dev, ITDS_state_t Swreset_mode)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.softReset = Swreset_mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
+	/* all registers are reloaded with their default values */
+	RegCacheInvalidate(dev);
+
 	return WE_SUCCESS;
 }
 
@@ -218,11 +260,11 @@ int8_t ITDS_softReset(ITDS_state_t Swreset_mode)
 * @param  Pointer to the software reset state.
 * @retval Error code
 */
-int8_t ITDS_getsoftResetState(ITDS_state_t *swReset )
+int8_t ITDS_getsoftResetState(we_dev_t *dev, ITDS_state_t *swReset )
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*swReset=(ITDS_state_t)(ctrl_reg_2.softReset);
@@ -234,16 +276,16 @@ int8_t ITDS_getsoftResetState(ITDS_state_t *swReset )
 * @param  chip pull up state
 * @retval Error code
 */
-int8_t ITDS_ConfigCSPullup(ITDS_state_t CSPullup)
+int8_t ITDS_ConfigCSPullup(we_dev_t *dev, ITDS_state_t CSPullup)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.disCSPullup = CSPullup;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -254,11 +296,11 @@ int8_t ITDS_ConfigCSPullup(ITDS_state_t CSPullup)
 * @param  Pointer to the CS pull up .
 * @retval Error code
 */
-int8_t ITDS_getCSConfigState(ITDS_state_t *configCS)
+int8_t ITDS_getCSConfigState(we_dev_t *dev, ITDS_state_t *configCS)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*configCS=(ITDS_state_t)(ctrl_reg_2.disCSPullup);
@@ -271,16 +313,16 @@ int8_t ITDS_getCSConfigState(ITDS_state_t *configCS)
 * @param  BDU state
 * @retval Error code
 */
-int8_t ITDS_setBlockDataUpdate(ITDS_state_t bdu)
+int8_t ITDS_setBlockDataUpdate(we_dev_t *dev, ITDS_state_t bdu)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.blockDataUpdate = bdu;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -291,11 +333,11 @@ int8_t ITDS_setBlockDataUpdate(ITDS_state_t bdu)
 * @param  Pointer to the block data update state
 * @retval Error code
 */
-int8_t ITDS_getBlockDataUpdateState(ITDS_state_t *bdu)
+int8_t ITDS_getBlockDataUpdateState(we_dev_t *dev, ITDS_state_t *bdu)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*bdu=(ITDS_state_t)(ctrl_reg_2.blockDataUpdate);
 	return WE_SUCCESS;
@@ -307,16 +349,16 @@ int8_t ITDS_getBlockDataUpdateState(ITDS_state_t *bdu)
 * @param  Auto increment state
 * @retval Error code
 */
-int8_t ITDS_setAutoIncrement(ITDS_state_t autoInc)
+int8_t ITDS_setAutoIncrement(we_dev_t *dev, ITDS_state_t autoInc)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.autoAddIncr = autoInc;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -327,11 +369,11 @@ int8_t ITDS_setAutoIncrement(ITDS_state_t autoInc)
 * @param  Pointer to the auto increment state
 * @retval Error code
 */
-int8_t ITDS_getAutoIncrementState(ITDS_state_t *autoIncr)
+int8_t ITDS_getAutoIncrementState(we_dev_t *dev, ITDS_state_t *autoIncr)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*autoIncr=(ITDS_state_t)(ctrl_reg_2.autoAddIncr);
@@ -343,16 +385,16 @@ int8_t ITDS_getAutoIncrementState(ITDS_state_t *autoIncr)
 * @param  I2C Interface state
 * @retval Error code
 */
-int8_t ITDS_disableI2CInterface(ITDS_state_t I2CStatus)
+int8_t ITDS_disableI2CInterface(we_dev_t *dev, ITDS_state_t I2CStatus)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.i2cDisable = I2CStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -363,11 +405,11 @@ int8_t ITDS_disableI2CInterface(ITDS_state_t I2CStatus)
 * @param  Pointer to the I2C interface state.
 * @retval Error code
 */
-int8_t ITDS_getI2CInterfaceState(ITDS_state_t *i2cState)
+int8_t ITDS_getI2CInterfaceState(we_dev_t *dev, ITDS_state_t *i2cState)
 {
 	ITDS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	*i2cState=(ITDS_state_t)(ctrl_reg_2.i2cDisable);
@@ -382,16 +424,16 @@ int8_t ITDS_getI2CInterfaceState(ITDS_state_t *i2cState)
 * @param  self test mode
 * @retval Error code
 */
-int8_t ITDS_setSelfTestMode(ITDS_self_Test_Config selfTest)
+int8_t ITDS_setSelfTestMode(we_dev_t *dev, ITDS_self_Test_Config selfTest)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.selfTestMode = selfTest;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -402,11 +444,11 @@ int8_t ITDS_setSelfTestMode(ITDS_self_Test_Config selfTest)
 * @param  Pointer to the self test mode.
 * @retval Error code
 */
-int8_t ITDS_getSelfTestMode(ITDS_state_t *selfTest)
+int8_t ITDS_getSelfTestMode(we_dev_t *dev, ITDS_state_t *selfTest)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*selfTest=(ITDS_state_t)(ctrl_reg_3.selfTestMode);
@@ -418,16 +460,16 @@ int8_t ITDS_getSelfTestMode(ITDS_state_t *selfTest)
 * @param  interrupt Type
 * @retval Error code
 */
-int8_t ITDS_setIntPinType(ITDS_interrupt_Pin_Config interruptType)
+int8_t ITDS_setIntPinType(we_dev_t *dev, ITDS_interrupt_Pin_Config interruptType)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.intPinConf = interruptType;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -438,11 +480,11 @@ int8_t ITDS_setIntPinType(ITDS_interrupt_Pin_Config interruptType)
 * @param  Pointer to the Interrupt Type .
 * @retval Error code
 */
-int8_t ITDS_getIntPinType(ITDS_state_t *intType)
+int8_t ITDS_getIntPinType(we_dev_t *dev, ITDS_state_t *intType)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*intType=(ITDS_state_t)(ctrl_reg_3.intPinConf);
@@ -454,16 +496,16 @@ int8_t ITDS_getIntPinType(ITDS_state_t *intType)
 * @param  latch Interrupt state
 * @retval Error code
 */
-int8_t ITDS_enLatchInt(ITDS_state_t lir)
+int8_t ITDS_enLatchInt(we_dev_t *dev, ITDS_state_t lir)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.enLatchedInterrupt = lir;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -474,11 +516,11 @@ int8_t ITDS_enLatchInt(ITDS_state_t lir)
 * @param  Pointer to the latch Interrupt state .
 * @retval Error code
 */
-int8_t ITDS_getLatchIntState(ITDS_state_t *lir)
+int8_t ITDS_getLatchIntState(we_dev_t *dev, ITDS_state_t *lir)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*lir=(ITDS_state_t)(ctrl_reg_3.enLatchedInterrupt);
@@ -490,16 +532,16 @@ int8_t ITDS_getLatchIntState(ITDS_state_t *lir)
 * @param  interrupt active level
 * @retval Error code
 */
-int8_t ITDS_setIntActiveLevel(ITDS_interrupt_Active_Level lowHighLevel)
+int8_t ITDS_setIntActiveLevel(we_dev_t *dev, ITDS_interrupt_Active_Level lowHighLevel)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.intActiveLevel = lowHighLevel;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -510,11 +552,11 @@ int8_t ITDS_setIntActiveLevel(ITDS_interrupt_Active_Level lowHighLevel)
 * @param  Pointer to the Interrupt active level.
 * @retval Error code
 */
-int8_t ITDS_getIntActiveLevel(ITDS_interrupt_Active_Level *lowHighLevel)
+int8_t ITDS_getIntActiveLevel(we_dev_t *dev, ITDS_interrupt_Active_Level *lowHighLevel)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*lowHighLevel=(ITDS_interrupt_Active_Level)(ctrl_reg_3.intActiveLevel);
@@ -526,16 +568,16 @@ int8_t ITDS_getIntActiveLevel(ITDS_interrupt_Active_Level *lowHighLevel)
 * @param  single data conversion Demand mode
 * @retval Error code
 */
-int8_t ITDS_setSingleConvInput(ITDS_singleDataConversion_Input slpModeSel)
+int8_t ITDS_setSingleConvInput(we_dev_t *dev, ITDS_singleDataConversion_Input slpModeSel)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.enSingleDataConv = slpModeSel;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -546,11 +588,11 @@ int8_t ITDS_setSingleConvInput(ITDS_singleDataConversion_Input slpModeSel)
 * @param  Pointer to single data conversion Demand mode .
 * @retval Error code
 */
-int8_t ITDS_getSingleConvInput(ITDS_singleDataConversion_Input *slpModeSel)
+int8_t ITDS_getSingleConvInput(we_dev_t *dev, ITDS_singleDataConversion_Input *slpModeSel)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*slpModeSel=(ITDS_singleDataConversion_Input)(ctrl_reg_3.enSingleDataConv);
@@ -562,16 +604,16 @@ int8_t ITDS_getSingleConvInput(ITDS_singleDataConversion_Input *slpModeSel)
 * @param  Single Data Conversion Mode
 * @retval Error code
 */
-int8_t ITDS_enSingleDataConv(ITDS_state_t slpMode1)
+int8_t ITDS_enSingleDataConv(we_dev_t *dev, ITDS_state_t slpMode1)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.singleConvTrigger = slpMode1;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -582,11 +624,11 @@ int8_t ITDS_enSingleDataConv(ITDS_state_t slpMode1)
 * @param  Pointer to the single data conversion Demand mode.
 * @retval Error code
 */
-int8_t ITDS_getSingleDataConvState(ITDS_state_t *slpMode1)
+int8_t ITDS_getSingleDataConvState(we_dev_t *dev, ITDS_state_t *slpMode1)
 {
 	ITDS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	*slpMode1=(ITDS_state_t)(ctrl_reg_3.singleConvTrigger);
@@ -601,16 +643,16 @@ int8_t ITDS_getSingleDataConvState(ITDS_state_t *slpMode1)
 * @param  the 6D interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_set6DOnINT0(ITDS_state_t int06D)
+int8_t ITDS_set6DOnINT0(we_dev_t *dev, ITDS_state_t int06D)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.sixDINT0 = int06D;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -621,11 +663,11 @@ int8_t ITDS_set6DOnINT0(ITDS_state_t int06D)
 * @param  Pointer to the 6D interrupt state on INT_0.
 * @retval Error code
 */
-int8_t ITDS_get6DOnINT0State(ITDS_state_t *int06D)
+int8_t ITDS_get6DOnINT0State(we_dev_t *dev, ITDS_state_t *int06D)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int06D=(ITDS_state_t)(ctrl_reg_4.sixDINT0);
@@ -637,16 +679,16 @@ int8_t ITDS_get6DOnINT0State(ITDS_state_t *int06D)
 * @param  Single-tap interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_enSingleTapINT0(ITDS_state_t int0SingleTap)
+int8_t ITDS_enSingleTapINT0(we_dev_t *dev, ITDS_state_t int0SingleTap)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.singleTapINT0 = int0SingleTap;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -657,11 +699,11 @@ int8_t ITDS_enSingleTapINT0(ITDS_state_t int0SingleTap)
 * @param  Pointer to the Single-tap interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_getSingleTapINT0(ITDS_state_t *int0SingleTap)
+int8_t ITDS_getSingleTapINT0(we_dev_t *dev, ITDS_state_t *int0SingleTap)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0SingleTap=(ITDS_state_t)(ctrl_reg_4.singleTapINT0);
@@ -673,16 +715,16 @@ int8_t ITDS_getSingleTapINT0(ITDS_state_t *int0SingleTap)
 * @param   Wakeup interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_enWakeupOnINT0(ITDS_state_t int0Wakeup)
+int8_t ITDS_enWakeupOnINT0(we_dev_t *dev, ITDS_state_t int0Wakeup)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.wakeupINT0 = int0Wakeup;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -693,11 +735,11 @@ int8_t ITDS_enWakeupOnINT0(ITDS_state_t int0Wakeup)
 * @param  Pointer to the Wakeup interrupt state  on INT_0 .
 * @retval Error code
 */
-int8_t ITDS_getWakeupOnINT0(ITDS_state_t *int0Wakeup)
+int8_t ITDS_getWakeupOnINT0(we_dev_t *dev, ITDS_state_t *int0Wakeup)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0Wakeup=(ITDS_state_t)(ctrl_reg_4.wakeupINT0);
@@ -709,16 +751,16 @@ int8_t ITDS_getWakeupOnINT0(ITDS_state_t *int0Wakeup)
 * @param  Free-fall interrupt state  on INT_0
 * @retval Error code
 */
-int8_t ITDS_enFreeFallINT0(ITDS_state_t int0FreeFall)
+int8_t ITDS_enFreeFallINT0(we_dev_t *dev, ITDS_state_t int0FreeFall)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.freeFallINT0 = int0FreeFall;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -729,11 +771,11 @@ int8_t ITDS_enFreeFallINT0(ITDS_state_t int0FreeFall)
 * @param  Pointer to the Free-fall State on INT_0.
 * @retval Error code
 */
-int8_t ITDS_getFreeFallINT0(ITDS_state_t *int0FreeFall)
+int8_t ITDS_getFreeFallINT0(we_dev_t *dev, ITDS_state_t *int0FreeFall)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0FreeFall=(ITDS_state_t)(ctrl_reg_4.freeFallINT0);
@@ -746,16 +788,16 @@ int8_t ITDS_getFreeFallINT0(ITDS_state_t *int0FreeFall)
 * @param  the Double-tap state interrupt on INT_0
 * @retval Error code
 */
-int8_t ITDS_enDoubleTapINT0(ITDS_state_t int0DoubleTap)
+int8_t ITDS_enDoubleTapINT0(we_dev_t *dev, ITDS_state_t int0DoubleTap)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.doubleTapINT0 = int0DoubleTap;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -766,11 +808,11 @@ int8_t ITDS_enDoubleTapINT0(ITDS_state_t int0DoubleTap)
 * @param  Pointer to the Double-tap interrupt state  on INT_0
 * @retval Error code
 */
-int8_t ITDS_getDoubleTapINT0(ITDS_state_t *int0DoubleTap)
+int8_t ITDS_getDoubleTapINT0(we_dev_t *dev, ITDS_state_t *int0DoubleTap)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0DoubleTap=(ITDS_state_t)(ctrl_reg_4.doubleTapINT0);
@@ -782,16 +824,16 @@ int8_t ITDS_getDoubleTapINT0(ITDS_state_t *int0DoubleTap)
 * @param  FIFO full interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_enFifoFullINT0(ITDS_state_t int0FifoFull)
+int8_t ITDS_enFifoFullINT0(we_dev_t *dev, ITDS_state_t int0FifoFull)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.fifoFullINT0 = int0FifoFull;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -802,11 +844,11 @@ int8_t ITDS_enFifoFullINT0(ITDS_state_t int0FifoFull)
 * @param  Pointer to the FIFO full interrupt State on INT_0
 * @retval Error code
 */
-int8_t ITDS_getFifoFullINT0(ITDS_state_t *int0FifoFull)
+int8_t ITDS_getFifoFullINT0(we_dev_t *dev, ITDS_state_t *int0FifoFull)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0FifoFull=(ITDS_state_t)(ctrl_reg_4.fifoFullINT0);
@@ -819,16 +861,16 @@ int8_t ITDS_getFifoFullINT0(ITDS_state_t *int0FifoFull)
 * @param  FIFO threshold interrupt state on INT_0
 * @retval Error code
 */
-int8_t ITDS_enFifoThresholdINT0(ITDS_state_t int0FifoThresholdInt)
+int8_t ITDS_enFifoThresholdINT0(we_dev_t *dev, ITDS_state_t int0FifoThresholdInt)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.fifoThresholdINT0 = int0FifoThresholdInt;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -839,11 +881,11 @@ int8_t ITDS_enFifoThresholdINT0(ITDS_state_t int0FifoThresholdInt)
 * @param  Pointer to the FIFO threshold interrupt State on INT_0
 * @retval Error code
 */
-int8_t ITDS_getFifoThresholdINT0(ITDS_state_t *int0FifoThresholdInt)
+int8_t ITDS_getFifoThresholdINT0(we_dev_t *dev, ITDS_state_t *int0FifoThresholdInt)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0FifoThresholdInt=(ITDS_state_t)(ctrl_reg_4.fifoThresholdINT0);
@@ -856,16 +898,16 @@ int8_t ITDS_getFifoThresholdINT0(ITDS_state_t *int0FifoThresholdInt)
 * @param  Data-Ready interrupt on INT_0 State
 * @retval Error code
 */
-int8_t ITDS_enDataReadyINT0(ITDS_state_t int0DataReadyInt)
+int8_t ITDS_enDataReadyINT0(we_dev_t *dev, ITDS_state_t int0DataReadyInt)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	ctrl_reg_4.dataReadyINT0 = int0DataReadyInt;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -876,11 +918,11 @@ int8_t ITDS_enDataReadyINT0(ITDS_state_t int0DataReadyInt)
 * @param  Pointer to Data-Ready interrupt on INT_0 State.
 * @retval Error code
 */
-int8_t ITDS_getDataReadyINT0(ITDS_state_t *int0DataReadyInt)
+int8_t ITDS_getDataReadyINT0(we_dev_t *dev, ITDS_state_t *int0DataReadyInt)
 {
 	ITDS_ctrl_4_t ctrl_reg_4;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_4_REG, 1, (uint8_t *)&ctrl_reg_4))
 	return WE_FAIL;
 
 	*int0DataReadyInt=(ITDS_state_t)(ctrl_reg_4.dataReadyINT0);
@@ -896,16 +938,16 @@ int8_t ITDS_getDataReadyINT0(ITDS_state_t *int0DataReadyInt)
 * @param  Sleep state on INT_1
 * @retval Error code
 */
-int8_t ITDS_enInactivityINT1(ITDS_state_t intSleepState)
+int8_t ITDS_enInactivityINT1(we_dev_t *dev, ITDS_state_t intSleepState)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.inactiveStatusINT1 = intSleepState;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -916,11 +958,11 @@ int8_t ITDS_enInactivityINT1(ITDS_state_t intSleepState)
 * @param  Pointer to the Sleep  state on INT_1.
 * @retval Error code
 */
-int8_t ITDS_getInactivityINT1(ITDS_state_t *intSleepState)
+int8_t ITDS_getInactivityINT1(we_dev_t *dev, ITDS_state_t *intSleepState)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*intSleepState=(ITDS_state_t)(ctrl_reg_5.inactiveStatusINT1);
@@ -932,16 +974,16 @@ int8_t ITDS_getInactivityINT1(ITDS_state_t *intSleepState)
 * @param  Sleep change state signal on INT_1
 * @retval Error code
 */
-int8_t ITDS_enActivityINT1(ITDS_state_t int1SleepChange)
+int8_t ITDS_enActivityINT1(we_dev_t *dev, ITDS_state_t int1SleepChange)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.activeStatusINT1 = int1SleepChange;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -952,11 +994,11 @@ int8_t ITDS_enActivityINT1(ITDS_state_t int1SleepChange)
 * @param  Pointer to the Sleep change state on INT_1.
 * @retval Error code
 */
-int8_t ITDS_getActivityINT1(ITDS_state_t *int1SleepChange)
+int8_t ITDS_getActivityINT1(we_dev_t *dev, ITDS_state_t *int1SleepChange)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1SleepChange=(ITDS_state_t)(ctrl_reg_5.activeStatusINT1);
@@ -968,16 +1010,16 @@ int8_t ITDS_getActivityINT1(ITDS_state_t *int1SleepChange)
 * @param  Boot Interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_enBootStatusINT1(ITDS_state_t int1Boot)
+int8_t ITDS_enBootStatusINT1(we_dev_t *dev, ITDS_state_t int1Boot)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.bootStatusINT1 = int1Boot;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -988,11 +1030,11 @@ int8_t ITDS_enBootStatusINT1(ITDS_state_t int1Boot)
 * @param  Pointer to Boot Interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_getBootStatusINT1(ITDS_state_t *int1Boot)
+int8_t ITDS_getBootStatusINT1(we_dev_t *dev, ITDS_state_t *int1Boot)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1Boot=(ITDS_state_t)(ctrl_reg_5.bootStatusINT1);
@@ -1004,16 +1046,16 @@ int8_t ITDS_getBootStatusINT1(ITDS_state_t *int1Boot)
 * @param  the Temperature Data-Ready interrupt State on INT_1
 * @retval Error code
 */
-int8_t ITDS_enTempDataReadyINT1(ITDS_state_t int1TempDataReady)
+int8_t ITDS_enTempDataReadyINT1(we_dev_t *dev, ITDS_state_t int1TempDataReady)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.tempDataReadyINT1 = int1TempDataReady;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1024,11 +1066,11 @@ int8_t ITDS_enTempDataReadyINT1(ITDS_state_t int1TempDataReady)
 * @param  Pointer to the Temperature Data-Ready interrupt State on INT_1 .
 * @retval Error code
 */
-int8_t ITDS_getTempDataReadyINT1(ITDS_state_t *int1TempDataReady)
+int8_t ITDS_getTempDataReadyINT1(we_dev_t *dev, ITDS_state_t *int1TempDataReady)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1TempDataReady=(ITDS_state_t)(ctrl_reg_5.tempDataReadyINT1);
@@ -1040,16 +1082,16 @@ int8_t ITDS_getTempDataReadyINT1(ITDS_state_t *int1TempDataReady)
 * @param  FIFO Overrun interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_enFifoOverrunIntINT1(ITDS_state_t int1FifoOverrun)
+int8_t ITDS_enFifoOverrunIntINT1(we_dev_t *dev, ITDS_state_t int1FifoOverrun)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.fifoOverrunINT1 = int1FifoOverrun;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1060,11 +1102,11 @@ int8_t ITDS_enFifoOverrunIntINT1(ITDS_state_t int1FifoOverrun)
 * @param  Pointer to the FIFO Overrun interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_getFifoOverrunIntINT1(ITDS_state_t *int1FifoOverrun)
+int8_t ITDS_getFifoOverrunIntINT1(we_dev_t *dev, ITDS_state_t *int1FifoOverrun)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1FifoOverrun=(ITDS_state_t)(ctrl_reg_5.fifoOverrunINT1);
@@ -1076,16 +1118,16 @@ int8_t ITDS_getFifoOverrunIntINT1(ITDS_state_t *int1FifoOverrun)
 * @param  FIFO full interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_enFifoFullINT1(ITDS_state_t int1FifoFull)
+int8_t ITDS_enFifoFullINT1(we_dev_t *dev, ITDS_state_t int1FifoFull)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.fifoFullINT1 = int1FifoFull;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1096,11 +1138,11 @@ int8_t ITDS_enFifoFullINT1(ITDS_state_t int1FifoFull)
 * @param  Pointer to the FIFO full interrupt state on INT_1
 * @retval Error code
 */
-int8_t ITDS_getFifoFullINT1(ITDS_state_t *int1FifoFull)
+int8_t ITDS_getFifoFullINT1(we_dev_t *dev, ITDS_state_t *int1FifoFull)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1FifoFull=(ITDS_state_t)(ctrl_reg_5.fifoFullINT1);
@@ -1112,16 +1154,16 @@ int8_t ITDS_getFifoFullINT1(ITDS_state_t *int1FifoFull)
 * @param  FIFO threshold interrupt state  on INT_1
 * @retval Error code
 */
-int8_t ITDS_enFifoThresholdIntINT1(ITDS_state_t int1FifoThresholdInt)
+int8_t ITDS_enFifoThresholdIntINT1(we_dev_t *dev, ITDS_state_t int1FifoThresholdInt)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.fifoThresholdINT1 = int1FifoThresholdInt;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1132,11 +1174,11 @@ int8_t ITDS_enFifoThresholdIntINT1(ITDS_state_t int1FifoThresholdInt)
 * @param  Pointer to the FIFO threshold interrupt State on INT_1 .
 * @retval Error code
 */
-int8_t ITDS_getFifoThresholdINT1(ITDS_state_t *int1FifoThresholdInt)
+int8_t ITDS_getFifoThresholdINT1(we_dev_t *dev, ITDS_state_t *int1FifoThresholdInt)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1FifoThresholdInt=(ITDS_state_t)(ctrl_reg_5.fifoThresholdINT1);
@@ -1148,16 +1190,16 @@ int8_t ITDS_getFifoThresholdINT1(ITDS_state_t *int1FifoThresholdInt)
 * @param  Data-Ready interrupt State on INT_1
 * @retval Error code
 */
-int8_t ITDS_enDataReadyINT1(ITDS_state_t int1DataReadyInt)
+int8_t ITDS_enDataReadyINT1(we_dev_t *dev, ITDS_state_t int1DataReadyInt)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	ctrl_reg_5.dataReadyINT1 = int1DataReadyInt;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1168,11 +1210,11 @@ int8_t ITDS_enDataReadyINT1(ITDS_state_t int1DataReadyInt)
 * @param  Pointer to the Data-Ready interrupt signal on INT_1
 * @retval Error code
 */
-int8_t ITDS_getDataReadyINT1(ITDS_state_t *int1DataReadyInt)
+int8_t ITDS_getDataReadyINT1(we_dev_t *dev, ITDS_state_t *int1DataReadyInt)
 {
 	ITDS_ctrl_5_t ctrl_reg_5;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_5_REG, 1, (uint8_t *)&ctrl_reg_5))
 	return WE_FAIL;
 
 	*int1DataReadyInt=(ITDS_state_t)(ctrl_reg_5.dataReadyINT1);
@@ -1187,16 +1229,16 @@ int8_t ITDS_getDataReadyINT1(ITDS_state_t *int1DataReadyInt)
 * @param  Bandwith
 * @retval Error code
 */
-int8_t ITDS_setFilteringCutoff(ITDS_bandwidth filteringCutoff)
+int8_t ITDS_setFilteringCutoff(we_dev_t *dev, ITDS_bandwidth filteringCutoff)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	ctrl_reg_6.filterBandwidth = filteringCutoff;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1207,11 +1249,11 @@ int8_t ITDS_setFilteringCutoff(ITDS_bandwidth filteringCutoff)
 * @param  Pointer to the Filtering Cut-off .
 * @retval Error code
 */
-int8_t ITDS_getFilteringCutoff(ITDS_bandwidth *filteringCutoff)
+int8_t ITDS_getFilteringCutoff(we_dev_t *dev, ITDS_bandwidth *filteringCutoff)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	*filteringCutoff=(ITDS_bandwidth)(ctrl_reg_6.filterBandwidth);
@@ -1223,16 +1265,16 @@ int8_t ITDS_getFilteringCutoff(ITDS_bandwidth *filteringCutoff)
 * @param  Full scale
 * @retval Error code
 */
-int8_t ITDS_setFullScale(ITDS_full_Scale fullScale_t)
+int8_t ITDS_setFullScale(we_dev_t *dev, ITDS_full_Scale fullScale_t)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	ctrl_reg_6.fullScale = fullScale_t;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1243,11 +1285,11 @@ int8_t ITDS_setFullScale(ITDS_full_Scale fullScale_t)
 * @param  Pointer to the Full scale.
 * @retval Error code
 */
-int8_t ITDS_getFullScale(ITDS_full_Scale *fullScale_t)
+int8_t ITDS_getFullScale(we_dev_t *dev, ITDS_full_Scale *fullScale_t)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	*fullScale_t=(ITDS_full_Scale)(ctrl_reg_6.fullScale);
@@ -1259,16 +1301,16 @@ int8_t ITDS_getFullScale(ITDS_full_Scale *fullScale_t)
 * @param  pass filter Type
 * @retval Error code
 */
-int8_t ITDS_setfilterPath(ITDS_filter_Type filterType)
+int8_t ITDS_setfilterPath(we_dev_t *dev, ITDS_filter_Type filterType)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	ctrl_reg_6.filterPath = filterType;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1279,11 +1321,11 @@ int8_t ITDS_setfilterPath(ITDS_filter_Type filterType)
 * @param  Pointer to the pass filter Type  .
 * @retval Error code
 */
-int8_t ITDS_getfilterPath(ITDS_filter_Type *filterType)
+int8_t ITDS_getfilterPath(we_dev_t *dev, ITDS_filter_Type *filterType)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	*filterType=(ITDS_filter_Type)((ctrl_reg_6.filterPath));
@@ -1296,16 +1338,16 @@ int8_t ITDS_getfilterPath(ITDS_filter_Type *filterType)
 * @param  low noise state
 * @retval Error code
 */
-int8_t ITDS_enLowNoise(ITDS_state_t lowNoise)
+int8_t ITDS_enLowNoise(we_dev_t *dev, ITDS_state_t lowNoise)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	ctrl_reg_6.enLowNoise = lowNoise;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1316,11 +1358,11 @@ int8_t ITDS_enLowNoise(ITDS_state_t lowNoise)
 * @param  Pointer to the low noise configuration state
 * @retval Error code
 */
-int8_t ITDS_getLowNoiseState(ITDS_state_t *lowNoise)
+int8_t ITDS_getLowNoiseState(we_dev_t *dev, ITDS_state_t *lowNoise)
 {
 	ITDS_ctrl_6_t ctrl_reg_6;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6))
 	return WE_FAIL;
 
 	*lowNoise = (ITDS_state_t)(ctrl_reg_6.enLowNoise);
@@ -1336,11 +1378,11 @@ int8_t ITDS_getLowNoiseState(ITDS_state_t *lowNoise)
 * @param  Pointer to the Data-ready state.
 * @retval Error code
 */
-int8_t ITDS_getdataReadyState(ITDS_state_t *drdy)
+int8_t ITDS_getdataReadyState(we_dev_t *dev, ITDS_state_t *drdy)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*drdy = (ITDS_state_t)(status_reg.dataReady);
@@ -1352,10 +1394,10 @@ int8_t ITDS_getdataReadyState(ITDS_state_t *drdy)
 * @param  Pointer to the Free-fall event state.
 * @retval Error code
 */
-int8_t ITDS_getfreeFallState(ITDS_state_t *freeFall)
+int8_t ITDS_getfreeFallState(we_dev_t *dev, ITDS_state_t *freeFall)
 {
 	ITDS_status_t status_reg;
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*freeFall = (ITDS_state_t)(status_reg.freeFall);
@@ -1367,11 +1409,11 @@ int8_t ITDS_getfreeFallState(ITDS_state_t *freeFall)
 * @param  Pointer to the 6D change in position state.
 * @retval Error code
 */
-int8_t ITDS_get6DState(ITDS_state_t *sixD)
+int8_t ITDS_get6DState(we_dev_t *dev, ITDS_state_t *sixD)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*sixD = (ITDS_state_t)(status_reg.sixDDetection );
@@ -1383,11 +1425,11 @@ int8_t ITDS_get6DState(ITDS_state_t *sixD)
 * @param  Pointer to the single-tap event state.
 * @retval Error code
 */
-int8_t ITDS_getsingleTapState(ITDS_state_t *singleTap)
+int8_t ITDS_getsingleTapState(we_dev_t *dev, ITDS_state_t *singleTap)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*singleTap = (ITDS_state_t)(status_reg.singleTap);
@@ -1399,11 +1441,11 @@ int8_t ITDS_getsingleTapState(ITDS_state_t *singleTap)
 * @param  Pointer to the double-tap event state
 * @retval Error code
 */
-int8_t ITDS_getdoubleTapState(ITDS_state_t *doubleTap)
+int8_t ITDS_getdoubleTapState(we_dev_t *dev, ITDS_state_t *doubleTap)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*doubleTap = (ITDS_state_t)(status_reg.doubleTap);
@@ -1415,11 +1457,11 @@ int8_t ITDS_getdoubleTapState(ITDS_state_t *doubleTap)
 * @param  Pointer to the Sleep event state.
 * @retval Error code
 */
-int8_t ITDS_getsleepState(ITDS_state_t *sleepState )
+int8_t ITDS_getsleepState(we_dev_t *dev, ITDS_state_t *sleepState )
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*sleepState = (ITDS_state_t)(status_reg.sleep);
@@ -1431,11 +1473,11 @@ int8_t ITDS_getsleepState(ITDS_state_t *sleepState )
 * @param  Pointer to the wakeup event state.
 * @retval Error code
 */
-int8_t ITDS_getwakeupState(ITDS_state_t *wakeupState )
+int8_t ITDS_getwakeupState(we_dev_t *dev, ITDS_state_t *wakeupState )
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*wakeupState = (ITDS_state_t)(status_reg.wakeup);
@@ -1447,11 +1489,11 @@ int8_t ITDS_getwakeupState(ITDS_state_t *wakeupState )
 * @param  Pointer to the fifo Threshold event state.
 * @retval Error code
 */
-int8_t ITDS_getFifoThresholdStatus(ITDS_state_t *fifoTHR)
+int8_t ITDS_getFifoThresholdStatus(we_dev_t *dev, ITDS_state_t *fifoTHR)
 {
 	ITDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 
 	*fifoTHR = (ITDS_state_t)(status_reg.fifoThreshold);
@@ -1465,13 +1507,13 @@ int8_t ITDS_getFifoThresholdStatus(ITDS_state_t *fifoTHR)
 * @param  Pointer to the Raw X-axis acceleration
 * @retval Error code
 */
-int8_t ITDS_getRawAccelerationX(int16_t *XRawAcc)
+int8_t ITDS_getRawAccelerationX(we_dev_t *dev, int16_t *XRawAcc)
 {
 
 	int16_t  XAxisAccelerationRaw = 0;
 	uint8_t  tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_X_OUT_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_X_OUT_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	XAxisAccelerationRaw = (int16_t)(tmp[1] << 8);
@@ -1488,13 +1530,13 @@ int8_t ITDS_getRawAccelerationX(int16_t *XRawAcc)
 * @param  Pointer to the Raw Y-axis acceleration.
 * @retval Error code
 */
-int8_t ITDS_getRawAccelerationY(int16_t *YRawAcc)
+int8_t ITDS_getRawAccelerationY(we_dev_t *dev, int16_t *YRawAcc)
 {
 
 	int16_t  YAxisAcceleration = 0;
 	uint8_t  tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_Y_OUT_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_Y_OUT_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	YAxisAcceleration = (int16_t)(tmp[1] << 8);
@@ -1510,13 +1552,13 @@ int8_t ITDS_getRawAccelerationY(int16_t *YRawAcc)
 * @param  Pointer to the Raw Z-axis acceleration .
 * @retval Error code
 */
-int8_t ITDS_getRawAccelerationZ(int16_t *ZRawAcc)
+int8_t ITDS_getRawAccelerationZ(we_dev_t *dev, int16_t *ZRawAcc)
 {
 
 	int16_t  ZAxisAcceleration = 0;
 	uint8_t  tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_Z_OUT_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_Z_OUT_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	ZAxisAcceleration = (int16_t)(tmp[1] << 8);
@@ -1526,6 +1568,48 @@ int8_t ITDS_getRawAccelerationZ(int16_t *ZRawAcc)
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Read the Raw acceleration of all three axes in a single transfer
+*         X_OUT_L .. Z_OUT_H are read in one 6 byte burst, so all axes belong to the same output data cycle
+*         (with block data update enabled). Needs the address auto increment (CTRL_2 IF_ADD_INC, default on).
+* @param  Pointer to the Raw acceleration
+* @retval Error code
+*/
+int8_t ITDS_getRawAccelerationXYZ(we_dev_t *dev, ITDS_raw_acceleration_t *rawAcc)
+{
+	uint8_t tmp[6];
+
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_X_OUT_L_REG, 6, tmp))
+	return WE_FAIL;
+
+	rawAcc->x = (int16_t)((tmp[1] << 8) | tmp[0]);
+	rawAcc->y = (int16_t)((tmp[3] << 8) | tmp[2]);
+	rawAcc->z = (int16_t)((tmp[5] << 8) | tmp[4]);
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read the Raw acceleration of all three axes and the 8 bit Temperature in a single transfer
+*         T_OUT, STATUS and X_OUT_L .. Z_OUT_H are adjacent and read in one 8 byte burst.
+*         The 12 bit temperature (T_OUT_L/T_OUT_H) is not adjacent, use ITDS_getRawTemp12bit() for it.
+* @param  Pointer to the Raw acceleration
+* @param  Pointer to the 8 bit Temperature (same format as ITDS_getTemperature8bit())
+* @retval Error code
+*/
+int8_t ITDS_getRawAccelerationXYZAndTemperature(we_dev_t *dev, ITDS_raw_acceleration_t *rawAcc, uint8_t *temp8bit)
+{
+	uint8_t tmp[8];
+
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_T_OUT_REG, 8, tmp))
+	return WE_FAIL;
+
+	*temp8bit = tmp[0];
+	rawAcc->x = (int16_t)((tmp[3] << 8) | tmp[2]);
+	rawAcc->y = (int16_t)((tmp[5] << 8) | tmp[4]);
+	rawAcc->z = (int16_t)((tmp[7] << 8) | tmp[6]);
+	return WE_SUCCESS;
+}
+
 /*ITDS_T_OUT_REG*/
 /**
 * @brief  Read the 8 bit Temperature
@@ -1533,11 +1617,11 @@ int8_t ITDS_getRawAccelerationZ(int16_t *ZRawAcc)
 * @retval Error code
 */
 
-int8_t ITDS_getTemperature8bit(uint8_t *temp8bit)
+int8_t ITDS_getTemperature8bit(we_dev_t *dev, uint8_t *temp8bit)
 {
 
 	uint8_t temperatureValue8bit;
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_T_OUT_REG, 1, &temperatureValue8bit))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_T_OUT_REG, 1, &temperatureValue8bit))
 	return WE_FAIL;
 
 	*temp8bit = temperatureValue8bit;
@@ -1549,14 +1633,14 @@ int8_t ITDS_getTemperature8bit(uint8_t *temp8bit)
 * @param  Pointer to the Temperature
 * @retval Error code
 */
-int8_t  ITDS_getRawTemp12bit(int16_t *temp12bit)
+int8_t  ITDS_getRawTemp12bit(we_dev_t *dev, int16_t *temp12bit)
 {
 
 	uint8_t temp[2] = {0};
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_T_OUT_L_REG, 1, temp))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_T_OUT_L_REG, 1, temp))
 	return WE_FAIL;
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_T_OUT_H_REG, 1, temp + 1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_T_OUT_H_REG, 1, temp + 1))
 	return WE_FAIL;
 
 	*temp12bit = (int16_t) (temp[1] << 8);
@@ -1572,10 +1656,10 @@ int8_t  ITDS_getRawTemp12bit(int16_t *temp12bit)
 * @param  Pointer to the Temperature
 * @retval Error code
 */
-int8_t  ITDS_getTemperature12bit(float *tempdegC)
+int8_t  ITDS_getTemperature12bit(we_dev_t *dev, float *tempdegC)
 {
 	int16_t rawTemp = 0;
-	if(ITDS_getRawTemp12bit(&rawTemp) == WE_SUCCESS)
+	if(ITDS_getRawTemp12bit(dev, &rawTemp) == WE_SUCCESS)
 	{
 		*tempdegC = (((float) rawTemp)/16.0) + 25.0;
 	}
@@ -1586,22 +1670,39 @@ int8_t  ITDS_getTemperature12bit(float *tempdegC)
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Read the 12 bit Temperature in 0.01 °C, integer arithmetic only
+*         16 digit/°C, 0 digit = 25 °C
+* @param  Pointer to the Temperature in 0.01 °C
+* @retval Error code
+*/
+int8_t  ITDS_getTemperature12bitCentiDegC(we_dev_t *dev, int32_t *tempCentiDegC)
+{
+	int16_t rawTemp = 0;
+
+	if (WE_FAIL == ITDS_getRawTemp12bit(dev, &rawTemp))
+	return WE_FAIL;
+
+	*tempCentiDegC = WE_DIV_ROUND((int32_t)rawTemp * 25, 4) + 2500;
+	return WE_SUCCESS;
+}
+
 /*FIFO_CTRL (0x2E)*/
 /**
 * @brief  set the Fifo Threshold of the sensor
 * @param  Fifo Threshold
 * @retval Error code
 */
-int8_t ITDS_setFifoThreshold(uint8_t fifo_Threshold)
+int8_t ITDS_setFifoThreshold(we_dev_t *dev, uint8_t fifo_Threshold)
 {
 	ITDS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	fifo_ctrl_reg.fifoThresholdLevel = fifo_Threshold;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1612,11 +1713,11 @@ int8_t ITDS_setFifoThreshold(uint8_t fifo_Threshold)
 * @param  Pointer to the Fifo Threshold
 * @retval Error code
 */
-int8_t ITDS_getFifoThreshold(uint8_t *fifo_Threshold)
+int8_t ITDS_getFifoThreshold(we_dev_t *dev, uint8_t *fifo_Threshold)
 {
 	ITDS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	*fifo_Threshold = fifo_ctrl_reg.fifoThresholdLevel;
@@ -1628,16 +1729,16 @@ int8_t ITDS_getFifoThreshold(uint8_t *fifo_Threshold)
 * @param  Fifo Mode
 * @retval Error code
 */
-int8_t ITDS_setFifoMode(ITDS_Fifo_Mode FMode)
+int8_t ITDS_setFifoMode(we_dev_t *dev, ITDS_Fifo_Mode FMode)
 {
 	ITDS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	fifo_ctrl_reg.fifoMode = FMode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1648,11 +1749,11 @@ int8_t ITDS_setFifoMode(ITDS_Fifo_Mode FMode)
 * @param  Pointer to the Fifo Mode
 * @retval Error code
 */
-int8_t ITDS_getFifoMode(ITDS_Fifo_Mode *FMode)
+int8_t ITDS_getFifoMode(we_dev_t *dev, ITDS_Fifo_Mode *FMode)
 {
 	ITDS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	*FMode = (ITDS_Fifo_Mode)(fifo_ctrl_reg.fifoMode);
@@ -1668,11 +1769,11 @@ int8_t ITDS_getFifoMode(ITDS_Fifo_Mode *FMode)
 * @param  Pointer to the FIFO threshold state
 * @retval Error code
 */
-int8_t ITDS_getFifoThresholdState(ITDS_state_t *fifoTHR)
+int8_t ITDS_getFifoThresholdState(we_dev_t *dev, ITDS_state_t *fifoTHR)
 {
 	ITDS_fifo_samples_t fifo_samples_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
 	return WE_FAIL;
 
 	*fifoTHR = (ITDS_state_t)(fifo_samples_reg.fifoThresholdState);
@@ -1684,11 +1785,11 @@ int8_t ITDS_getFifoThresholdState(ITDS_state_t *fifoTHR)
 * @param  Pointer to the FIFO overrun state .
 * @retval Error code
 */
-int8_t ITDS_getFifoOverrunState(ITDS_state_t *fifoOverrun)
+int8_t ITDS_getFifoOverrunState(we_dev_t *dev, ITDS_state_t *fifoOverrun)
 {
 	ITDS_fifo_samples_t fifo_samples_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
 	return WE_FAIL;
 
 	*fifoOverrun = (ITDS_state_t)(fifo_samples_reg.fifoOverrunState);
@@ -1700,17 +1801,137 @@ int8_t ITDS_getFifoOverrunState(ITDS_state_t *fifoOverrun)
 * @param  pointer to the FIFO Fill Level
 * @retval Error code
 */
-int8_t ITDS_getFifoFillLevel(uint8_t *fifoFill)
+int8_t ITDS_getFifoFillLevel(we_dev_t *dev, uint8_t *fifoFill)
 {
 	ITDS_fifo_samples_t fifo_samples_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
 	return WE_FAIL;
 
 	*fifoFill = (fifo_samples_reg.fifoFillLevel);
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Drain the FIFO
+*         Reads FIFO_SAMPLES once and then up to maxSamples XYZ samples, oldest first, in a single burst from
+*         X_OUT_L: with the FIFO enabled and the address auto increment on (CTRL_2 IF_ADD_INC), the address rolls
+*         over from Z_OUT_H to X_OUT_L, so every 6 bytes are the next sample. Samples beyond maxSamples stay in the FIFO.
+* @param  Buffer for the Raw acceleration samples
+* @param  Maximum number of samples to read, size of the buffer
+* @param  Pointer to the number of samples read
+* @param  Pointer to the FIFO overrun state before the drain (ITDS_enable: samples have been lost), may be NULL
+* @retval Error code
+*/
+int8_t ITDS_readFifo(we_dev_t *dev, ITDS_raw_acceleration_t *buffer, uint8_t maxSamples, uint8_t *count, ITDS_state_t *overrun)
+{
+	ITDS_fifo_samples_t fifo_samples_reg;
+	uint8_t tmp[6 * ITDS_FIFO_DEPTH];
+	uint8_t samples;
+	uint8_t i;
+
+	*count = 0;
+
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FIFO_SAMPLES_REG, 1, (uint8_t *)&fifo_samples_reg))
+	return WE_FAIL;
+
+	if (overrun != NULL)
+	{
+		*overrun = (ITDS_state_t)fifo_samples_reg.fifoOverrunState;
+	}
+
+	samples = fifo_samples_reg.fifoFillLevel;
+	if (samples > ITDS_FIFO_DEPTH)
+	{
+		samples = ITDS_FIFO_DEPTH;
+	}
+	if (samples > maxSamples)
+	{
+		samples = maxSamples;
+	}
+	if (samples == 0)
+	return WE_SUCCESS;
+
+	/* the burst rolls over from Z_OUT_H to X_OUT_L, it must not be stored in the register cache as 0x28 .. 0x28 + 6 * samples - 1 */
+	if (WE_FAIL == ReadRegUncached(dev, (uint8_t)ITDS_X_OUT_L_REG, 6 * samples, tmp))
+	return WE_FAIL;
+
+	for (i = 0; i < samples; i++)
+	{
+		buffer[i].x = (int16_t)((tmp[6 * i + 1] << 8) | tmp[6 * i]);
+		buffer[i].y = (int16_t)((tmp[6 * i + 3] << 8) | tmp[6 * i + 2]);
+		buffer[i].z = (int16_t)((tmp[6 * i + 5] << 8) | tmp[6 * i + 4]);
+	}
+
+	*count = samples;
+	return WE_SUCCESS;
+}
+
+/* output data rate in 0.1 Hz for ODR[3:0] in high performance, normal and low power mode */
+static const uint16_t ITDS_odrDeciHz[3][10] = {
+	{ 0, 125, 125, 250, 500, 1000, 2000, 4000, 8000, 16000 },
+	{ 0, 125, 125, 250, 500, 1000, 2000, 2000, 8000, 16000 },
+	{ 0, 16, 125, 250, 500, 1000, 2000, 2000, 2000, 2000 }
+};
+
+/**
+* @brief  Nominal output data period, e.g. for SampleClockInit()
+* @param  Output data rate (CTRL_1 ODR)
+* @param  Operating mode (CTRL_1 MODE)
+* @param  Power mode (CTRL_1 LP_MODE)
+* @retval Period in ns, 0 in power down and single conversion mode
+*/
+uint64_t ITDS_getSamplePeriodNs(ITDS_output_Data_Rate odr, ITDS_operating_mode operatingMode, ITDS_power_mode powerMode)
+{
+	int column;
+
+	if ((odr > odr9) || (operatingMode == singleConvertion))
+	return 0;
+
+	column = (operatingMode == highPerformance) ? 0 : ((powerMode == normalMode) ? 1 : 2);
+	if (ITDS_odrDeciHz[column][odr] == 0)
+	return 0;
+
+	return 10000000000ULL / ITDS_odrDeciHz[column][odr];
+}
+
+/**
+* @brief  Drain the FIFO and timestamp the samples
+*         ITDS_readFifo() followed by a single clock reading: the newest sample is dated at the drain, the older
+*         ones back-dated by the period of the sample clock, which is drift corrected over successive drains.
+*         A FIFO overrun restarts the sample clock.
+* @param  Sample clock initialized with ITDS_getSamplePeriodNs() of the active configuration
+* @param  Buffer for the timestamped samples
+* @param  Maximum number of samples to read, size of the buffer
+* @param  Pointer to the number of samples read
+* @retval Error code
+*/
+int8_t ITDS_readFifoTimestamped(we_dev_t *dev, we_sample_clock_t *clock, ITDS_sample_t *buffer, uint8_t maxSamples, uint8_t *count)
+{
+	ITDS_raw_acceleration_t raw[ITDS_FIFO_DEPTH];
+	ITDS_state_t overrun;
+	uint64_t firstNs, periodNs;
+	uint8_t i;
+
+	if (maxSamples > ITDS_FIFO_DEPTH)
+	{
+		maxSamples = ITDS_FIFO_DEPTH;
+	}
+
+	if (WE_FAIL == ITDS_readFifo(dev, raw, maxSamples, count, &overrun))
+	return WE_FAIL;
+
+	SampleClockDrain(clock, SampleClockNowNs(), *count, overrun == ITDS_enable, &firstNs, &periodNs);
+
+	for (i = 0; i < *count; i++)
+	{
+		buffer[i].timestampNs = firstNs + i * periodNs;
+		buffer[i].raw = raw[i];
+	}
+
+	return WE_SUCCESS;
+}
+
 
 /*TAP_X_TH (0x30)*/
 
@@ -1719,16 +1940,16 @@ int8_t ITDS_getFifoFillLevel(uint8_t *fifoFill)
 * @param  the 4D detection position state
 * @retval Error code
 */
-int8_t ITDS_en4DDetection(ITDS_state_t detection4D)
+int8_t ITDS_en4DDetection(we_dev_t *dev, ITDS_state_t detection4D)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	tap_x_th.fourDPositionState = detection4D;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1739,11 +1960,11 @@ int8_t ITDS_en4DDetection(ITDS_state_t detection4D)
 * @param  Pointer to the 4D detection position state.
 * @retval Error code
 */
-int8_t ITDS_get4DDetectionState(ITDS_state_t *detection4D)
+int8_t ITDS_get4DDetectionState(we_dev_t *dev, ITDS_state_t *detection4D)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	*detection4D = (ITDS_state_t)(tap_x_th.fourDPositionState);
@@ -1755,16 +1976,16 @@ int8_t ITDS_get4DDetectionState(ITDS_state_t *detection4D)
 * @param  Tap Threshold X axis
 * @retval Error code
 */
-int8_t ITDS_setTapThresholdX(uint8_t tapThresholdX)
+int8_t ITDS_setTapThresholdX(we_dev_t *dev, uint8_t tapThresholdX)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	tap_x_th.XAxisTapThreshold = tapThresholdX;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1775,11 +1996,11 @@ int8_t ITDS_setTapThresholdX(uint8_t tapThresholdX)
 * @param  Pointer to the Tap Threshold X axis
 * @retval Error code
 */
-int8_t ITDS_getTapThresholdX(uint8_t *tapThresholdX)
+int8_t ITDS_getTapThresholdX(we_dev_t *dev, uint8_t *tapThresholdX)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	*tapThresholdX = (ITDS_state_t)(tap_x_th.XAxisTapThreshold);
@@ -1791,16 +2012,16 @@ int8_t ITDS_getTapThresholdX(uint8_t *tapThresholdX)
 * @param  6D Threshold (degrees)
 * @retval Error code
 */
-int8_t ITDS_set6DThreshold(ITDS_threshold_Degree threshold6D)
+int8_t ITDS_set6DThreshold(we_dev_t *dev, ITDS_threshold_Degree threshold6D)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	tap_x_th.sixDThreshold = threshold6D;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1811,11 +2032,11 @@ int8_t ITDS_set6DThreshold(ITDS_threshold_Degree threshold6D)
 * @param  Pointer to the 6D Threshold
 * @retval Error code
 */
-int8_t ITDS_get6DThreshold(ITDS_threshold_Degree *threshold6D)
+int8_t ITDS_get6DThreshold(we_dev_t *dev, ITDS_threshold_Degree *threshold6D)
 {
 	ITDS_tap_x_th_t tap_x_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_X_TH_REG, 1, (uint8_t *)&tap_x_th))
 	return WE_FAIL;
 
 	*threshold6D = (ITDS_threshold_Degree)(tap_x_th.sixDThreshold);
@@ -1830,16 +2051,16 @@ int8_t ITDS_get6DThreshold(ITDS_threshold_Degree *threshold6D)
 * @param  Tap Threshold Y axis
 * @retval Error code
 */
-int8_t ITDS_setTapThresholdY(uint8_t tapThresholdY)
+int8_t ITDS_setTapThresholdY(we_dev_t *dev, uint8_t tapThresholdY)
 {
 	ITDS_tap_y_th_t tap_y_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	tap_y_th.YAxisTapThreshold = tapThresholdY;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1850,11 +2071,11 @@ int8_t ITDS_setTapThresholdY(uint8_t tapThresholdY)
 * @param  Pointer to the Tap Threshold Y axis.
 * @retval Error code
 */
-int8_t ITDS_getTapThresholdY(uint8_t *tapThresholdY)
+int8_t ITDS_getTapThresholdY(we_dev_t *dev, uint8_t *tapThresholdY)
 {
 	ITDS_tap_y_th_t tap_y_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	*tapThresholdY = (tap_y_th.YAxisTapThreshold);
@@ -1866,16 +2087,16 @@ int8_t ITDS_getTapThresholdY(uint8_t *tapThresholdY)
 * @param  Axis Tap detection priority
 * @retval Error code
 */
-int8_t ITDS_setTapAxisPriority(ITDS_tap_Axis_Priority tapPriorityAxis)
+int8_t ITDS_setTapAxisPriority(we_dev_t *dev, ITDS_tap_Axis_Priority tapPriorityAxis)
 {
 	ITDS_tap_y_th_t tap_y_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	tap_y_th.tapAxisPriority = tapPriorityAxis;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1886,11 +2107,11 @@ int8_t ITDS_setTapAxisPriority(ITDS_tap_Axis_Priority tapPriorityAxis)
 * @param  Pointer to the Axis Tap detection priority
 * @retval Error code
 */
-int8_t ITDS_getTapAxisPriority(ITDS_tap_Axis_Priority *tapPriorityAxis)
+int8_t ITDS_getTapAxisPriority(we_dev_t *dev, ITDS_tap_Axis_Priority *tapPriorityAxis)
 {
 	ITDS_tap_y_th_t tap_y_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Y_TH_REG, 1, (uint8_t *)&tap_y_th))
 	return WE_FAIL;
 
 	*tapPriorityAxis = (ITDS_tap_Axis_Priority)(tap_y_th.tapAxisPriority);
@@ -1906,16 +2127,16 @@ int8_t ITDS_getTapAxisPriority(ITDS_tap_Axis_Priority *tapPriorityAxis)
 * @param  Tap Threshold Z axis
 * @retval Error code
 */
-int8_t ITDS_setTapThresholdZ(uint8_t tapThresholdZ)
+int8_t ITDS_setTapThresholdZ(we_dev_t *dev, uint8_t tapThresholdZ)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	tap_z_th.ZAxisTapThreshold = tapThresholdZ;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1926,11 +2147,11 @@ int8_t ITDS_setTapThresholdZ(uint8_t tapThresholdZ)
 * @param  Pointer to the Tap Threshold Z axis.
 * @retval Error code
 */
-int8_t ITDS_getTapThresholdZ(uint8_t *tapThresholdZ)
+int8_t ITDS_getTapThresholdZ(we_dev_t *dev, uint8_t *tapThresholdZ)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	*tapThresholdZ = (tap_z_th.ZAxisTapThreshold);
@@ -1942,16 +2163,16 @@ int8_t ITDS_getTapThresholdZ(uint8_t *tapThresholdZ)
 * @param  tap X direction  State
 * @retval Error code
 */
-int8_t ITDS_enTapX(ITDS_state_t tapX)
+int8_t ITDS_enTapX(we_dev_t *dev, ITDS_state_t tapX)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	tap_z_th.enTapX = tapX;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1962,11 +2183,11 @@ int8_t ITDS_enTapX(ITDS_state_t tapX)
 * @param  Pointer to tap X direction  State.
 * @retval Error code
 */
-int8_t ITDS_getTapX(ITDS_state_t *tapX)
+int8_t ITDS_getTapX(we_dev_t *dev, ITDS_state_t *tapX)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	*tapX = (ITDS_state_t)(tap_z_th.enTapX);
@@ -1978,16 +2199,16 @@ int8_t ITDS_getTapX(ITDS_state_t *tapX)
 * @param  tap Y direction  State
 * @retval Error code
 */
-int8_t ITDS_enTapY(ITDS_state_t tapY)
+int8_t ITDS_enTapY(we_dev_t *dev, ITDS_state_t tapY)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	tap_z_th.enTapY = tapY;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1998,11 +2219,11 @@ int8_t ITDS_enTapY(ITDS_state_t tapY)
 * @param  Pointer to tap Y direction  State.
 * @retval Error code
 */
-int8_t ITDS_getTapY(ITDS_state_t *tapY)
+int8_t ITDS_getTapY(we_dev_t *dev, ITDS_state_t *tapY)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	*tapY = (ITDS_state_t)(tap_z_th.enTapY);
@@ -2016,16 +2237,16 @@ int8_t ITDS_getTapY(ITDS_state_t *tapY)
 * @param  tap Z direction  State
 * @retval Error code
 */
-int8_t ITDS_enTapZ(ITDS_state_t tapZ)
+int8_t ITDS_enTapZ(we_dev_t *dev, ITDS_state_t tapZ)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	tap_z_th.enTapZ = tapZ;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2036,11 +2257,11 @@ int8_t ITDS_enTapZ(ITDS_state_t tapZ)
 * @param  Pointer to the tap Z direction state
 * @retval Error code
 */
-int8_t ITDS_getTapZ(ITDS_state_t *tapZ)
+int8_t ITDS_getTapZ(we_dev_t *dev, ITDS_state_t *tapZ)
 {
 	ITDS_tap_z_th_t tap_z_th;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_Z_TH_REG, 1, (uint8_t *)&tap_z_th))
 	return WE_FAIL;
 
 	*tapZ = (ITDS_state_t)(tap_z_th.enTapZ);
@@ -2054,16 +2275,16 @@ int8_t ITDS_getTapZ(ITDS_state_t *tapZ)
 * @param  Latency value
 * @retval Error code
 */
-int8_t ITDS_setLatency(uint8_t latency_t)
+int8_t ITDS_setLatency(we_dev_t *dev, uint8_t latency_t)
 {
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	int_dur_t.latency = latency_t;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2074,12 +2295,12 @@ int8_t ITDS_setLatency(uint8_t latency_t)
 * @param  Pointer to LATENCY .
 * @retval Error code
 */
-int8_t ITDS_getLatency(uint8_t *latency_t)
+int8_t ITDS_getLatency(we_dev_t *dev, uint8_t *latency_t)
 {
 
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	*latency_t = (ITDS_state_t)(int_dur_t.latency);
@@ -2091,16 +2312,16 @@ int8_t ITDS_getLatency(uint8_t *latency_t)
 * @param  quiet time value
 * @retval Error code
 */
-int8_t ITDS_setQuiet(uint8_t quiet_t)
+int8_t ITDS_setQuiet(we_dev_t *dev, uint8_t quiet_t)
 {
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	int_dur_t.quiet = quiet_t;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2111,12 +2332,12 @@ int8_t ITDS_setQuiet(uint8_t quiet_t)
 * @param  Pointer to  QUIET
 * @retval Error code
 */
-int8_t ITDS_getQuiet(uint8_t *quiet_t)
+int8_t ITDS_getQuiet(we_dev_t *dev, uint8_t *quiet_t)
 {
 
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	*quiet_t = (ITDS_state_t)(int_dur_t.quiet);
@@ -2128,16 +2349,16 @@ int8_t ITDS_getQuiet(uint8_t *quiet_t)
 * @param  SHOCK time value
 * @retval Error code
 */
-int8_t ITDS_setShock(uint8_t shock_t)
+int8_t ITDS_setShock(we_dev_t *dev, uint8_t shock_t)
 {
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	int_dur_t.shock = shock_t;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2148,12 +2369,12 @@ int8_t ITDS_setShock(uint8_t shock_t)
 * @param  Pointer to SHOCK .
 * @retval Error code
 */
-int8_t ITDS_getShock(uint8_t *shock_t)
+int8_t ITDS_getShock(we_dev_t *dev, uint8_t *shock_t)
 {
 
 	ITDS_int_dur_t int_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_INT_DUR_REG, 1, (uint8_t *)&int_dur_t))
 	return WE_FAIL;
 
 	*shock_t = (ITDS_state_t)(int_dur_t.shock);
@@ -2168,16 +2389,16 @@ int8_t ITDS_getShock(uint8_t *shock_t)
 * @param  tap event State [0:only single, 1: single and double-tap]
 * @retval Error code
 */
-int8_t ITDS_enTapEvent(ITDS_state_t singleDoubleTap)
+int8_t ITDS_enTapEvent(we_dev_t *dev, ITDS_state_t singleDoubleTap)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	wake_up_th_t.enTapEvent = singleDoubleTap;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2188,11 +2409,11 @@ int8_t ITDS_enTapEvent(ITDS_state_t singleDoubleTap)
 * @param  Pointer to the tap event State
 * @retval Error code
 */
-int8_t ITDS_getTapEvent(ITDS_state_t *singleDoubleTap)
+int8_t ITDS_getTapEvent(we_dev_t *dev, ITDS_state_t *singleDoubleTap)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	*singleDoubleTap = (ITDS_state_t)(wake_up_th_t.enTapEvent);
@@ -2204,16 +2425,16 @@ int8_t ITDS_getTapEvent(ITDS_state_t *singleDoubleTap)
 * @param  sleep state
 * @retval Error code
 */
-int8_t ITDS_enInactivity(ITDS_state_t sleep)
+int8_t ITDS_enInactivity(we_dev_t *dev, ITDS_state_t sleep)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	wake_up_th_t.enInactivtyEvent = sleep;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2224,11 +2445,11 @@ int8_t ITDS_enInactivity(ITDS_state_t sleep)
 * @param  Pointer to the inactivity(sleep) State .
 * @retval Error code
 */
-int8_t ITDS_getInactivityState(ITDS_state_t *sleep)
+int8_t ITDS_getInactivityState(we_dev_t *dev, ITDS_state_t *sleep)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	*sleep = (ITDS_state_t)(wake_up_th_t.enInactivtyEvent);
@@ -2240,16 +2461,16 @@ int8_t ITDS_getInactivityState(ITDS_state_t *sleep)
 * @param  wake up threshold
 * @retval Error code
 */
-int8_t ITDS_setWakeupThreshold(uint8_t WakeupTHR)
+int8_t ITDS_setWakeupThreshold(we_dev_t *dev, uint8_t WakeupTHR)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	wake_up_th_t.wakeupThreshold = WakeupTHR;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2260,11 +2481,11 @@ int8_t ITDS_setWakeupThreshold(uint8_t WakeupTHR)
 * @param  Pointer to the Wakeup threshold.
 * @retval Error code
 */
-int8_t ITDS_getWakeupThreshold(uint8_t *WakeupTHR)
+int8_t ITDS_getWakeupThreshold(we_dev_t *dev, uint8_t *WakeupTHR)
 {
 	ITDS_wake_up_th_t wake_up_th_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_TH_REG, 1, (uint8_t *)&wake_up_th_t))
 	return WE_FAIL;
 
 	*WakeupTHR = (wake_up_th_t.wakeupThreshold);
@@ -2279,16 +2500,16 @@ int8_t ITDS_getWakeupThreshold(uint8_t *WakeupTHR)
 * @param  Free-fall duration MSB
 * @retval Error code
 */
-int8_t ITDS_setFreeFallDurationMSB(ITDS_state_t FF_DUR5)
+int8_t ITDS_setFreeFallDurationMSB(we_dev_t *dev, ITDS_state_t FF_DUR5)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	wake_up_dur_t.freeFallDurationMSB = FF_DUR5;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2299,11 +2520,11 @@ int8_t ITDS_setFreeFallDurationMSB(ITDS_state_t FF_DUR5)
 * @param  Pointer to the Free-fall duration MSB .
 * @retval Error code
 */
-int8_t ITDS_getFreeFallDurationMSB(ITDS_state_t *FF_DUR5)
+int8_t ITDS_getFreeFallDurationMSB(we_dev_t *dev, ITDS_state_t *FF_DUR5)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	*FF_DUR5=(ITDS_state_t)(wake_up_dur_t.freeFallDurationMSB);
@@ -2315,16 +2536,16 @@ int8_t ITDS_getFreeFallDurationMSB(ITDS_state_t *FF_DUR5)
 * @param  State
 * @retval Error code
 */
-int8_t ITDS_enStationnaryDetection(ITDS_state_t stationary)
+int8_t ITDS_enStationnaryDetection(we_dev_t *dev, ITDS_state_t stationary)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	wake_up_dur_t.enStationary = stationary;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2335,11 +2556,11 @@ int8_t ITDS_enStationnaryDetection(ITDS_state_t stationary)
 * @param  Pointer to the stationary detection state
 * @retval Error code
 */
-int8_t ITDS_getStationnaryState(ITDS_state_t *stationary)
+int8_t ITDS_getStationnaryState(we_dev_t *dev, ITDS_state_t *stationary)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	*stationary = (ITDS_state_t)(wake_up_dur_t.enStationary);
@@ -2351,16 +2572,16 @@ int8_t ITDS_getStationnaryState(ITDS_state_t *stationary)
 * @param  Wakeup duration
 * @retval Error code
 */
-int8_t ITDS_setWakeupDuration(uint8_t wakeDUR)
+int8_t ITDS_setWakeupDuration(we_dev_t *dev, uint8_t wakeDUR)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	wake_up_dur_t.wakeupDuration = wakeDUR;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2371,11 +2592,11 @@ int8_t ITDS_setWakeupDuration(uint8_t wakeDUR)
 * @param  Pointer to the Wakeup duration
 * @retval Error code
 */
-int8_t ITDS_getWakeupDuration(uint8_t *wakeDUR)
+int8_t ITDS_getWakeupDuration(we_dev_t *dev, uint8_t *wakeDUR)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	*wakeDUR=(wake_up_dur_t.wakeupDuration);
@@ -2387,16 +2608,16 @@ int8_t ITDS_getWakeupDuration(uint8_t *wakeDUR)
 * @param  Sleep Mode Duration
 * @retval Error code
 */
-int8_t ITDS_setSleepDuration(uint8_t sleepDur)
+int8_t ITDS_setSleepDuration(we_dev_t *dev, uint8_t sleepDur)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	wake_up_dur_t.sleepDuration = sleepDur;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2407,11 +2628,11 @@ int8_t ITDS_setSleepDuration(uint8_t sleepDur)
 * @param  Pointer to the Sleep Mode Duration
 * @retval Error code
 */
-int8_t ITDS_getSleepDuration(uint8_t *sleepDur)
+int8_t ITDS_getSleepDuration(we_dev_t *dev, uint8_t *sleepDur)
 {
 	ITDS_wake_up_dur_t wake_up_dur_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_DUR_REG, 1, (uint8_t *)&wake_up_dur_t))
 	return WE_FAIL;
 
 	*sleepDur = (wake_up_dur_t.sleepDuration);
@@ -2427,16 +2648,16 @@ int8_t ITDS_getSleepDuration(uint8_t *sleepDur)
 * @param  Free-fall duration LSB
 * @retval Error code
 */
-int8_t ITDS_setFreeFallDurationLSB(uint8_t FF_DURLSB)
+int8_t ITDS_setFreeFallDurationLSB(we_dev_t *dev, uint8_t FF_DURLSB)
 {
 	ITDS_free_fall_t free_fall_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	free_fall_t.freeFallDurationLSB = FF_DURLSB;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2447,11 +2668,11 @@ int8_t ITDS_setFreeFallDurationLSB(uint8_t FF_DURLSB)
 * @param  Pointer to the Free-fall duration LSB
 * @retval Error code
 */
-int8_t ITDS_getFreeFallDurationLSB(uint8_t *FF_DURLSB)
+int8_t ITDS_getFreeFallDurationLSB(we_dev_t *dev, uint8_t *FF_DURLSB)
 {
 	ITDS_free_fall_t free_fall_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	*FF_DURLSB = (free_fall_t.freeFallDurationLSB);
@@ -2463,16 +2684,16 @@ int8_t ITDS_getFreeFallDurationLSB(uint8_t *FF_DURLSB)
 * @param  Free-fall Threshold Decoding
 * @retval Error code
 */
-int8_t ITDS_setFreeFallThreshold(ITDS_Free_Fall_Thr FF_TH)
+int8_t ITDS_setFreeFallThreshold(we_dev_t *dev, ITDS_Free_Fall_Thr FF_TH)
 {
 	ITDS_free_fall_t free_fall_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	free_fall_t.freeFallThreshold = FF_TH;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2483,11 +2704,11 @@ int8_t ITDS_setFreeFallThreshold(ITDS_Free_Fall_Thr FF_TH)
 * @param  Pointer to the Free-fall Threshold decoding
 * @retval Error code
 */
-int8_t ITDS_getFreeFallThreshold(ITDS_Free_Fall_Thr *FF_TH)
+int8_t ITDS_getFreeFallThreshold(we_dev_t *dev, ITDS_Free_Fall_Thr *FF_TH)
 {
 	ITDS_free_fall_t free_fall_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_FREE_FALL_REG, 1, (uint8_t *)&free_fall_t))
 	return WE_FAIL;
 
 	*FF_TH = (ITDS_Free_Fall_Thr)(free_fall_t.freeFallThreshold);
@@ -2503,11 +2724,11 @@ int8_t ITDS_getFreeFallThreshold(ITDS_Free_Fall_Thr *FF_TH)
 * @param  Pointer to the temperature data state
 * @retval Error code
 */
-int8_t ITDS_getTempDrdy(ITDS_state_t *tempDrdy )
+int8_t ITDS_getTempDrdy(we_dev_t *dev, ITDS_state_t *tempDrdy )
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*tempDrdy = (ITDS_state_t)(status_detect_t.tempDrdy);
@@ -2519,11 +2740,11 @@ int8_t ITDS_getTempDrdy(ITDS_state_t *tempDrdy )
 * @param  Pointer to the Sleep event data state
 * @retval Error code
 */
-int8_t ITDS_getSleepState(ITDS_state_t *sleepState)
+int8_t ITDS_getSleepState(we_dev_t *dev, ITDS_state_t *sleepState)
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*sleepState = (ITDS_state_t)(status_detect_t.sleepState);
@@ -2535,11 +2756,11 @@ int8_t ITDS_getSleepState(ITDS_state_t *sleepState)
 * @param  Pointer to the double Tap Event State
 * @retval Error code
 */
-int8_t ITDS_getDoubleTapState(ITDS_state_t *doubleTap)
+int8_t ITDS_getDoubleTapState(we_dev_t *dev, ITDS_state_t *doubleTap)
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*doubleTap = (ITDS_state_t)(status_detect_t.doubleTapState);
@@ -2551,11 +2772,11 @@ int8_t ITDS_getDoubleTapState(ITDS_state_t *doubleTap)
 * @param  Pointer to the single Tap Event State
 * @retval Error code
 */
-int8_t ITDS_getSingleTapState(ITDS_state_t *singleTap)
+int8_t ITDS_getSingleTapState(we_dev_t *dev, ITDS_state_t *singleTap)
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*singleTap=(ITDS_state_t)(status_detect_t.singleTapState);
@@ -2567,11 +2788,11 @@ int8_t ITDS_getSingleTapState(ITDS_state_t *singleTap)
 * @param  Pointer to the temperature data state
 * @retval Error code
 */
-int8_t ITDS_getDrdy(ITDS_state_t *drdy)
+int8_t ITDS_getDrdy(we_dev_t *dev, ITDS_state_t *drdy)
 {
 	ITDS_status_detect_t status_detect_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_STATUS_DETECT_REG, 1, (uint8_t *)&status_detect_t))
 	return WE_FAIL;
 
 	*drdy = (ITDS_state_t)(status_detect_t.drdy);
@@ -2587,11 +2808,11 @@ int8_t ITDS_getDrdy(ITDS_state_t *drdy)
 * @param  pointer to the Wake-up Event detection Status On X Axis
 * @retval Error code
 */
-int8_t ITDS_getWakeupX(ITDS_state_t *wakeUpX)
+int8_t ITDS_getWakeupX(we_dev_t *dev, ITDS_state_t *wakeUpX)
 {
 	ITDS_wake_up_event_t wake_up_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
 	return WE_FAIL;
 
 	*wakeUpX = (ITDS_state_t)(wake_up_event_t.wakeUpX);
@@ -2603,11 +2824,11 @@ int8_t ITDS_getWakeupX(ITDS_state_t *wakeUpX)
 * @param  pointer to the Wake-up Event detection Status On Y Axis.
 * @retval Error code
 */
-int8_t ITDS_getWakeupY(ITDS_state_t *wakeUpY)
+int8_t ITDS_getWakeupY(we_dev_t *dev, ITDS_state_t *wakeUpY)
 {
 	ITDS_wake_up_event_t wake_up_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
 	return WE_FAIL;
 
 	*wakeUpY = (ITDS_state_t)(wake_up_event_t.wakeUpY);
@@ -2619,11 +2840,11 @@ int8_t ITDS_getWakeupY(ITDS_state_t *wakeUpY)
 * @param  pointer to the Wake-up Event detection Status On Z Axis.
 * @retval Error code
 */
-int8_t ITDS_getWakeupZ(ITDS_state_t *wakeUpZ)
+int8_t ITDS_getWakeupZ(we_dev_t *dev, ITDS_state_t *wakeUpZ)
 {
 	ITDS_wake_up_event_t wake_up_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
 	return WE_FAIL;
 
 	*wakeUpZ = (ITDS_state_t)(wake_up_event_t.wakeUpZ);
@@ -2635,11 +2856,11 @@ int8_t ITDS_getWakeupZ(ITDS_state_t *wakeUpZ)
 * @param  Pointer to the Wake-up Event detection State.
 * @retval Error code
 */
-int8_t ITDS_getWakeupState(ITDS_state_t *wakeUpState )
+int8_t ITDS_getWakeupState(we_dev_t *dev, ITDS_state_t *wakeUpState )
 {
 	ITDS_wake_up_event_t wake_up_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_WAKE_UP_EVENT_REG, 1, (uint8_t *)&wake_up_event_t))
 	return WE_FAIL;
 
 	*wakeUpState = (ITDS_state_t)(wake_up_event_t.wakeUpState);
@@ -2655,11 +2876,11 @@ int8_t ITDS_getWakeupState(ITDS_state_t *wakeUpState )
 * @param  Pointer to the Tap Event State
 * @retval Error code
 */
-int8_t ITDS_getTapEventState(ITDS_state_t *tapEvent)
+int8_t ITDS_getTapEventState(we_dev_t *dev, ITDS_state_t *tapEvent)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapEvent = (ITDS_state_t)(tap_event_t.tapEventState);
@@ -2671,11 +2892,11 @@ int8_t ITDS_getTapEventState(ITDS_state_t *tapEvent)
 * @param  Pointer to the Accelarion Sign
 * @retval Error code
 */
-int8_t ITDS_getTapSign(ITDS_tapSign_t *tapSign)
+int8_t ITDS_getTapSign(we_dev_t *dev, ITDS_tapSign_t *tapSign)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapSign = (ITDS_tapSign_t)(tap_event_t.tapSign);
@@ -2687,11 +2908,11 @@ int8_t ITDS_getTapSign(ITDS_tapSign_t *tapSign)
 * @param  Pointer to the Tap Event Status on X Axis.
 * @retval Error code
 */
-int8_t ITDS_getTapXAxis(ITDS_state_t *tapXAxis)
+int8_t ITDS_getTapXAxis(we_dev_t *dev, ITDS_state_t *tapXAxis)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapXAxis = (ITDS_state_t)(tap_event_t.tapXAxis);
@@ -2703,11 +2924,11 @@ int8_t ITDS_getTapXAxis(ITDS_state_t *tapXAxis)
 * @param  Pointer to the Tap Event Status on Y Axis.
 * @retval Error code
 */
-int8_t ITDS_getTapYAxis(ITDS_state_t *tapYAxis)
+int8_t ITDS_getTapYAxis(we_dev_t *dev, ITDS_state_t *tapYAxis)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapYAxis = (ITDS_state_t)(tap_event_t.tapYAxis);
@@ -2719,11 +2940,11 @@ int8_t ITDS_getTapYAxis(ITDS_state_t *tapYAxis)
 * @param  Pointer to the Tap Event Status on Z Axis.
 * @retval Error code
 */
-int8_t ITDS_getTapZAxis(ITDS_state_t *tapZAxis)
+int8_t ITDS_getTapZAxis(we_dev_t *dev, ITDS_state_t *tapZAxis)
 {
 	ITDS_tap_event_t tap_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_TAP_EVENT_REG, 1, (uint8_t *)&tap_event_t))
 	return WE_FAIL;
 
 	*tapZAxis = (ITDS_state_t)(tap_event_t.tapZAxis);
@@ -2739,11 +2960,11 @@ int8_t ITDS_getTapZAxis(ITDS_state_t *tapZAxis)
 * @param  Pointer to the XL Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getXLOverThresholdState(ITDS_state_t *XLOverThreshold)
+int8_t ITDS_getXLOverThresholdState(we_dev_t *dev, ITDS_state_t *XLOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*XLOverThreshold=(ITDS_state_t)(event_6D_t.XLOverThreshold);
@@ -2755,11 +2976,11 @@ int8_t ITDS_getXLOverThresholdState(ITDS_state_t *XLOverThreshold)
 * @param  Pointer to the XH Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getXHOverThresholdState(ITDS_state_t *XHOverThreshold)
+int8_t ITDS_getXHOverThresholdState(we_dev_t *dev, ITDS_state_t *XHOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*XHOverThreshold = (ITDS_state_t)(event_6D_t.XHOverThreshold);
@@ -2771,11 +2992,11 @@ int8_t ITDS_getXHOverThresholdState(ITDS_state_t *XHOverThreshold)
 * @param  Pointer to the XL Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getYLOverThresholdState(ITDS_state_t *YLOverThreshold)
+int8_t ITDS_getYLOverThresholdState(we_dev_t *dev, ITDS_state_t *YLOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*YLOverThreshold = (ITDS_state_t)(event_6D_t.YLOverThreshold);
@@ -2787,11 +3008,11 @@ int8_t ITDS_getYLOverThresholdState(ITDS_state_t *YLOverThreshold)
 * @param  Pointer to the YL Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getYHOverThresholdState(ITDS_state_t *YHOverThreshold)
+int8_t ITDS_getYHOverThresholdState(we_dev_t *dev, ITDS_state_t *YHOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*YHOverThreshold = (ITDS_state_t)(event_6D_t.YHOverThreshold);
@@ -2803,11 +3024,11 @@ int8_t ITDS_getYHOverThresholdState(ITDS_state_t *YHOverThreshold)
 * @param  Pointer to the ZL Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getZLOverThresholdState(ITDS_state_t *ZLOverThreshold)
+int8_t ITDS_getZLOverThresholdState(we_dev_t *dev, ITDS_state_t *ZLOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*ZLOverThreshold = (ITDS_state_t)(event_6D_t.ZLOverThreshold);
@@ -2819,11 +3040,11 @@ int8_t ITDS_getZLOverThresholdState(ITDS_state_t *ZLOverThreshold)
 * @param  Pointer to the ZH Over Threshold State
 * @retval Error code
 */
-int8_t ITDS_getZHOverThresholdState(ITDS_state_t *ZHOverThreshold)
+int8_t ITDS_getZHOverThresholdState(we_dev_t *dev, ITDS_state_t *ZHOverThreshold)
 {
 	ITDS_event_6D_t event_6D_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_6D_EVENT_REG, 1, (uint8_t *)&event_6D_t))
 	return WE_FAIL;
 
 	*ZHOverThreshold = (ITDS_state_t)(event_6D_t.ZHOverThreshold);
@@ -2838,11 +3059,11 @@ int8_t ITDS_getZHOverThresholdState(ITDS_state_t *ZHOverThreshold)
 * @param  Pointer to the Sleep Change State
 * @retval Error code
 */
-int8_t ITDS_getSleepChangeState(ITDS_state_t *sleep)
+int8_t ITDS_getSleepChangeState(we_dev_t *dev, ITDS_state_t *sleep)
 {
 	ITDS_all_int_event_t all_int_event_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_ALL_INT_EVENT_REG, 1, (uint8_t *)&all_int_event_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_ALL_INT_EVENT_REG, 1, (uint8_t *)&all_int_event_t))
 	return WE_FAIL;
 
 	*sleep = (ITDS_state_t)(all_int_event_t.sleepState);
@@ -2856,11 +3077,11 @@ int8_t ITDS_getSleepChangeState(ITDS_state_t *sleep)
 * @param  the User offset on X axis state for wake-up
 * @retval Error code
 */
-int8_t ITDS_setOffsetValueOnXAxis(uint8_t offsetValueXAxis)
+int8_t ITDS_setOffsetValueOnXAxis(we_dev_t *dev, uint8_t offsetValueXAxis)
 {
 	uint8_t offsetValueOnXAxis = offsetValueXAxis;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_X_OFS_USR_REG, 1, &offsetValueOnXAxis))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_X_OFS_USR_REG, 1, &offsetValueOnXAxis))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2871,11 +3092,11 @@ int8_t ITDS_setOffsetValueOnXAxis(uint8_t offsetValueXAxis)
 * @param  Pointer to the User offset Value on X axis..
 * @retval Error code
 */
-int8_t ITDS_getOffsetValueOnXAxis(uint8_t *offsetvalueXAxis)
+int8_t ITDS_getOffsetValueOnXAxis(we_dev_t *dev, uint8_t *offsetvalueXAxis)
 {
 	uint8_t offsetValueOnXAxis;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_X_OFS_USR_REG, 1, &offsetValueOnXAxis))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_X_OFS_USR_REG, 1, &offsetValueOnXAxis))
 	return WE_FAIL;
 
 	*offsetvalueXAxis = (offsetValueOnXAxis);
@@ -2887,11 +3108,11 @@ int8_t ITDS_getOffsetValueOnXAxis(uint8_t *offsetvalueXAxis)
 * @param  ser offset on Y axis state for wake-up
 * @retval Error code
 */
-int8_t ITDS_setOffsetValueOnYAxis(uint8_t offsetValueYAxis)
+int8_t ITDS_setOffsetValueOnYAxis(we_dev_t *dev, uint8_t offsetValueYAxis)
 {
 	uint8_t offsetValueOnYAxis = offsetValueYAxis;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_Y_OFS_USR_REG, 1, &offsetValueOnYAxis))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_Y_OFS_USR_REG, 1, &offsetValueOnYAxis))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2902,11 +3123,11 @@ int8_t ITDS_setOffsetValueOnYAxis(uint8_t offsetValueYAxis)
 * @param  Pointer to the User offset Value on Y axis..
 * @retval Error code
 */
-int8_t ITDS_getOffsetValueOnYAxis(uint8_t *offsetValueYAxis)
+int8_t ITDS_getOffsetValueOnYAxis(we_dev_t *dev, uint8_t *offsetValueYAxis)
 {
 	uint8_t offsetValueOnYAxis;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_Y_OFS_USR_REG, 1, &offsetValueOnYAxis))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_Y_OFS_USR_REG, 1, &offsetValueOnYAxis))
 	return WE_FAIL;
 
 	*offsetValueYAxis = (offsetValueOnYAxis);
@@ -2918,11 +3139,11 @@ int8_t ITDS_getOffsetValueOnYAxis(uint8_t *offsetValueYAxis)
 * @param  the User offset on Z axis state for wake-up
 * @retval Error code
 */
-int8_t ITDS_setOffsetValueOnZAxis(uint8_t offsetvalueZAxis)
+int8_t ITDS_setOffsetValueOnZAxis(we_dev_t *dev, uint8_t offsetvalueZAxis)
 {
 	uint8_t offsetValueOnZAxis = offsetvalueZAxis;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_Z_OFS_USR_REG, 1, &offsetValueOnZAxis))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_Z_OFS_USR_REG, 1, &offsetValueOnZAxis))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2933,11 +3154,11 @@ int8_t ITDS_setOffsetValueOnZAxis(uint8_t offsetvalueZAxis)
 * @param  Pointer to the User offset Value on Z axis.
 * @retval Error code
 */
-int8_t ITDS_getOffsetValueOnZAxis(uint8_t *offsetValueZAxis)
+int8_t ITDS_getOffsetValueOnZAxis(we_dev_t *dev, uint8_t *offsetValueZAxis)
 {
 	uint8_t offsetValueOnZAxis;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_Z_OFS_USR_REG, 1, &offsetValueOnZAxis))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_Z_OFS_USR_REG, 1, &offsetValueOnZAxis))
 	return WE_FAIL;
 
 	*offsetValueZAxis = (offsetValueOnZAxis);
@@ -2953,16 +3174,16 @@ int8_t ITDS_getOffsetValueOnZAxis(uint8_t *offsetValueZAxis)
 * @param  Data Ready Interrupt Mode
 * @retval Error code
 */
-int8_t ITDS_setDrdyPulse(ITDS_drdy_pulse  drdyPulsed)
+int8_t ITDS_setDrdyPulse(we_dev_t *dev, ITDS_drdy_pulse  drdyPulsed)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.drdyPulse = drdyPulsed;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -2973,11 +3194,11 @@ int8_t ITDS_setDrdyPulse(ITDS_drdy_pulse  drdyPulsed)
 * @param  Pointer to Data Ready Interrupt Mode
 * @retval Error code
 */
-int8_t ITDS_getDrdyPulseIntMode(ITDS_drdy_pulse  *drdyPulsed)
+int8_t ITDS_getDrdyPulseIntMode(we_dev_t *dev, ITDS_drdy_pulse  *drdyPulsed)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*drdyPulsed = (ITDS_drdy_pulse)(ctrl_7_t.drdyPulse);
@@ -2989,16 +3210,16 @@ int8_t ITDS_getDrdyPulseIntMode(ITDS_drdy_pulse  *drdyPulsed)
 * @param  signal Routing Int1 On Int0 state
 * @retval Error code
 */
-int8_t ITDS_setInt1OnInt0(ITDS_state_t int1Onint0)
+int8_t ITDS_setInt1OnInt0(we_dev_t *dev, ITDS_state_t int1Onint0)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.INT1toINT0 = int1Onint0;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3009,11 +3230,11 @@ int8_t ITDS_setInt1OnInt0(ITDS_state_t int1Onint0)
 * @param  Pointer to Routing INT_1 On INT_0 State.
 * @retval Error code
 */
-int8_t ITDS_getInt1OnInt0(ITDS_state_t *int1Onint0)
+int8_t ITDS_getInt1OnInt0(we_dev_t *dev, ITDS_state_t *int1Onint0)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*int1Onint0 = (ITDS_state_t)(ctrl_7_t.INT1toINT0);
@@ -3025,16 +3246,16 @@ int8_t ITDS_getInt1OnInt0(ITDS_state_t *int1Onint0)
 * @param  interrupts state
 * @retval Error code
 */
-int8_t ITDS_enInterrups(ITDS_state_t interrupts)
+int8_t ITDS_enInterrups(we_dev_t *dev, ITDS_state_t interrupts)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.enInterrupts = interrupts;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3045,11 +3266,11 @@ int8_t ITDS_enInterrups(ITDS_state_t interrupts)
 * @param  Pointer to interrupts State .
 * @retval Error code
 */
-int8_t ITDS_getInterruptsState(ITDS_state_t *interrupts)
+int8_t ITDS_getInterruptsState(we_dev_t *dev, ITDS_state_t *interrupts)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*interrupts = (ITDS_state_t)(ctrl_7_t.enInterrupts);
@@ -3061,16 +3282,16 @@ int8_t ITDS_getInterruptsState(ITDS_state_t *interrupts)
 * @param  state
 * @retval Error code
 */
-int8_t ITDS_enApplyOffsetXL(ITDS_state_t offsetXLOutput)
+int8_t ITDS_enApplyOffsetXL(we_dev_t *dev, ITDS_state_t offsetXLOutput)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.applyOffsetXL = offsetXLOutput;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3081,11 +3302,11 @@ int8_t ITDS_enApplyOffsetXL(ITDS_state_t offsetXLOutput)
 * @param  Pointer to offset XL Output.
 * @retval Error code
 */
-int8_t ITDS_getApplyOffsetXL(ITDS_state_t *offsetXLOutput)
+int8_t ITDS_getApplyOffsetXL(we_dev_t *dev, ITDS_state_t *offsetXLOutput)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*offsetXLOutput = (ITDS_state_t)(ctrl_7_t.applyOffsetXL);
@@ -3097,16 +3318,16 @@ int8_t ITDS_getApplyOffsetXL(ITDS_state_t *offsetXLOutput)
 * @param  state
 * @retval Error code
 */
-int8_t ITDS_enApplyWakeUpOffsetXL(ITDS_state_t offsetXLWakeup)
+int8_t ITDS_enApplyWakeUpOffsetXL(we_dev_t *dev, ITDS_state_t offsetXLWakeup)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.applyWakeUpOffsetXL = offsetXLWakeup;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3117,11 +3338,11 @@ int8_t ITDS_enApplyWakeUpOffsetXL(ITDS_state_t offsetXLWakeup)
 * @param  Pointer to offset XL Wakeup.
 * @retval Error code
 */
-int8_t ITDS_getApplyWakeUpOffsetXL(ITDS_state_t *offsetXLWakeup)
+int8_t ITDS_getApplyWakeUpOffsetXL(we_dev_t *dev, ITDS_state_t *offsetXLWakeup)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*offsetXLWakeup = (ITDS_state_t)(ctrl_7_t.applyWakeUpOffsetXL);
@@ -3133,16 +3354,16 @@ int8_t ITDS_getApplyWakeUpOffsetXL(ITDS_state_t *offsetXLWakeup)
 * @param  offset Weight
 * @retval Error code
 */
-int8_t ITDS_setOffsetWeight(ITDS_state_t offsetWeight)
+int8_t ITDS_setOffsetWeight(we_dev_t *dev, ITDS_state_t offsetWeight)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.userOffset = offsetWeight;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3153,11 +3374,11 @@ int8_t ITDS_setOffsetWeight(ITDS_state_t offsetWeight)
 * @param  Pointer to offset Weight .
 * @retval Error code
 */
-int8_t ITDS_getOffsetWeight(ITDS_state_t *offsetWeight)
+int8_t ITDS_getOffsetWeight(we_dev_t *dev, ITDS_state_t *offsetWeight)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*offsetWeight = (ITDS_state_t)(ctrl_7_t.userOffset);
@@ -3169,16 +3390,16 @@ int8_t ITDS_getOffsetWeight(ITDS_state_t *offsetWeight)
 * @param  state
 * @retval Error code
 */
-int8_t ITDS_enHighPassRefMode(ITDS_state_t refMode)
+int8_t ITDS_enHighPassRefMode(we_dev_t *dev, ITDS_state_t refMode)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.highPassRefMode = refMode;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3189,11 +3410,11 @@ int8_t ITDS_enHighPassRefMode(ITDS_state_t refMode)
 * @param  Pointer to Reference Mode state
 * @retval Error code
 */
-int8_t ITDS_getHighPassRefMode(ITDS_state_t *refMode)
+int8_t ITDS_getHighPassRefMode(we_dev_t *dev, ITDS_state_t *refMode)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*refMode = (ITDS_state_t)(ctrl_7_t.highPassRefMode);
@@ -3205,16 +3426,16 @@ int8_t ITDS_getHighPassRefMode(ITDS_state_t *refMode)
 * @param  state
 * @retval Error code
 */
-int8_t ITDS_enLowPassOn6D(ITDS_state_t LPassOn6D)
+int8_t ITDS_enLowPassOn6D(we_dev_t *dev, ITDS_state_t LPassOn6D)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	ctrl_7_t.lowPassOn6D = LPassOn6D;
 
-	if (WE_FAIL == WriteReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -3225,13 +3446,328 @@ int8_t ITDS_enLowPassOn6D(ITDS_state_t LPassOn6D)
 * @param  Pointer to Low Pass On 6D state.
 * @retval Error code
 */
-int8_t ITDS_getLowPassOn6DState(ITDS_state_t *LPassOn6D)
+int8_t ITDS_getLowPassOn6DState(we_dev_t *dev, ITDS_state_t *LPassOn6D)
 {
 	ITDS_ctrl_7_t ctrl_7_t;
 
-	if (WE_FAIL == ReadReg((uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)ITDS_CTRL_7_REG, 1, (uint8_t *)&ctrl_7_t))
 	return WE_FAIL;
 
 	*LPassOn6D = (ITDS_state_t)(ctrl_7_t.lowPassOn6D);
 	return WE_SUCCESS;
 }
+
+/* Configuration */
+
+/**
+* @brief  Read CTRL_1 .. CTRL_6 and FIFO_CTRL in a single batch (one byte per register, independent of IF_ADD_INC)
+* @param  Pointer to the control register images
+* @param  Pointer to the FIFO control register image
+* @retval Error code
+*/
+static int8_t ITDS_readCtrlBlock(we_dev_t *dev, ITDS_ctrl_block_t *ctrl, ITDS_fifo_ctrl_t *fifoCtrl)
+{
+	we_reg_read_t reads[7];
+	int i;
+
+	for (i = 0; i < 6; i++)
+	{
+		reads[i].RegAdr = (uint8_t)(ITDS_CTRL_1_REG + i);
+		reads[i].NumByteToRead = 1;
+		reads[i].Data = (uint8_t *)ctrl + i;
+	}
+	reads[6].RegAdr = ITDS_FIFO_CTRL_REG;
+	reads[6].NumByteToRead = 1;
+	reads[6].Data = (uint8_t *)fifoCtrl;
+
+	return ReadRegBatch(dev, reads, 7);
+}
+
+/**
+* @brief  Apply a complete configuration, the bus lock is held by the caller
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+static int8_t ITDS_writeConfig(we_dev_t *dev, const ITDS_config_t *config)
+{
+	ITDS_ctrl_block_t current, target;
+	ITDS_fifo_ctrl_t fifoCurrent, fifoTarget;
+	bool burst;
+
+	if (WE_FAIL == ITDS_readCtrlBlock(dev, &current, &fifoCurrent))
+	return WE_FAIL;
+
+	target = current;
+	fifoTarget = fifoCurrent;
+
+	/* never re-trigger self-clearing functions */
+	target.ctrl2.softReset = 0;
+	target.ctrl2.boot = 0;
+	target.ctrl3.enSingleDataConv = 0;
+
+	target.ctrl1.outputDataRate = config->outputDataRate;
+	target.ctrl1.operatingMode = config->operatingMode;
+	target.ctrl1.powerMode = config->powerMode;
+	target.ctrl2.blockDataUpdate = config->blockDataUpdate;
+	target.ctrl2.autoAddIncr = config->autoIncrement;
+	target.ctrl6.fullScale = config->fullScale;
+	target.ctrl6.filterBandwidth = config->filteringCutoff;
+	target.ctrl6.filterPath = config->filterPath;
+	target.ctrl6.enLowNoise = config->lowNoise;
+	fifoTarget.fifoMode = config->fifoMode;
+	fifoTarget.fifoThresholdLevel = config->fifoThreshold;
+
+	/* a burst needs the address auto increment before and after the write */
+	burst = current.ctrl2.autoAddIncr && target.ctrl2.autoAddIncr;
+
+	if (WE_FAIL == WriteRegDiff(dev, ITDS_CTRL_1_REG, sizeof(ITDS_ctrl_block_t), (uint8_t *)&current, (uint8_t *)&target, burst))
+	return WE_FAIL;
+
+	if (WE_FAIL == WriteRegDiff(dev, ITDS_FIFO_CTRL_REG, 1, (uint8_t *)&fifoCurrent, (uint8_t *)&fifoTarget, false))
+	return WE_FAIL;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Apply a complete configuration
+*         The final register images are computed first; only the registers that change are written,
+*         CTRL_1 .. CTRL_6 in one burst and FIFO_CTRL in a second write.
+*         Runs as one bus transaction, no other thread can access the bus between reading the current
+*         and writing the new register images.
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+int8_t ITDS_applyConfig(we_dev_t *dev, const ITDS_config_t *config)
+{
+	int8_t ret;
+
+	BusLock(dev->bus);
+	ret = ITDS_writeConfig(dev, config);
+	BusUnlock(dev->bus);
+
+	return ret;
+}
+
+/**
+* @brief  Read the current configuration in a single batch
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+int8_t ITDS_readConfig(we_dev_t *dev, ITDS_config_t *config)
+{
+	ITDS_ctrl_block_t ctrl;
+	ITDS_fifo_ctrl_t fifoCtrl;
+
+	if (WE_FAIL == ITDS_readCtrlBlock(dev, &ctrl, &fifoCtrl))
+	return WE_FAIL;
+
+	config->outputDataRate = (ITDS_output_Data_Rate)ctrl.ctrl1.outputDataRate;
+	config->operatingMode = (ITDS_operating_mode)ctrl.ctrl1.operatingMode;
+	config->powerMode = (ITDS_power_mode)ctrl.ctrl1.powerMode;
+	config->blockDataUpdate = (ITDS_state_t)ctrl.ctrl2.blockDataUpdate;
+	config->autoIncrement = (ITDS_state_t)ctrl.ctrl2.autoAddIncr;
+	config->fullScale = (ITDS_full_Scale)ctrl.ctrl6.fullScale;
+	config->filteringCutoff = (ITDS_bandwidth)ctrl.ctrl6.filterBandwidth;
+	config->filterPath = (ITDS_filter_Type)ctrl.ctrl6.filterPath;
+	config->lowNoise = (ITDS_state_t)ctrl.ctrl6.enLowNoise;
+	config->fifoMode = (ITDS_Fifo_Mode)fifoCtrl.fifoMode;
+	config->fifoThreshold = fifoCtrl.fifoThresholdLevel;
+
+	return WE_SUCCESS;
+}
+
+/* Conversion to physical units */
+
+/**
+* @brief  Resolve the conversion of raw samples to mg for an operating mode and full scale
+*         Sensitivity (datasheet): 0.244 mg/digit at 14 bit, 0.976 mg/digit at 12 bit (low power), for +-2g;
+*         doubling with every full scale step. Does not access the sensor.
+* @param  Pointer to the conversion
+* @param  Operating mode (CTRL_1 MODE)
+* @param  Power mode (CTRL_1 LP_MODE), selects 12 bit low power resolution in normal and single conversion mode
+* @param  Full scale (CTRL_6 FS)
+* @retval Error code
+*/
+int8_t ITDS_initConversion(ITDS_conversion_t *conversion, ITDS_operating_mode operatingMode, ITDS_power_mode powerMode, ITDS_full_Scale fullScale)
+{
+	bool lowPowerResolution;
+
+	if ((operatingMode > singleConvertion) || (fullScale > sixteenG))
+	return WE_FAIL;
+
+	lowPowerResolution = (operatingMode != highPerformance) && (powerMode == lowPower);
+
+	conversion->operatingMode = operatingMode;
+	conversion->powerMode = powerMode;
+	conversion->fullScale = fullScale;
+	conversion->shift = lowPowerResolution ? 4 : 2;
+	conversion->mgPerDigit = (lowPowerResolution ? 0.976f : 0.244f) * (float)(1 << fullScale);
+	conversion->mgPerDigitQ16 = (int32_t)(conversion->mgPerDigit * 65536.0f + 0.5f);
+	conversion->ugPerDigit = (lowPowerResolution ? 976 : 244) << fullScale;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Resolve the conversion for the active configuration
+*         CTRL_1 and CTRL_6 are read in one batch, served from the register cache if it is enabled.
+*         Call again after the operating mode or full scale has been changed.
+* @param  Pointer to the conversion
+* @retval Error code
+*/
+int8_t ITDS_readConversion(we_dev_t *dev, ITDS_conversion_t *conversion)
+{
+	ITDS_ctrl_1_t ctrl_reg_1;
+	ITDS_ctrl_6_t ctrl_reg_6;
+	we_reg_read_t reads[2] = {
+		{ ITDS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1 },
+		{ ITDS_CTRL_6_REG, 1, (uint8_t *)&ctrl_reg_6 }
+	};
+
+	if (WE_FAIL == ReadRegBatch(dev, reads, 2))
+	return WE_FAIL;
+
+	return ITDS_initConversion(conversion, (ITDS_operating_mode)ctrl_reg_1.operatingMode,
+		(ITDS_power_mode)ctrl_reg_1.powerMode, (ITDS_full_Scale)ctrl_reg_6.fullScale);
+}
+
+/**
+* @brief  Convert one raw axis value to mg
+* @param  Pointer to the conversion
+* @param  Raw acceleration as read from the output registers
+* @retval Acceleration in mg
+*/
+float ITDS_convertToMg(const ITDS_conversion_t *conversion, int16_t rawAcc)
+{
+	return (float)(rawAcc >> conversion->shift) * conversion->mgPerDigit;
+}
+
+/**
+* @brief  Convert one raw axis value to mg, fixed point
+* @param  Pointer to the conversion
+* @param  Raw acceleration as read from the output registers
+* @retval Acceleration in mg, Q16.16
+*/
+int32_t ITDS_convertToMgQ16(const ITDS_conversion_t *conversion, int16_t rawAcc)
+{
+	/* |raw >> 2| <= 8192 and sensitivity < 2^17 (Q16), the product fits 32 bit */
+	return (int32_t)(rawAcc >> conversion->shift) * conversion->mgPerDigitQ16;
+}
+
+/**
+* @brief  Convert a buffer of raw XYZ samples to mg
+*         The samples are converted as one flat array of 3 * count axis values by the SIMD kernel
+*         of the platform (ConvertInt16ToFloat()).
+* @param  Pointer to the conversion
+* @param  Raw samples, e.g. from ITDS_readFifo()
+* @param  Converted samples
+* @param  Number of samples
+* @retval None
+*/
+void ITDS_convertXYZToMg(const ITDS_conversion_t *conversion, const ITDS_raw_acceleration_t *rawAcc, ITDS_acceleration_t *acc, int count)
+{
+	/* both sample types consist of three members of one type only, i.e. have no padding */
+	ConvertInt16ToFloat(&rawAcc->x, &acc->x, 3 * count, conversion->shift, conversion->mgPerDigit, 0.0f);
+}
+
+/**
+* @brief  Convert a buffer of raw XYZ samples to mg, fixed point
+* @param  Pointer to the conversion
+* @param  Raw samples, e.g. from ITDS_readFifo()
+* @param  Converted samples, Q16.16
+* @param  Number of samples
+* @retval None
+*/
+void ITDS_convertXYZToMgQ16(const ITDS_conversion_t *conversion, const ITDS_raw_acceleration_t *rawAcc, ITDS_acceleration_q16_t *acc, int count)
+{
+	const uint8_t shift = conversion->shift;
+	const int32_t scale = conversion->mgPerDigitQ16;
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		acc[i].x = (int32_t)(rawAcc[i].x >> shift) * scale;
+		acc[i].y = (int32_t)(rawAcc[i].y >> shift) * scale;
+		acc[i].z = (int32_t)(rawAcc[i].z >> shift) * scale;
+	}
+}
+
+/**
+* @brief  Convert one raw axis value to whole mg, integer arithmetic only
+* @param  Pointer to the conversion
+* @param  Raw acceleration as read from the output registers
+* @retval Acceleration in mg, rounded
+*/
+int32_t ITDS_convertToMgInt(const ITDS_conversion_t *conversion, int16_t rawAcc)
+{
+	/* |raw >> 2| <= 8192 and sensitivity <= 15616 µg, the product fits 32 bit */
+	int32_t ug = (int32_t)(rawAcc >> conversion->shift) * conversion->ugPerDigit;
+
+	return WE_DIV_ROUND(ug, 1000);
+}
+
+/**
+* @brief  Convert a buffer of raw XYZ samples to whole mg, integer arithmetic only
+* @param  Pointer to the conversion
+* @param  Raw samples, e.g. from ITDS_readFifo()
+* @param  Converted samples
+* @param  Number of samples
+* @retval None
+*/
+void ITDS_convertXYZToMgInt(const ITDS_conversion_t *conversion, const ITDS_raw_acceleration_t *rawAcc, ITDS_acceleration_mg_t *acc, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		acc[i].x = ITDS_convertToMgInt(conversion, rawAcc[i].x);
+		acc[i].y = ITDS_convertToMgInt(conversion, rawAcc[i].y);
+		acc[i].z = ITDS_convertToMgInt(conversion, rawAcc[i].z);
+	}
+}
+
+/* Interrupt driven acquisition */
+
+/**
+* @brief  Wait for new acceleration data
+*         Sleeps on the interrupt line the data-ready signal is routed to (ITDS_enDataReadyINT0() or
+*         ITDS_enDataReadyINT1(), and ITDS_enInterrups()); the bus is only accessed if no edge arrives
+*         within the timeout. Without an interrupt line (NULL) the status is polled once per ms.
+* @param  Interrupt line connected to INT_0 or INT_1, or NULL
+* @param  Maximum time to wait in ms, -1: no timeout
+* @param  Pointer to data-ready state, ITDS_disable on timeout
+* @retval Error code
+*/
+int8_t ITDS_waitForDataReady(we_dev_t *dev, we_int_line_t *intLine, int timeoutMs, ITDS_state_t *drdy)
+{
+	bool fired;
+	int elapsedMs = 0;
+
+	if (intLine == NULL)
+	{
+		while (1)
+		{
+			if (WE_FAIL == ITDS_getdataReadyState(dev, drdy))
+			return WE_FAIL;
+
+			if ((*drdy == ITDS_enable) || ((timeoutMs >= 0) && (elapsedMs >= timeoutMs)))
+			return WE_SUCCESS;
+
+			BusDelay(dev->bus, 1);
+			elapsedMs++;
+		}
+	}
+
+	if (WE_FAIL == IntLineWait(intLine, timeoutMs, &fired))
+	return WE_FAIL;
+
+	if (fired)
+	{
+		*drdy = ITDS_enable;
+		return WE_SUCCESS;
+	}
+
+	/* a latched data-ready signal that was already active when waiting started does not produce an edge */
+	return ITDS_getdataReadyState(dev, drdy);
+}
@@ -29,12 +29,16 @@
 
 #include <stdint.h>
 #include "platform.h"
+#include "platform_timestamp.h"
 
 
 
 #define ITDS_DEVICE_ID_VALUE              0x44 /* this is the expected answer when requesting the ITDS_DEVICE_ID_REG */
 #define ITDS_ADDRESS_I2C_0                0x18			/* when SAO of ITDS is connected to logic HIGH level */
 #define ITDS_ADDRESS_I2C_1                0x19			/* when SAO of ITDS is connected to logic LOW level */
+#define ITDS_FIFO_DEPTH                   32            /* XYZ samples stored in the FIFO */
+
+/* Multi-byte (burst) accesses on I2C and SPI rely on the IF_ADD_INC bit, see ITDS_setAutoIncrement(). No address bit is required (we_dev_t.multiByteMask = 0). */
 
 
 /** Register address definitions **/
@@ -624,6 +628,84 @@ typedef enum {
 	pulsed = 1
 }ITDS_drdy_pulse;
 
+/**
+* Sensor configuration applied with ITDS_applyConfig() and read with ITDS_readConfig()
+* Covers CTRL_1, CTRL_2, CTRL_6 and FIFO_CTRL. Registers not covered keep their current content.
+*/
+typedef struct {
+	ITDS_output_Data_Rate outputDataRate;   /* CTRL_1 ODR[3:0] */
+	ITDS_operating_mode operatingMode;      /* CTRL_1 MODE[1:0] */
+	ITDS_power_mode powerMode;              /* CTRL_1 LP_MODE */
+	ITDS_state_t blockDataUpdate;           /* CTRL_2 BDU */
+	ITDS_state_t autoIncrement;             /* CTRL_2 IF_ADD_INC */
+	ITDS_full_Scale fullScale;              /* CTRL_6 FS[1:0] */
+	ITDS_bandwidth filteringCutoff;         /* CTRL_6 BW_FILT[1:0] */
+	ITDS_filter_Type filterPath;            /* CTRL_6 FDS */
+	ITDS_state_t lowNoise;                  /* CTRL_6 LOW_NOISE */
+	ITDS_Fifo_Mode fifoMode;                /* FIFO_CTRL FMODE[2:0] */
+	uint8_t fifoThreshold;                  /* FIFO_CTRL FTH[4:0] */
+}ITDS_config_t;
+
+/**
+* Raw acceleration of all three axes, one output data cycle
+* Left aligned 16 bit values as read from X_OUT_L .. Z_OUT_H.
+*/
+typedef struct {
+	int16_t x;
+	int16_t y;
+	int16_t z;
+}ITDS_raw_acceleration_t;
+
+/**
+* Raw acceleration with the CLOCK_MONOTONIC time it was sampled at, see ITDS_readFifoTimestamped()
+*/
+typedef struct {
+	uint64_t timestampNs;
+	ITDS_raw_acceleration_t raw;
+}ITDS_sample_t;
+
+/**
+* Acceleration of all three axes in mg
+*/
+typedef struct {
+	float x;
+	float y;
+	float z;
+}ITDS_acceleration_t;
+
+/**
+* Acceleration of all three axes in mg, fixed point Q16.16 (value / 65536 = mg)
+*/
+typedef struct {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+}ITDS_acceleration_q16_t;
+
+/**
+* Acceleration of all three axes in whole mg
+*/
+typedef struct {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+}ITDS_acceleration_mg_t;
+
+/**
+* Conversion of raw samples to mg for one operating mode and full scale, see ITDS_initConversion()
+* The resolution (12 bit in low power mode, 14 bit otherwise) and the sensitivity are resolved once,
+* converting a sample is a shift and a multiplication.
+*/
+typedef struct {
+	ITDS_operating_mode operatingMode;
+	ITDS_power_mode powerMode;
+	ITDS_full_Scale fullScale;
+	uint8_t shift;                          /* right shift of the left aligned raw value: 4 (12 bit) or 2 (14 bit) */
+	float mgPerDigit;                       /* sensitivity in mg/digit after the shift */
+	int32_t mgPerDigitQ16;                  /* sensitivity in mg/digit, Q16.16 */
+	int32_t ugPerDigit;                     /* sensitivity in µg/digit (exact) */
+}ITDS_conversion_t;
+
 
 
 #ifdef __cplusplus
@@ -635,238 +717,270 @@ extern "C"
 	/* Functions definition */
 	/* **********************/
 
+	/* all functions take the device context opened with DeviceInit() as first argument */
+
 	/* DEVICE_ID */
-	int8_t  ITDS_getDeviceID(uint8_t *device_id) ;
+	int8_t  ITDS_getDeviceID(we_dev_t *dev, uint8_t *device_id) ;
+
+	/* Register shadow cache (optional) */
+	int8_t  ITDS_enableRegisterCache(we_dev_t *dev, we_reg_cache_t *cache);
+
+	/* Complete configuration in one batched read and at most two burst writes */
+	int8_t  ITDS_applyConfig(we_dev_t *dev, const ITDS_config_t *config);
+	int8_t  ITDS_readConfig(we_dev_t *dev, ITDS_config_t *config);
+
+	/* Interrupt driven acquisition: sleep on the GPIO connected to INT_0/INT_1 instead of polling STATUS */
+	int8_t  ITDS_waitForDataReady(we_dev_t *dev, we_int_line_t *intLine, int timeoutMs, ITDS_state_t *drdy);
 
 	/* CTRL-REG 1 */
-	int8_t  ITDS_setOutputDataRate(ITDS_output_Data_Rate odr);
-	int8_t  ITDS_getOutputDataRate(uint8_t *odr) ;
-	int8_t  ITDS_setOperatingMode(ITDS_operating_mode operatingMode);
-	int8_t  ITDS_getOperatingMode(uint8_t *opMode);
-	int8_t  ITDS_setpowerMode(ITDS_power_mode lowOrNormalMode);
-	int8_t  ITDS_getpowerMode(uint8_t *powerMode);
+	int8_t  ITDS_setOutputDataRate(we_dev_t *dev, ITDS_output_Data_Rate odr);
+	int8_t  ITDS_getOutputDataRate(we_dev_t *dev, uint8_t *odr) ;
+	int8_t  ITDS_setOperatingMode(we_dev_t *dev, ITDS_operating_mode operatingMode);
+	int8_t  ITDS_getOperatingMode(we_dev_t *dev, uint8_t *opMode);
+	int8_t  ITDS_setpowerMode(we_dev_t *dev, ITDS_power_mode lowOrNormalMode);
+	int8_t  ITDS_getpowerMode(we_dev_t *dev, uint8_t *powerMode);
 
 	/* CTRL-REG 2 */
-	int8_t  ITDS_reboot(ITDS_state_t rebootmode);
-	int8_t  ITDS_getBootState(ITDS_state_t *boot);
-	int8_t  ITDS_softReset(ITDS_state_t Swreset_mode);
-	int8_t  ITDS_getsoftResetState(ITDS_state_t *swReset );
-	int8_t  ITDS_ConfigCSPullup(ITDS_state_t CSPullup);
-	int8_t  ITDS_getCSConfigState(ITDS_state_t *configCS);
-	int8_t  ITDS_setBlockDataUpdate(ITDS_state_t bdu);
-	int8_t  ITDS_getBlockDataUpdateState(ITDS_state_t *bdu);
-	int8_t  ITDS_setAutoIncrement(ITDS_state_t autoInc);
-	int8_t  ITDS_getAutoIncrementState(ITDS_state_t *autoIncr);
-	int8_t  ITDS_disableI2CInterface(ITDS_state_t I2CStatus);
-	int8_t  ITDS_getI2CInterfaceState(ITDS_state_t *i2cState);
+	int8_t  ITDS_reboot(we_dev_t *dev, ITDS_state_t rebootmode);
+	int8_t  ITDS_getBootState(we_dev_t *dev, ITDS_state_t *boot);
+	int8_t  ITDS_softReset(we_dev_t *dev, ITDS_state_t Swreset_mode);
+	int8_t  ITDS_getsoftResetState(we_dev_t *dev, ITDS_state_t *swReset );
+	int8_t  ITDS_ConfigCSPullup(we_dev_t *dev, ITDS_state_t CSPullup);
+	int8_t  ITDS_getCSConfigState(we_dev_t *dev, ITDS_state_t *configCS);
+	int8_t  ITDS_setBlockDataUpdate(we_dev_t *dev, ITDS_state_t bdu);
+	int8_t  ITDS_getBlockDataUpdateState(we_dev_t *dev, ITDS_state_t *bdu);
+	int8_t  ITDS_setAutoIncrement(we_dev_t *dev, ITDS_state_t autoInc);
+	int8_t  ITDS_getAutoIncrementState(we_dev_t *dev, ITDS_state_t *autoIncr);
+	int8_t  ITDS_disableI2CInterface(we_dev_t *dev, ITDS_state_t I2CStatus);
+	int8_t  ITDS_getI2CInterfaceState(we_dev_t *dev, ITDS_state_t *i2cState);
 
 	/* CTRL-REG 3 */
-	int8_t  ITDS_setSelfTestMode(ITDS_self_Test_Config selfTest);
-	int8_t  ITDS_getSelfTestMode(ITDS_state_t *selfTest);
-	int8_t  ITDS_setIntPinType(ITDS_interrupt_Pin_Config interruptType);
-	int8_t  ITDS_getIntPinType(ITDS_state_t *intType);
-	int8_t  ITDS_enLatchInt(ITDS_state_t lir);
-	int8_t  ITDS_getLatchIntState(ITDS_state_t *lir);
-	int8_t  ITDS_setIntActiveLevel(ITDS_interrupt_Active_Level lowHighLevel);
-	int8_t  ITDS_getIntActiveLevel(ITDS_interrupt_Active_Level *lowHighLevel);
-	int8_t  ITDS_setSingleConvInput(ITDS_singleDataConversion_Input slpModeSel);
-	int8_t  ITDS_getSingleConvInput(ITDS_singleDataConversion_Input *slpModeSel);
-	int8_t  ITDS_enSingleDataConv(ITDS_state_t slpMode1);
-	int8_t  ITDS_getSingleDataConvState(ITDS_state_t *slpMode1) ;
+	int8_t  ITDS_setSelfTestMode(we_dev_t *dev, ITDS_self_Test_Config selfTest);
+	int8_t  ITDS_getSelfTestMode(we_dev_t *dev, ITDS_state_t *selfTest);
+	int8_t  ITDS_setIntPinType(we_dev_t *dev, ITDS_interrupt_Pin_Config interruptType);
+	int8_t  ITDS_getIntPinType(we_dev_t *dev, ITDS_state_t *intType);
+	int8_t  ITDS_enLatchInt(we_dev_t *dev, ITDS_state_t lir);
+	int8_t  ITDS_getLatchIntState(we_dev_t *dev, ITDS_state_t *lir);
+	int8_t  ITDS_setIntActiveLevel(we_dev_t *dev, ITDS_interrupt_Active_Level lowHighLevel);
+	int8_t  ITDS_getIntActiveLevel(we_dev_t *dev, ITDS_interrupt_Active_Level *lowHighLevel);
+	int8_t  ITDS_setSingleConvInput(we_dev_t *dev, ITDS_singleDataConversion_Input slpModeSel);
+	int8_t  ITDS_getSingleConvInput(we_dev_t *dev, ITDS_singleDataConversion_Input *slpModeSel);
+	int8_t  ITDS_enSingleDataConv(we_dev_t *dev, ITDS_state_t slpMode1);
+	int8_t  ITDS_getSingleDataConvState(we_dev_t *dev, ITDS_state_t *slpMode1) ;
 
 	/* CTRL-REG 4 */
-	int8_t  ITDS_set6DOnINT0(ITDS_state_t int06D);
-	int8_t  ITDS_get6DOnINT0State(ITDS_state_t *int06D);
-	int8_t  ITDS_enSingleTapINT0(ITDS_state_t int0SingleTap);
-	int8_t  ITDS_getSingleTapINT0(ITDS_state_t *int0SingleTap);
-	int8_t  ITDS_enWakeupOnINT0(ITDS_state_t int0Wakeup);
-	int8_t  ITDS_getWakeupOnINT0(ITDS_state_t *int0Wakeup);
-	int8_t  ITDS_enFreeFallINT0(ITDS_state_t int0FreeFall);
-	int8_t  ITDS_getFreeFallINT0(ITDS_state_t *int0FreeFall);
-	int8_t  ITDS_enDoubleTapINT0(ITDS_state_t int0DoubleTap);
-	int8_t  ITDS_getDoubleTapINT0(ITDS_state_t *int0DoubleTap);
-	int8_t  ITDS_enFifoFullINT0(ITDS_state_t int0FifoFull);
-	int8_t  ITDS_getFifoFullINT0(ITDS_state_t *int0FifoFull);
-	int8_t  ITDS_enFifoThresholdINT0(ITDS_state_t int0FifoThresholdInt);
-	int8_t  ITDS_getFifoThresholdINT0(ITDS_state_t *int0FifoThresholdInt);
-	int8_t  ITDS_enDataReadyINT0(ITDS_state_t int0DataReadyInt);
-	int8_t  ITDS_getDataReadyINT0(ITDS_state_t *int0DataReadyInt);
+	int8_t  ITDS_set6DOnINT0(we_dev_t *dev, ITDS_state_t int06D);
+	int8_t  ITDS_get6DOnINT0State(we_dev_t *dev, ITDS_state_t *int06D);
+	int8_t  ITDS_enSingleTapINT0(we_dev_t *dev, ITDS_state_t int0SingleTap);
+	int8_t  ITDS_getSingleTapINT0(we_dev_t *dev, ITDS_state_t *int0SingleTap);
+	int8_t  ITDS_enWakeupOnINT0(we_dev_t *dev, ITDS_state_t int0Wakeup);
+	int8_t  ITDS_getWakeupOnINT0(we_dev_t *dev, ITDS_state_t *int0Wakeup);
+	int8_t  ITDS_enFreeFallINT0(we_dev_t *dev, ITDS_state_t int0FreeFall);
+	int8_t  ITDS_getFreeFallINT0(we_dev_t *dev, ITDS_state_t *int0FreeFall);
+	int8_t  ITDS_enDoubleTapINT0(we_dev_t *dev, ITDS_state_t int0DoubleTap);
+	int8_t  ITDS_getDoubleTapINT0(we_dev_t *dev, ITDS_state_t *int0DoubleTap);
+	int8_t  ITDS_enFifoFullINT0(we_dev_t *dev, ITDS_state_t int0FifoFull);
+	int8_t  ITDS_getFifoFullINT0(we_dev_t *dev, ITDS_state_t *int0FifoFull);
+	int8_t  ITDS_enFifoThresholdINT0(we_dev_t *dev, ITDS_state_t int0FifoThresholdInt);
+	int8_t  ITDS_getFifoThresholdINT0(we_dev_t *dev, ITDS_state_t *int0FifoThresholdInt);
+	int8_t  ITDS_enDataReadyINT0(we_dev_t *dev, ITDS_state_t int0DataReadyInt);
+	int8_t  ITDS_getDataReadyINT0(we_dev_t *dev, ITDS_state_t *int0DataReadyInt);
 
 	/* CTRL-REG 5 */
-	int8_t  ITDS_enInactivityINT1(ITDS_state_t intSleepState);
-	int8_t  ITDS_getInactivityINT1(ITDS_state_t *intSleepState);
-	int8_t  ITDS_enActivityINT1(ITDS_state_t int1SleepChange);
-	int8_t  ITDS_getActivityINT1(ITDS_state_t *int1SleepChange);
-	int8_t  ITDS_enBootStatusINT1(ITDS_state_t int1Boot);
-	int8_t  ITDS_getBootStatusINT1(ITDS_state_t *int1Boot);
-	int8_t  ITDS_enTempDataReadyINT1(ITDS_state_t int1TempDataReady);
-	int8_t  ITDS_getTempDataReadyINT1(ITDS_state_t *int1TempDataReady);
-	int8_t  ITDS_enFifoOverrunIntINT1(ITDS_state_t int1FifoOverrun);
-	int8_t  ITDS_getFifoOverrunIntINT1(ITDS_state_t *int1FifoOverrun);
-	int8_t  ITDS_enFifoFullINT1(ITDS_state_t int1FifoFull);
-	int8_t  ITDS_getFifoFullINT1(ITDS_state_t *int1FifoFull);
-	int8_t  ITDS_enFifoThresholdIntINT1(ITDS_state_t int1FifoThresholdInt);
-	int8_t  ITDS_getFifoThresholdINT1(ITDS_state_t *int1FifoThresholdInt);
-	int8_t  ITDS_enDataReadyINT1(ITDS_state_t int1DataReadyInt);
-	int8_t  ITDS_getDataReadyINT1(ITDS_state_t *int1DataReadyInt);
+	int8_t  ITDS_enInactivityINT1(we_dev_t *dev, ITDS_state_t intSleepState);
+	int8_t  ITDS_getInactivityINT1(we_dev_t *dev, ITDS_state_t *intSleepState);
+	int8_t  ITDS_enActivityINT1(we_dev_t *dev, ITDS_state_t int1SleepChange);
+	int8_t  ITDS_getActivityINT1(we_dev_t *dev, ITDS_state_t *int1SleepChange);
+	int8_t  ITDS_enBootStatusINT1(we_dev_t *dev, ITDS_state_t int1Boot);
+	int8_t  ITDS_getBootStatusINT1(we_dev_t *dev, ITDS_state_t *int1Boot);
+	int8_t  ITDS_enTempDataReadyINT1(we_dev_t *dev, ITDS_state_t int1TempDataReady);
+	int8_t  ITDS_getTempDataReadyINT1(we_dev_t *dev, ITDS_state_t *int1TempDataReady);
+	int8_t  ITDS_enFifoOverrunIntINT1(we_dev_t *dev, ITDS_state_t int1FifoOverrun);
+	int8_t  ITDS_getFifoOverrunIntINT1(we_dev_t *dev, ITDS_state_t *int1FifoOverrun);
+	int8_t  ITDS_enFifoFullINT1(we_dev_t *dev, ITDS_state_t int1FifoFull);
+	int8_t  ITDS_getFifoFullINT1(we_dev_t *dev, ITDS_state_t *int1FifoFull);
+	int8_t  ITDS_enFifoThresholdIntINT1(we_dev_t *dev, ITDS_state_t int1FifoThresholdInt);
+	int8_t  ITDS_getFifoThresholdINT1(we_dev_t *dev, ITDS_state_t *int1FifoThresholdInt);
+	int8_t  ITDS_enDataReadyINT1(we_dev_t *dev, ITDS_state_t int1DataReadyInt);
+	int8_t  ITDS_getDataReadyINT1(we_dev_t *dev, ITDS_state_t *int1DataReadyInt);
 
 	/* CTRL-REG 6 */
-	int8_t  ITDS_setFilteringCutoff(ITDS_bandwidth filteringCutoff);
-	int8_t  ITDS_getFilteringCutoff(ITDS_bandwidth *filteringCutoff);
-	int8_t  ITDS_setFullScale(ITDS_full_Scale fullScale_t);
-	int8_t  ITDS_getFullScale(ITDS_full_Scale *fullScale_t);
-	int8_t  ITDS_setfilterPath(ITDS_filter_Type filterType);
-	int8_t  ITDS_getfilterPath(ITDS_filter_Type *filterType);
-	int8_t  ITDS_enLowNoise(ITDS_state_t lowNoise);
-	int8_t  ITDS_getLowNoiseState(ITDS_state_t *lowNoise);
+	int8_t  ITDS_setFilteringCutoff(we_dev_t *dev, ITDS_bandwidth filteringCutoff);
+	int8_t  ITDS_getFilteringCutoff(we_dev_t *dev, ITDS_bandwidth *filteringCutoff);
+	int8_t  ITDS_setFullScale(we_dev_t *dev, ITDS_full_Scale fullScale_t);
+	int8_t  ITDS_getFullScale(we_dev_t *dev, ITDS_full_Scale *fullScale_t);
+	int8_t  ITDS_setfilterPath(we_dev_t *dev, ITDS_filter_Type filterType);
+	int8_t  ITDS_getfilterPath(we_dev_t *dev, ITDS_filter_Type *filterType);
+	int8_t  ITDS_enLowNoise(we_dev_t *dev, ITDS_state_t lowNoise);
+	int8_t  ITDS_getLowNoiseState(we_dev_t *dev, ITDS_state_t *lowNoise);
 
 	/* Status */
-	int8_t  ITDS_getdataReadyState(ITDS_state_t *drdy);
-	int8_t  ITDS_getfreeFallState(ITDS_state_t *freeFall);
-	int8_t  ITDS_get6DState(ITDS_state_t *sixD);
-	int8_t  ITDS_getsingleTapState(ITDS_state_t *singleTap);
-	int8_t  ITDS_getdoubleTapState(ITDS_state_t *doubleTap);
-	int8_t  ITDS_getsleepState(ITDS_state_t *sleepState );
-	int8_t  ITDS_getwakeupState(ITDS_state_t *wakeupState );
-	int8_t  ITDS_getFifoThresholdStatus(ITDS_state_t *fifoTHR);
+	int8_t  ITDS_getdataReadyState(we_dev_t *dev, ITDS_state_t *drdy);
+	int8_t  ITDS_getfreeFallState(we_dev_t *dev, ITDS_state_t *freeFall);
+	int8_t  ITDS_get6DState(we_dev_t *dev, ITDS_state_t *sixD);
+	int8_t  ITDS_getsingleTapState(we_dev_t *dev, ITDS_state_t *singleTap);
+	int8_t  ITDS_getdoubleTapState(we_dev_t *dev, ITDS_state_t *doubleTap);
+	int8_t  ITDS_getsleepState(we_dev_t *dev, ITDS_state_t *sleepState );
+	int8_t  ITDS_getwakeupState(we_dev_t *dev, ITDS_state_t *wakeupState );
+	int8_t  ITDS_getFifoThresholdStatus(we_dev_t *dev, ITDS_state_t *fifoTHR);
 
 	/*acceleration Output */
-	int8_t  ITDS_getRawAccelerationX(int16_t *XRawAcc);
-	int8_t  ITDS_getRawAccelerationY(int16_t *YRawAcc) ;
-	int8_t  ITDS_getRawAccelerationZ(int16_t *ZRawAcc);
+	int8_t  ITDS_getRawAccelerationX(we_dev_t *dev, int16_t *XRawAcc);
+	int8_t  ITDS_getRawAccelerationY(we_dev_t *dev, int16_t *YRawAcc) ;
+	int8_t  ITDS_getRawAccelerationZ(we_dev_t *dev, int16_t *ZRawAcc);
+	int8_t  ITDS_getRawAccelerationXYZ(we_dev_t *dev, ITDS_raw_acceleration_t *rawAcc);
+	int8_t  ITDS_getRawAccelerationXYZAndTemperature(we_dev_t *dev, ITDS_raw_acceleration_t *rawAcc, uint8_t *temp8bit);
 
 	/* Temperature output */
-	int8_t  ITDS_getTemperature8bit(uint8_t *temp8bit);
-	int8_t  ITDS_getRawTemp12bit(int16_t *temp12bit);
-	int8_t  ITDS_getTemperature12bit(float *tempdegC);
+	int8_t  ITDS_getTemperature8bit(we_dev_t *dev, uint8_t *temp8bit);
+	int8_t  ITDS_getRawTemp12bit(we_dev_t *dev, int16_t *temp12bit);
+	int8_t  ITDS_getTemperature12bit(we_dev_t *dev, float *tempdegC);
+	int8_t  ITDS_getTemperature12bitCentiDegC(we_dev_t *dev, int32_t *tempCentiDegC);
 
 	/* FIFO CTRL */
-	int8_t  ITDS_setFifoMode(ITDS_Fifo_Mode FMode);
-	int8_t  ITDS_getFifoMode(ITDS_Fifo_Mode *FMode);
-	int8_t  ITDS_setFifoThreshold(uint8_t fifo_Threshold);
-	int8_t  ITDS_getFifoThreshold(uint8_t *fifo_Threshold);
+	int8_t  ITDS_setFifoMode(we_dev_t *dev, ITDS_Fifo_Mode FMode);
+	int8_t  ITDS_getFifoMode(we_dev_t *dev, ITDS_Fifo_Mode *FMode);
+	int8_t  ITDS_setFifoThreshold(we_dev_t *dev, uint8_t fifo_Threshold);
+	int8_t  ITDS_getFifoThreshold(we_dev_t *dev, uint8_t *fifo_Threshold);
 
 	/* FIFO_SAMPLES */
-	int8_t  ITDS_getFifoThresholdState(ITDS_state_t *fifoTHR);
-	int8_t  ITDS_getFifoOverrunState(ITDS_state_t *fifoOverrun);
-	int8_t  ITDS_getFifoFillLevel(uint8_t *fifoFill);
+	int8_t  ITDS_getFifoThresholdState(we_dev_t *dev, ITDS_state_t *fifoTHR);
+	int8_t  ITDS_getFifoOverrunState(we_dev_t *dev, ITDS_state_t *fifoOverrun);
+	int8_t  ITDS_getFifoFillLevel(we_dev_t *dev, uint8_t *fifoFill);
+
+	/* Conversion to physical units */
+	int8_t  ITDS_initConversion(ITDS_conversion_t *conversion, ITDS_operating_mode operatingMode, ITDS_power_mode powerMode, ITDS_full_Scale fullScale);
+	int8_t  ITDS_readConversion(we_dev_t *dev, ITDS_conversion_t *conversion);
+	float   ITDS_convertToMg(const ITDS_conversion_t *conversion, int16_t rawAcc);
+	int32_t ITDS_convertToMgQ16(const ITDS_conversion_t *conversion, int16_t rawAcc);
+	void    ITDS_convertXYZToMg(const ITDS_conversion_t *conversion, const ITDS_raw_acceleration_t *rawAcc, ITDS_acceleration_t *acc, int count);
+	void    ITDS_convertXYZToMgQ16(const ITDS_conversion_t *conversion, const ITDS_raw_acceleration_t *rawAcc, ITDS_acceleration_q16_t *acc, int count);
+	int32_t ITDS_convertToMgInt(const ITDS_conversion_t *conversion, int16_t rawAcc);
+	void    ITDS_convertXYZToMgInt(const ITDS_conversion_t *conversion, const ITDS_raw_acceleration_t *rawAcc, ITDS_acceleration_mg_t *acc, int count);
+
+	/* FIFO drain: fill level read once, then all pending samples in a single burst */
+	int8_t  ITDS_readFifo(we_dev_t *dev, ITDS_raw_acceleration_t *buffer, uint8_t maxSamples, uint8_t *count, ITDS_state_t *overrun);
+
+	/* Timestamped FIFO drain: samples back-dated from the drain time with the drift corrected output data period */
+	uint64_t ITDS_getSamplePeriodNs(ITDS_output_Data_Rate odr, ITDS_operating_mode operatingMode, ITDS_power_mode powerMode);
+	int8_t  ITDS_readFifoTimestamped(we_dev_t *dev, we_sample_clock_t *clock, ITDS_sample_t *buffer, uint8_t maxSamples, uint8_t *count);
 
 	/* TAP_X_TH */
-	int8_t  ITDS_en4DDetection(ITDS_state_t detection4D);
-	int8_t  ITDS_get4DDetectionState(ITDS_state_t *detection4D);
-	int8_t  ITDS_setTapThresholdX(uint8_t tapThresholdX);
-	int8_t  ITDS_getTapThresholdX(uint8_t *tapThresholdX);
-	int8_t  ITDS_set6DThreshold(ITDS_threshold_Degree threshold6D);
-	int8_t  ITDS_get6DThreshold(ITDS_threshold_Degree *threshold6D);
+	int8_t  ITDS_en4DDetection(we_dev_t *dev, ITDS_state_t detection4D);
+	int8_t  ITDS_get4DDetectionState(we_dev_t *dev, ITDS_state_t *detection4D);
+	int8_t  ITDS_setTapThresholdX(we_dev_t *dev, uint8_t tapThresholdX);
+	int8_t  ITDS_getTapThresholdX(we_dev_t *dev, uint8_t *tapThresholdX);
+	int8_t  ITDS_set6DThreshold(we_dev_t *dev, ITDS_threshold_Degree threshold6D);
+	int8_t  ITDS_get6DThreshold(we_dev_t *dev, ITDS_threshold_Degree *threshold6D);
 
 	/* TAP_Y_TH */
-	int8_t  ITDS_setTapThresholdY(uint8_t tapThresholdY);
-	int8_t  ITDS_getTapThresholdY(uint8_t *tapThresholdY);
-	int8_t  ITDS_setTapAxisPriority(ITDS_tap_Axis_Priority tapPriorityAxis);
-	int8_t  ITDS_getTapAxisPriority(ITDS_tap_Axis_Priority *tapPriorityAxis);
+	int8_t  ITDS_setTapThresholdY(we_dev_t *dev, uint8_t tapThresholdY);
+	int8_t  ITDS_getTapThresholdY(we_dev_t *dev, uint8_t *tapThresholdY);
+	int8_t  ITDS_setTapAxisPriority(we_dev_t *dev, ITDS_tap_Axis_Priority tapPriorityAxis);
+	int8_t  ITDS_getTapAxisPriority(we_dev_t *dev, ITDS_tap_Axis_Priority *tapPriorityAxis);
 
 
 	/* TAP_Z_TH */
-	int8_t  ITDS_setTapThresholdZ(uint8_t tapThresholdZ);
-	int8_t  ITDS_getTapThresholdZ(uint8_t *tapThresholdZ);
-	int8_t  ITDS_enTapX(ITDS_state_t tapX);
-	int8_t  ITDS_getTapX(ITDS_state_t *tapX);
-	int8_t  ITDS_enTapY(ITDS_state_t tapY);
-	int8_t  ITDS_getTapY(ITDS_state_t *tapY);
-	int8_t  ITDS_enTapZ(ITDS_state_t tapZ);
-	int8_t  ITDS_getTapZ(ITDS_state_t *tapZ);
+	int8_t  ITDS_setTapThresholdZ(we_dev_t *dev, uint8_t tapThresholdZ);
+	int8_t  ITDS_getTapThresholdZ(we_dev_t *dev, uint8_t *tapThresholdZ);
+	int8_t  ITDS_enTapX(we_dev_t *dev, ITDS_state_t tapX);
+	int8_t  ITDS_getTapX(we_dev_t *dev, ITDS_state_t *tapX);
+	int8_t  ITDS_enTapY(we_dev_t *dev, ITDS_state_t tapY);
+	int8_t  ITDS_getTapY(we_dev_t *dev, ITDS_state_t *tapY);
+	int8_t  ITDS_enTapZ(we_dev_t *dev, ITDS_state_t tapZ);
+	int8_t  ITDS_getTapZ(we_dev_t *dev, ITDS_state_t *tapZ);
 
 	/* INT_DUR */
-	int8_t  ITDS_setLatency(uint8_t latency_t);
-	int8_t  ITDS_getLatency(uint8_t *latency_t);
-	int8_t  ITDS_setQuiet(uint8_t quiet_t);
-	int8_t  ITDS_getQuiet(uint8_t *quiet_t);
-	int8_t  ITDS_setShock(uint8_t shock_t);
-	int8_t  ITDS_getShock(uint8_t *shock_t);
+	int8_t  ITDS_setLatency(we_dev_t *dev, uint8_t latency_t);
+	int8_t  ITDS_getLatency(we_dev_t *dev, uint8_t *latency_t);
+	int8_t  ITDS_setQuiet(we_dev_t *dev, uint8_t quiet_t);
+	int8_t  ITDS_getQuiet(we_dev_t *dev, uint8_t *quiet_t);
+	int8_t  ITDS_setShock(we_dev_t *dev, uint8_t shock_t);
+	int8_t  ITDS_getShock(we_dev_t *dev, uint8_t *shock_t);
 
 	/* WAKE_UP_TH */
-	int8_t  ITDS_enTapEvent(ITDS_state_t singleDoubleTap);    /*Enable single/double-tap event. Default value: 0 (0: enable only single-tap, 1: enable both single and double-tap) */
-	int8_t  ITDS_getTapEvent(ITDS_state_t *singleDoubleTap);  /* only Single Tap is enabled or Single and double Tap are both enabled */
-	int8_t  ITDS_enInactivity(ITDS_state_t sleep);
-	int8_t  ITDS_getInactivityState(ITDS_state_t *sleep) ;
-	int8_t  ITDS_setWakeupThreshold(uint8_t WakeupTHR);
-	int8_t  ITDS_getWakeupThreshold(uint8_t *WakeupTHR);
+	int8_t  ITDS_enTapEvent(we_dev_t *dev, ITDS_state_t singleDoubleTap);    /*Enable single/double-tap event. Default value: 0 (0: enable only single-tap, 1: enable both single and double-tap) */
+	int8_t  ITDS_getTapEvent(we_dev_t *dev, ITDS_state_t *singleDoubleTap);  /* only Single Tap is enabled or Single and double Tap are both enabled */
+	int8_t  ITDS_enInactivity(we_dev_t *dev, ITDS_state_t sleep);
+	int8_t  ITDS_getInactivityState(we_dev_t *dev, ITDS_state_t *sleep) ;
+	int8_t  ITDS_setWakeupThreshold(we_dev_t *dev, uint8_t WakeupTHR);
+	int8_t  ITDS_getWakeupThreshold(we_dev_t *dev, uint8_t *WakeupTHR);
 
 	/* WAKE_UP_DUR */
-	int8_t  ITDS_setFreeFallDurationMSB(ITDS_state_t FF_DUR5);
-	int8_t  ITDS_getFreeFallDurationMSB(ITDS_state_t *FF_DUR5);
-	int8_t  ITDS_setWakeupDuration(uint8_t wakeupDuration);
-	int8_t  ITDS_getWakeupDuration(uint8_t *wakeupDuration);
-	int8_t  ITDS_enStationnaryDetection(ITDS_state_t stationary);
-	int8_t  ITDS_getStationnaryState(ITDS_state_t *stationary);
-	int8_t  ITDS_setSleepDuration(uint8_t sleepDur);
-	int8_t  ITDS_getSleepDuration(uint8_t *sleepDur);
+	int8_t  ITDS_setFreeFallDurationMSB(we_dev_t *dev, ITDS_state_t FF_DUR5);
+	int8_t  ITDS_getFreeFallDurationMSB(we_dev_t *dev, ITDS_state_t *FF_DUR5);
+	int8_t  ITDS_setWakeupDuration(we_dev_t *dev, uint8_t wakeupDuration);
+	int8_t  ITDS_getWakeupDuration(we_dev_t *dev, uint8_t *wakeupDuration);
+	int8_t  ITDS_enStationnaryDetection(we_dev_t *dev, ITDS_state_t stationary);
+	int8_t  ITDS_getStationnaryState(we_dev_t *dev, ITDS_state_t *stationary);
+	int8_t  ITDS_setSleepDuration(we_dev_t *dev, uint8_t sleepDur);
+	int8_t  ITDS_getSleepDuration(we_dev_t *dev, uint8_t *sleepDur);
 
 	/* FREE_FALL */
-	int8_t ITDS_setFreeFallDurationLSB(uint8_t freeFallDuration);
-	int8_t ITDS_getFreeFallDurationLSB(uint8_t *freeFallDuration);
-	int8_t ITDS_setFreeFallThreshold(ITDS_Free_Fall_Thr FF_TH);
-	int8_t ITDS_getFreeFallThreshold(ITDS_Free_Fall_Thr *FF_TH);
+	int8_t ITDS_setFreeFallDurationLSB(we_dev_t *dev, uint8_t freeFallDuration);
+	int8_t ITDS_getFreeFallDurationLSB(we_dev_t *dev, uint8_t *freeFallDuration);
+	int8_t ITDS_setFreeFallThreshold(we_dev_t *dev, ITDS_Free_Fall_Thr FF_TH);
+	int8_t ITDS_getFreeFallThreshold(we_dev_t *dev, ITDS_Free_Fall_Thr *FF_TH);
 
 	/* STATUS_DETECT */
-	int8_t ITDS_getTempDrdy(ITDS_state_t *tempDrdy );
-	int8_t ITDS_getSleepState(ITDS_state_t *sleepState);
-	int8_t ITDS_getDoubleTapState(ITDS_state_t *doubleTap);
-	int8_t ITDS_getSingleTapState(ITDS_state_t *singleTap);
-	int8_t ITDS_getDrdy(ITDS_state_t *drdy);
+	int8_t ITDS_getTempDrdy(we_dev_t *dev, ITDS_state_t *tempDrdy );
+	int8_t ITDS_getSleepState(we_dev_t *dev, ITDS_state_t *sleepState);
+	int8_t ITDS_getDoubleTapState(we_dev_t *dev, ITDS_state_t *doubleTap);
+	int8_t ITDS_getSingleTapState(we_dev_t *dev, ITDS_state_t *singleTap);
+	int8_t ITDS_getDrdy(we_dev_t *dev, ITDS_state_t *drdy);
 
 	/* WAKE_UP_EVENT */
-	int8_t ITDS_getWakeupX(ITDS_state_t *wakeUpX);
-	int8_t ITDS_getWakeupY(ITDS_state_t *wakeUpY);
-	int8_t ITDS_getWakeupZ(ITDS_state_t *wakeUpZ);
-	int8_t ITDS_getWakeupState(ITDS_state_t *wakeUpState );
+	int8_t ITDS_getWakeupX(we_dev_t *dev, ITDS_state_t *wakeUpX);
+	int8_t ITDS_getWakeupY(we_dev_t *dev, ITDS_state_t *wakeUpY);
+	int8_t ITDS_getWakeupZ(we_dev_t *dev, ITDS_state_t *wakeUpZ);
+	int8_t ITDS_getWakeupState(we_dev_t *dev, ITDS_state_t *wakeUpState );
 
 	/* TAP_EVENT */
-	int8_t ITDS_getTapEventState(ITDS_state_t *tapEvent);
-	int8_t ITDS_getTapSign(ITDS_tapSign_t *tapSign);
-	int8_t ITDS_getTapXAxis(ITDS_state_t *tapXAxis);
-	int8_t ITDS_getTapYAxis(ITDS_state_t *tapYAxis);
-	int8_t ITDS_getTapZAxis(ITDS_state_t *tapZAxis);
+	int8_t ITDS_getTapEventState(we_dev_t *dev, ITDS_state_t *tapEvent);
+	int8_t ITDS_getTapSign(we_dev_t *dev, ITDS_tapSign_t *tapSign);
+	int8_t ITDS_getTapXAxis(we_dev_t *dev, ITDS_state_t *tapXAxis);
+	int8_t ITDS_getTapYAxis(we_dev_t *dev, ITDS_state_t *tapYAxis);
+	int8_t ITDS_getTapZAxis(we_dev_t *dev, ITDS_state_t *tapZAxis);
 
 	/* 6D_EVENT*/
-	int8_t ITDS_getZHOverThresholdState(ITDS_state_t *ZHOverThreshold);
-	int8_t ITDS_getZLOverThresholdState(ITDS_state_t *ZLOverThreshold);
-	int8_t ITDS_getYHOverThresholdState(ITDS_state_t *YHOverThreshold);
-	int8_t ITDS_getYLOverThresholdState(ITDS_state_t *YLOverThreshold);
-	int8_t ITDS_getXHOverThresholdState(ITDS_state_t *XHOverThreshold);
-	int8_t ITDS_getXLOverThresholdState(ITDS_state_t *XLOverThreshold);
+	int8_t ITDS_getZHOverThresholdState(we_dev_t *dev, ITDS_state_t *ZHOverThreshold);
+	int8_t ITDS_getZLOverThresholdState(we_dev_t *dev, ITDS_state_t *ZLOverThreshold);
+	int8_t ITDS_getYHOverThresholdState(we_dev_t *dev, ITDS_state_t *YHOverThreshold);
+	int8_t ITDS_getYLOverThresholdState(we_dev_t *dev, ITDS_state_t *YLOverThreshold);
+	int8_t ITDS_getXHOverThresholdState(we_dev_t *dev, ITDS_state_t *XHOverThreshold);
+	int8_t ITDS_getXLOverThresholdState(we_dev_t *dev, ITDS_state_t *XLOverThreshold);
 
 	/* ALL_INT_EVENT */
-	int8_t ITDS_getSleepChangeState(ITDS_state_t *sleep);
+	int8_t ITDS_getSleepChangeState(we_dev_t *dev, ITDS_state_t *sleep);
 
 	/* X_Y_Z_OFS_USR */
-	int8_t ITDS_setOffsetValueOnXAxis(uint8_t offsetvalueXAxis);
-	int8_t ITDS_getOffsetValueOnXAxis(uint8_t *offsetvalueXAxis);
-	int8_t ITDS_setOffsetValueOnYAxis(uint8_t offsetvalueYAxis);
-	int8_t ITDS_getOffsetValueOnYAxis(uint8_t *offsetvalueYAxis);
-	int8_t ITDS_setOffsetValueOnZAxis(uint8_t offsetvalueZAxis);
-	int8_t ITDS_getOffsetValueOnZAxis(uint8_t *offsetvalueZAxis);
+	int8_t ITDS_setOffsetValueOnXAxis(we_dev_t *dev, uint8_t offsetvalueXAxis);
+	int8_t ITDS_getOffsetValueOnXAxis(we_dev_t *dev, uint8_t *offsetvalueXAxis);
+	int8_t ITDS_setOffsetValueOnYAxis(we_dev_t *dev, uint8_t offsetvalueYAxis);
+	int8_t ITDS_getOffsetValueOnYAxis(we_dev_t *dev, uint8_t *offsetvalueYAxis);
+	int8_t ITDS_setOffsetValueOnZAxis(we_dev_t *dev, uint8_t offsetvalueZAxis);
+	int8_t ITDS_getOffsetValueOnZAxis(we_dev_t *dev, uint8_t *offsetvalueZAxis);
 
 	/* CTRL_7 */
-	int8_t ITDS_setDrdyPulse(ITDS_drdy_pulse  drdyPulsed);        	/* latched or pulsed DRDY */
-	int8_t ITDS_getDrdyPulseIntMode(ITDS_drdy_pulse  *drdyPulsed); /* latched or pulsed DRDY */
-	int8_t ITDS_setInt1OnInt0(ITDS_state_t int1Onint0);
-	int8_t ITDS_getInt1OnInt0(ITDS_state_t *int1Onint0) ;
-	int8_t ITDS_enInterrups(ITDS_state_t interrupts);
-	int8_t ITDS_getInterruptsState(ITDS_state_t *interrupts);
-	int8_t ITDS_enApplyOffsetXL(ITDS_state_t offsetXLOutput);
-	int8_t ITDS_getApplyOffsetXL(ITDS_state_t *offsetXLOutput);
-	int8_t ITDS_enApplyWakeUpOffsetXL(ITDS_state_t offsetXLWakeup);
-	int8_t ITDS_getApplyWakeUpOffsetXL(ITDS_state_t *offsetXLWakeup);
-
-	int8_t ITDS_setOffsetWeight(ITDS_state_t offsetWeight);
-	int8_t ITDS_getOffsetWeight(ITDS_state_t *offsetWeight);
-
-	int8_t ITDS_enHighPassRefMode(ITDS_state_t refMode);
-	int8_t ITDS_getHighPassRefMode(ITDS_state_t *refMode);
-
-	int8_t ITDS_enLowPassOn6D(ITDS_state_t LPassOn6D);
-	int8_t ITDS_getLowPassOn6DState(ITDS_state_t *LPassOn6D);
+	int8_t ITDS_setDrdyPulse(we_dev_t *dev, ITDS_drdy_pulse  drdyPulsed);        	/* latched or pulsed DRDY */
+	int8_t ITDS_getDrdyPulseIntMode(we_dev_t *dev, ITDS_drdy_pulse  *drdyPulsed); /* latched or pulsed DRDY */
+	int8_t ITDS_setInt1OnInt0(we_dev_t *dev, ITDS_state_t int1Onint0);
+	int8_t ITDS_getInt1OnInt0(we_dev_t *dev, ITDS_state_t *int1Onint0) ;
+	int8_t ITDS_enInterrups(we_dev_t *dev, ITDS_state_t interrupts);
+	int8_t ITDS_getInterruptsState(we_dev_t *dev, ITDS_state_t *interrupts);
+	int8_t ITDS_enApplyOffsetXL(we_dev_t *dev, ITDS_state_t offsetXLOutput);
+	int8_t ITDS_getApplyOffsetXL(we_dev_t *dev, ITDS_state_t *offsetXLOutput);
+	int8_t ITDS_enApplyWakeUpOffsetXL(we_dev_t *dev, ITDS_state_t offsetXLWakeup);
+	int8_t ITDS_getApplyWakeUpOffsetXL(we_dev_t *dev, ITDS_state_t *offsetXLWakeup);
+
+	int8_t ITDS_setOffsetWeight(we_dev_t *dev, ITDS_state_t offsetWeight);
+	int8_t ITDS_getOffsetWeight(we_dev_t *dev, ITDS_state_t *offsetWeight);
+
+	int8_t ITDS_enHighPassRefMode(we_dev_t *dev, ITDS_state_t refMode);
+	int8_t ITDS_getHighPassRefMode(we_dev_t *dev, ITDS_state_t *refMode);
+
+	int8_t ITDS_enLowPassOn6D(we_dev_t *dev, ITDS_state_t LPassOn6D);
+	int8_t ITDS_getLowPassOn6DState(we_dev_t *dev, ITDS_state_t *LPassOn6D);
 
 
 #ifdef __cplusplus
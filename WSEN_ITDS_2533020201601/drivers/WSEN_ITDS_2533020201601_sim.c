@@ -0,0 +1,257 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "WSEN_ITDS_2533020201601_sim.h"
+#include "WSEN_ITDS_2533020201601.h"
+#include <string.h>
+
+#define ITDS_SIM_FIFO_DEPTH          32
+#define ITDS_SIM_SINGLE_CONV_US      1250 /* duration of a single conversion */
+
+/* output data period in us for ODR[3:0], high performance mode */
+static const uint32_t ITDS_simPeriodUs[10] = { 0, 80000, 80000, 40000, 20000, 10000, 5000, 2500, 1250, 625 };
+
+
+/**
+* @brief  Store one sample in the output registers and the FIFO
+* @param  -sim : simulated device
+* @retval None
+*/
+static void ITDS_simSample(we_sim_device_t *sim)
+{
+	uint8_t record[6];
+	uint8_t fifoMode = sim->regs[ITDS_FIFO_CTRL_REG] >> 5;
+	uint8_t threshold = sim->regs[ITDS_FIFO_CTRL_REG] & 0x1F;
+	int16_t axis[3];
+	int i;
+
+	sim->sampleCount++;
+	axis[0] = (int16_t)SimWave(sim->sampleCount, 2000, 64);
+	axis[1] = (int16_t)SimWave(sim->sampleCount + 16, 2000, 64);
+	axis[2] = (int16_t)(16384 + SimWave(sim->sampleCount, 400, 32)); /* 1 g at +-2 g full scale */
+
+	for (i = 0; i < 3; i++)
+	{
+		record[2 * i] = (uint8_t)(axis[i] & 0xFF);
+		record[2 * i + 1] = (uint8_t)((uint16_t)axis[i] >> 8);
+	}
+	for (i = 0; i < 6; i++)
+	{
+		sim->regs[ITDS_X_OUT_L_REG + i] = record[i];
+	}
+
+	sim->regs[ITDS_STATUS_REG] |= 0x01;
+	sim->regs[ITDS_STATUS_DETECT_REG] |= 0x01;
+
+	if (fifoMode != 0)
+	{
+		/* FIFO mode (1) stops when full, the continuous modes overwrite the oldest sample */
+		SimFifoPush(sim, record, 6, ITDS_SIM_FIFO_DEPTH, fifoMode != 1);
+		if (threshold != 0 && sim->fifoLevel >= threshold)
+		{
+			sim->regs[ITDS_STATUS_REG] |= 0x80;
+		}
+	}
+}
+
+/**
+* @brief  Load the power-on register values
+* @param  -sim : simulated device
+* @retval None
+*/
+static void ITDS_simReset(we_sim_device_t *sim)
+{
+	memset(sim->regs, 0, sizeof(sim->regs));
+	sim->regs[ITDS_DEVICE_ID_REG] = ITDS_DEVICE_ID_VALUE;
+	sim->regs[ITDS_CTRL_2_REG] = 0x04; /* IF_ADD_INC */
+	sim->regs[ITDS_T_OUT_L_REG] = 0x00;
+	sim->regs[ITDS_T_OUT_H_REG] = 0x01; /* 26 degC */
+	sim->regs[ITDS_T_OUT_REG] = 0x01;
+	sim->periodUs = 0;
+	sim->conversionDoneUs = 0;
+	SimFifoClear(sim);
+}
+
+/**
+* @brief  Produce the samples due up to the current time
+* @param  -sim : simulated device
+* @retval None
+*/
+static void ITDS_simUpdate(we_sim_device_t *sim)
+{
+	uint8_t odr = sim->regs[ITDS_CTRL_1_REG] >> 4;
+	uint8_t operatingMode = (sim->regs[ITDS_CTRL_1_REG] >> 2) & 0x03;
+	uint32_t periodUs = 0;
+	uint32_t due;
+
+	if (operatingMode != 2 && odr < 10)
+	{
+		periodUs = ITDS_simPeriodUs[odr];
+		if (operatingMode == 0)
+		{
+			if ((sim->regs[ITDS_CTRL_1_REG] & 0x03) == 0)
+			{
+				/* low power mode: 1.6 Hz for ODR 0001, at most 200 Hz */
+				periodUs = (odr == 1) ? 625000 : ((odr >= 7) ? 5000 : periodUs);
+			}
+			else if (odr == 7)
+			{
+				periodUs = 5000; /* normal mode: 200 Hz for ODR 0111 */
+			}
+		}
+	}
+
+	for (due = SimSamplesDue(sim, periodUs); due > 0; due--)
+	{
+		ITDS_simSample(sim);
+	}
+
+	if (sim->conversionDoneUs != 0 && sim->conversionDoneUs <= sim->nowUs)
+	{
+		sim->conversionDoneUs = 0;
+		sim->regs[ITDS_CTRL_3_REG] &= (uint8_t)~0x01;
+		ITDS_simSample(sim);
+	}
+}
+
+/**
+* @brief  Read one register, the output registers are served from the FIFO when it is enabled
+* @param  -sim : simulated device
+*         -RegAdr : register address
+* @retval register value
+*/
+static uint8_t ITDS_simRead(we_sim_device_t *sim, uint8_t RegAdr)
+{
+	uint8_t value;
+
+	switch (RegAdr)
+	{
+	case ITDS_FIFO_SAMPLES_REG:
+		value = (uint8_t)(sim->fifoLevel & 0x3F);
+		if (sim->fifoOverrun)
+		{
+			value |= 0x40;
+		}
+		if ((sim->regs[ITDS_FIFO_CTRL_REG] & 0x1F) != 0 && sim->fifoLevel >= (sim->regs[ITDS_FIFO_CTRL_REG] & 0x1F))
+		{
+			value |= 0x80;
+		}
+		return value;
+
+	case ITDS_X_OUT_L_REG:
+	case ITDS_X_OUT_H_REG:
+	case ITDS_Y_OUT_L_REG:
+	case ITDS_Y_OUT_H_REG:
+	case ITDS_Z_OUT_L_REG:
+	case ITDS_Z_OUT_H_REG:
+		if ((sim->regs[ITDS_FIFO_CTRL_REG] >> 5) != 0 && sim->fifoLevel > 0)
+		{
+			return SimFifoReadByte(sim, RegAdr - ITDS_X_OUT_L_REG, 6);
+		}
+		if (RegAdr == ITDS_Z_OUT_H_REG)
+		{
+			sim->regs[ITDS_STATUS_REG] &= (uint8_t)~0x01;
+			sim->regs[ITDS_STATUS_DETECT_REG] &= (uint8_t)~0x01;
+		}
+		return sim->regs[RegAdr];
+
+	default:
+		return sim->regs[RegAdr];
+	}
+}
+
+/**
+* @brief  Write one register including the soft reset, single conversion trigger and FIFO mode change
+* @param  -sim : simulated device
+*         -RegAdr : register address
+*         -value : value to write
+* @retval None
+*/
+static void ITDS_simWrite(we_sim_device_t *sim, uint8_t RegAdr, uint8_t value)
+{
+	switch (RegAdr)
+	{
+	case ITDS_DEVICE_ID_REG:
+	case ITDS_STATUS_REG:
+	case ITDS_FIFO_SAMPLES_REG:
+	case ITDS_STATUS_DETECT_REG:
+		return; /* read only */
+
+	case ITDS_CTRL_2_REG:
+		if (value & 0x40)
+		{
+			ITDS_simReset(sim);
+			return;
+		}
+		break;
+
+	case ITDS_CTRL_3_REG:
+		if ((value & 0x01) && (((sim->regs[ITDS_CTRL_1_REG] >> 2) & 0x03) == 2))
+		{
+			sim->conversionDoneUs = sim->nowUs + ITDS_SIM_SINGLE_CONV_US;
+		}
+		break;
+
+	case ITDS_FIFO_CTRL_REG:
+		if ((value >> 5) == 0)
+		{
+			SimFifoClear(sim); /* bypass mode empties the FIFO */
+		}
+		break;
+
+	default:
+		break;
+	}
+	sim->regs[RegAdr] = value;
+}
+
+/**
+* @brief  Auto increment, the output registers roll over to X_OUT_L while the FIFO is enabled
+* @param  -sim : simulated device
+*         -RegAdr : current register address
+* @retval next register address
+*/
+static uint8_t ITDS_simNextAddress(we_sim_device_t *sim, uint8_t RegAdr)
+{
+	if ((sim->regs[ITDS_CTRL_2_REG] & 0x04) == 0)
+	{
+		return RegAdr;
+	}
+	if (RegAdr == ITDS_Z_OUT_H_REG && (sim->regs[ITDS_FIFO_CTRL_REG] >> 5) != 0)
+	{
+		return ITDS_X_OUT_L_REG;
+	}
+	return (uint8_t)(RegAdr + 1);
+}
+
+const we_sim_model_t ITDS_simModel = {
+	ITDS_simReset,
+	ITDS_simUpdate,
+	ITDS_simRead,
+	ITDS_simWrite,
+	ITDS_simNextAddress
+};
+
+/**         EOF         */
@@ -33,14 +33,31 @@
 #include <string.h>
 
 #include "WSEN_ITDS_2533020201601.h"
+#include "platform_ring.h"
 #include "version.h"
 
 #define DELAY_1_S_IN_MS     1000
+#define SAMPLE_RING_SIZE    256     /* samples buffered between acquisition and printing, power of 2 */
+
+/* GPIO (BCM numbering, /dev/gpiochip0) wired to INT_0; uncomment to sleep on the data-ready interrupt instead of polling */
+//#define ITDS_INT0_GPIO      17
 
 
 bool AbortMainLoop = false;
 pthread_t thread_main;
 
+static we_bus_t bus;  /* bus the sensor is attached to */
+static we_dev_t itds; /* sensor device context */
+#ifdef ITDS_INT0_GPIO
+static we_int_line_t int0Line;           /* GPIO connected to INT_0 */
+#endif
+static we_int_line_t *drdyLine = NULL;   /* NULL: poll the data-ready status */
+
+/* samples handed from the acquisition to the printing thread, the acquisition never waits for printf */
+static ITDS_sample_t sampleStorage[SAMPLE_RING_SIZE];
+static we_ring_t sampleRing;
+static ITDS_conversion_t printConversion;
+
 
 static void Application(void);
 void startHighPerformanceMode(void);
@@ -144,7 +161,11 @@ static void Application()
 	uint8_t deviceIdValue = 0;
 
 	/* initialize the platform SPI drivers */
-	status = SpiInit(spi_channel);
+	status = SpiBusInit(&bus, &WE_wiringPiBusOps, 0, 4000000, 0); /* /dev/spidev0.x, 4MHz, SPI mode 0 */
+	if (status == WE_SUCCESS)
+	{
+		status = DeviceInit(&itds, &bus, spi_channel);
+	}
 
 	if (status != WE_SUCCESS)
 	{
@@ -157,7 +178,11 @@ static void Application()
 	uint8_t deviceIdValue = 0;
 
 	/* initialize the platform I2C drivers */
-	status = I2CInit(addr_wsen_itds);
+	status = I2CBusInit(&bus, &WE_wiringPiBusOps, 1); /* /dev/i2c-1 on the Raspberry Pi header */
+	if (status == WE_SUCCESS)
+	{
+		status = DeviceInit(&itds, &bus, addr_wsen_itds);
+	}
 
 	if (status != WE_SUCCESS)
 	{
@@ -167,7 +192,7 @@ static void Application()
 #endif
 
 	uint8_t retval = 0;
-	retval = ITDS_getDeviceID(&deviceIdValue);
+	retval = ITDS_getDeviceID(&itds, &deviceIdValue);
 
 	if ((retval == WE_SUCCESS) && (deviceIdValue == ITDS_DEVICE_ID_VALUE))
 	{
@@ -180,65 +205,107 @@ static void Application()
 		return;
 	}
 
+#ifdef ITDS_INT0_GPIO
+	/* route data-ready to INT_0 and sleep on its rising edge */
+	if ((IntLineInit(&int0Line, 0, ITDS_INT0_GPIO, WE_risingEdge) == WE_SUCCESS) &&
+		(ITDS_enDataReadyINT0(&itds, ITDS_enable) == WE_SUCCESS) &&
+		(ITDS_enInterrups(&itds, ITDS_enable) == WE_SUCCESS))
+	{
+		drdyLine = &int0Line;
+	}
+#endif
+
 	/*select one of the three mode by uncommenting/commenting */
 	startHighPerformanceMode();
 	//startNormalMode();
 	//startLowPowerMode();
 
 }
+/**
+* @brief  Printing thread: pops the samples of the last second and prints the newest one
+* @param  no parameter.
+* @retval Does not return
+*/
+static void *printThread(void *arg)
+{
+	ITDS_sample_t samples[SAMPLE_RING_SIZE];
+	ITDS_acceleration_t acc;
+	uint32_t count;
+
+	(void)arg;
+	while (1)
+	{
+		delay(DELAY_1_S_IN_MS);
+
+		count = RingPop(&sampleRing, samples, SAMPLE_RING_SIZE);
+		if (count == 0)
+		{
+			continue;
+		}
+
+		ITDS_convertXYZToMg(&printConversion, &samples[count - 1].raw, &acc, 1);
+		printf("%u samples, %u dropped, t = %llu ns\r\n", count, RingOverruns(&sampleRing), (unsigned long long)samples[count - 1].timestampNs);
+		printf("Acceleration X-axis %f g \r\n", acc.x / 1000); /* mg to g */
+		printf("Acceleration Y-axis %f g \r\n", acc.y / 1000);
+		printf("Acceleration Z-axis %f g \r\n", acc.z / 1000);
+	}
+
+	return NULL;
+}
+
 /**
 * @brief  High performance mode
+*         Every sample is read and pushed into a ring buffer, a separate thread prints them.
 * @param  no parameter.
 * @retval none
 */
 void startHighPerformanceMode()
 {
 	ITDS_state_t DRDY = ITDS_disable;
-	int16_t XRawAcc = 0, YRawAcc = 0, ZRawAcc = 0;
+	ITDS_sample_t sample;
+	ITDS_config_t config;
+	pthread_t printer;
 
+	/* start from the current configuration, then apply all changes in a single burst */
+	ITDS_readConfig(&itds, &config);
 	/* Sampling rate of 200 Hz */
-	ITDS_setOutputDataRate(odr6);
+	config.outputDataRate = odr6;
 	/* Enable high performance mode */
-	ITDS_setOperatingMode(highPerformance);
+	config.operatingMode = highPerformance;
 	/* Enable block data update */
-	ITDS_setBlockDataUpdate(ITDS_enable);
+	config.blockDataUpdate = ITDS_enable;
 	/* Enable address auto increment */
-	ITDS_setAutoIncrement(ITDS_enable);
+	config.autoIncrement = ITDS_enable;
 	/* Full scale +-16g */
-	ITDS_setFullScale(sixteenG);
+	config.fullScale = sixteenG;
 	/* Filter bandwidth = ODR/2 */
-	ITDS_setFilteringCutoff(outputDataRate_2);
+	config.filteringCutoff = outputDataRate_2;
+	ITDS_applyConfig(&itds, &config);
+
+	/* resolution and sensitivity of the configured mode and full scale */
+	ITDS_readConversion(&itds, &printConversion);
+
+	RingInit(&sampleRing, sampleStorage, SAMPLE_RING_SIZE, sizeof(ITDS_sample_t));
+	if (pthread_create(&printer, NULL, &printThread, NULL))
+	{
+		printf("Failed to start the printing thread");
+		return;
+	}
 
 	while(1)
 	{
 		do
 		{
 			/*Wait till the value is ready to read*/
-			ITDS_getdataReadyState(&DRDY);
+			ITDS_waitForDataReady(&itds, drdyLine, DELAY_1_S_IN_MS, &DRDY);
 		} while (DRDY == ITDS_disable);
 
-		ITDS_getRawAccelerationX(&XRawAcc);
-		XRawAcc = XRawAcc >> 2; /* shifted by 2 as 14bit resolution is used in high performance mode */
-		float XAcceleration = (float) (XRawAcc);
-		XAcceleration = XAcceleration / 1000; /* mg to g */
-		XAcceleration = XAcceleration * 1.952; /* Multiply with sensitivity 1.952 in high performance mode, 14bit, and full scale +-16g */
-		printf("Acceleration X-axis %f g \r\n ", XAcceleration);
-
-		ITDS_getRawAccelerationY(&YRawAcc);
-		YRawAcc = YRawAcc >> 2;
-		float YAcceleration = (float) (YRawAcc);
-		YAcceleration = YAcceleration / 1000;
-		YAcceleration = (YAcceleration * 1.952);
-		printf("Acceleration Y-axis %f g \r\n ", YAcceleration);
-
-		ITDS_getRawAccelerationZ(&ZRawAcc);
-		ZRawAcc = ZRawAcc >> 2;
-		float ZAcceleration = (float) (ZRawAcc);
-		ZAcceleration = ZAcceleration / 1000;
-		ZAcceleration = ZAcceleration * 1.952;
-		printf("Acceleration Z-axis %f g \r\n ", ZAcceleration);
+		/* all three axes of the same sample in one transfer */
+		ITDS_getRawAccelerationXYZ(&itds, &sample.raw);
+		sample.timestampNs = SampleClockNowNs();
 
-		delay(DELAY_1_S_IN_MS);
+		/* never blocks: a full ring drops the sample and counts it */
+		RingPush(&sampleRing, &sample, 1);
 	}
 }
 /**
@@ -249,48 +316,45 @@ void startHighPerformanceMode()
 void startNormalMode()
 {
 	ITDS_state_t DRDY = ITDS_disable;
-	int16_t XRawAcc = 0, YRawAcc = 0, ZRawAcc = 0;
+	ITDS_raw_acceleration_t rawAcc;
+	ITDS_conversion_t conversion;
+	ITDS_acceleration_t acc;
+	ITDS_config_t config;
 
+	/* start from the current configuration, then apply all changes in a single burst */
+	ITDS_readConfig(&itds, &config);
 	/* Sampling rate of 200 Hz */
-	ITDS_setOutputDataRate(odr6);
-	/* Enable normal mode*/
-	ITDS_setOperatingMode(normalOrLowPower);
-	ITDS_setpowerMode(normalMode);
+	config.outputDataRate = odr6;
+	/* Enable normal mode */
+	config.operatingMode = normalOrLowPower;
+	config.powerMode = normalMode;
 	/* Enable block data update */
-	ITDS_setBlockDataUpdate(ITDS_enable);
+	config.blockDataUpdate = ITDS_enable;
 	/* Enable address auto increment */
-	ITDS_setAutoIncrement(ITDS_enable);
+	config.autoIncrement = ITDS_enable;
 	/* Full scale +-16g */
-	ITDS_setFullScale(sixteenG);
+	config.fullScale = sixteenG;
 	/* Filter bandwidth = ODR/2 */
-	ITDS_setFilteringCutoff(outputDataRate_2);
+	config.filteringCutoff = outputDataRate_2;
+	ITDS_applyConfig(&itds, &config);
+
+	/* resolution and sensitivity of the configured mode and full scale */
+	ITDS_readConversion(&itds, &conversion);
+
 	while(1)
 	{
 		do
 		{
-			ITDS_getdataReadyState(&DRDY);
+			ITDS_waitForDataReady(&itds, drdyLine, DELAY_1_S_IN_MS, &DRDY);
 		} while (DRDY == ITDS_disable);
 
-		ITDS_getRawAccelerationX(&XRawAcc);
-		XRawAcc = XRawAcc >> 2; /* shifted by 2 as 14bit resolution is used in normal mode */
-		float XAcceleration = (float) (XRawAcc);
-		XAcceleration = XAcceleration / 1000; /* mg to g */
-		XAcceleration = XAcceleration * 1.952; /* Multiply with sensitivity 1.952 in normal mode, 14bit, and full scale +-16g */
-		printf("Acceleration X-axis %f g \r\n", XAcceleration);
-
-		ITDS_getRawAccelerationY(&YRawAcc);
-		YRawAcc = YRawAcc >> 2; 
-		float YAcceleration = (float) (YRawAcc);
-		YAcceleration = YAcceleration / 1000;
-		YAcceleration = (YAcceleration*1.952);
-		printf("Acceleration Y-axis %f g \r\n", YAcceleration);
-
-		ITDS_getRawAccelerationZ(&ZRawAcc);
-		ZRawAcc = ZRawAcc >> 2;
-		float ZAcceleration = (float) (ZRawAcc);
-		ZAcceleration = ZAcceleration / 1000;
-		ZAcceleration = ZAcceleration * 1.952;
-		printf("Acceleration Z-axis %f g \r\n", ZAcceleration);
+		/* all three axes of the same sample in one transfer */
+		ITDS_getRawAccelerationXYZ(&itds, &rawAcc);
+
+		ITDS_convertXYZToMg(&conversion, &rawAcc, &acc, 1);
+		printf("Acceleration X-axis %f g \r\n", acc.x / 1000); /* mg to g */
+		printf("Acceleration Y-axis %f g \r\n", acc.y / 1000);
+		printf("Acceleration Z-axis %f g \r\n", acc.z / 1000);
 		delay(DELAY_1_S_IN_MS);
 	}
 }
@@ -303,48 +367,45 @@ void startNormalMode()
 void startLowPowerMode()
 {
 	ITDS_state_t DRDY = ITDS_disable;
-	int16_t XRawAcc = 0, YRawAcc = 0, ZRawAcc = 0;
+	ITDS_raw_acceleration_t rawAcc;
+	ITDS_conversion_t conversion;
+	ITDS_acceleration_t acc;
+	ITDS_config_t config;
 
+	/* start from the current configuration, then apply all changes in a single burst */
+	ITDS_readConfig(&itds, &config);
 	/* Sampling rate of 200 Hz */
-	ITDS_setOutputDataRate(odr6);
+	config.outputDataRate = odr6;
 	/* Enable low power mode */
-	ITDS_setOperatingMode(normalOrLowPower);
-	ITDS_setpowerMode(lowPower);
+	config.operatingMode = normalOrLowPower;
+	config.powerMode = lowPower;
 	/* Enable block data update */
-	ITDS_setBlockDataUpdate(ITDS_enable);
+	config.blockDataUpdate = ITDS_enable;
 	/* Enable address auto increment */
-	ITDS_setAutoIncrement(ITDS_enable);
+	config.autoIncrement = ITDS_enable;
 	/* Full scale +-16g */
-	ITDS_setFullScale(sixteenG);
+	config.fullScale = sixteenG;
 	/* Filter bandwidth = ODR/2 */
-	ITDS_setFilteringCutoff(outputDataRate_2);
+	config.filteringCutoff = outputDataRate_2;
+	ITDS_applyConfig(&itds, &config);
+
+	/* resolution and sensitivity of the configured mode and full scale */
+	ITDS_readConversion(&itds, &conversion);
+
 	while(1)
 	{
 		do
 		{
-			ITDS_getdataReadyState(&DRDY);
+			ITDS_waitForDataReady(&itds, drdyLine, DELAY_1_S_IN_MS, &DRDY);
 		} while (DRDY == ITDS_disable);
 
-		ITDS_getRawAccelerationX(&XRawAcc);
-		XRawAcc = XRawAcc >> 4; /* shifted by 4 as 12bit resolution is used in low power mode */
-		float XAcceleration = (float) (XRawAcc);
-		XAcceleration = XAcceleration / 1000; /* mg to g */
-		XAcceleration = XAcceleration * 7.808; /* Multiply with sensitivity 7.808 in low power mode, 12 bit, and full scale +-16g */
-		printf("Acceleration X-axis %f g \r\n", XAcceleration);
-
-		ITDS_getRawAccelerationY(&YRawAcc);
-		YRawAcc = YRawAcc >> 4;
-		float YAcceleration = (float) (YRawAcc);
-		YAcceleration = YAcceleration / 1000; 
-		YAcceleration = (YAcceleration * 7.808);
-		printf("Acceleration Y-axis %f g \r\n", YAcceleration);
-
-		ITDS_getRawAccelerationZ(&ZRawAcc);
-		ZRawAcc = ZRawAcc >> 4;
-		float ZAcceleration = (float) (ZRawAcc);
-		ZAcceleration = ZAcceleration / 1000;
-		ZAcceleration = ZAcceleration * 7.808;
-		printf("Acceleration Z-axis %f g \r\n", ZAcceleration);
+		/* all three axes of the same sample in one transfer */
+		ITDS_getRawAccelerationXYZ(&itds, &rawAcc);
+
+		ITDS_convertXYZToMg(&conversion, &rawAcc, &acc, 1);
+		printf("Acceleration X-axis %f g \r\n", acc.x / 1000); /* mg to g */
+		printf("Acceleration Y-axis %f g \r\n", acc.y / 1000);
+		printf("Acceleration Z-axis %f g \r\n", acc.z / 1000);
 
 		delay(DELAY_1_S_IN_MS);
 	}
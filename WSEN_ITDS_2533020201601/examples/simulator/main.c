@@ -0,0 +1,124 @@
+/**
+***************************************************************************************************
+* This file is part of WE sensors SDK:
+* https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+*
+* THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+* EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+* TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+* MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+* WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+* RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+* COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+* WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+* FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+* THEREOF
+*
+* THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+* FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+* IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+*
+* COPYRIGHT(c) 2019 Würth Elektronik eiSos GmbH & Co. KG
+*
+***************************************************************************************************
+**/
+#include <stdio.h>
+#include <string.h>
+
+#include "WSEN_ITDS_2533020201601.h"
+#include "WSEN_ITDS_2533020201601_sim.h"
+#include "version.h"
+
+/*
+ * Runs the driver against the simulator backend (platform_sim.h), no sensor and no wiringPi required.
+ * Drains a full FIFO with the register cache enabled and checks that the cached configuration
+ * still matches the registers of the (simulated) device.
+ */
+
+#define TAP_THRESHOLD_X     0x0A    /* any value differing from the FIFO data, register 0x30 follows the FIFO burst start */
+
+
+static we_bus_t bus;                /* simulated I2C bus */
+static we_sim_bus_t simBus;         /* simulated clock and traffic counters */
+static we_dev_t itds;               /* sensor device context */
+static we_sim_device_t itdsSim;     /* simulated register file and FIFO */
+static we_reg_cache_t itdsCache;    /* register shadow of itds */
+
+
+/**
+* @brief  Fill the FIFO, drain it and compare the cached configuration with the device
+* @param  no parameter.
+* @retval 0 if the configuration matches; -1 on error
+*/
+int main()
+{
+	ITDS_config_t config;
+	ITDS_config_t cachedConfig;
+	ITDS_config_t deviceConfig;
+	ITDS_raw_acceleration_t samples[ITDS_FIFO_DEPTH];
+	uint8_t cachedTapThreshold;
+	uint8_t deviceTapThreshold;
+	uint8_t count;
+	bool match;
+
+	printf("Wuerth Elektronik eiSos Sensors SDK version %d.%d\n", WE_SENSOR_SDK_MAJOR_VERSION, WE_SENSOR_SDK_MINOR_VERSION);
+
+	if ((WE_FAIL == SimBusInit(&bus, &simBus, WE_i2c, 400000)) ||
+	    (WE_FAIL == SimDeviceInit(&itds, &bus, ITDS_ADDRESS_I2C_1, &itdsSim, &ITDS_simModel)) ||
+	    (WE_FAIL == ITDS_enableRegisterCache(&itds, &itdsCache)))
+	{
+		Debug_out("Simulator setup", false);
+		return -1;
+	}
+
+	/* 1600 Hz, FIFO in continuous mode */
+	if ((WE_FAIL == ITDS_readConfig(&itds, &config)) ||
+	    (WE_FAIL == ITDS_setTapThresholdX(&itds, TAP_THRESHOLD_X)))
+	{
+		Debug_out("Configuration", false);
+		return -1;
+	}
+	config.outputDataRate = odr9;
+	config.operatingMode = highPerformance;
+	config.autoIncrement = ITDS_enable;
+	config.fifoMode = continuousMode;
+	if (WE_FAIL == ITDS_applyConfig(&itds, &config))
+	{
+		Debug_out("Configuration", false);
+		return -1;
+	}
+
+	/* 32 samples at 1600 Hz take 20 ms */
+	BusDelay(&bus, 30);
+	if (WE_FAIL == ITDS_readFifo(&itds, samples, ITDS_FIFO_DEPTH, &count, NULL))
+	{
+		Debug_out("FIFO drain", false);
+		return -1;
+	}
+	printf("FIFO drained: %u samples, cache hits %u misses %u\n", count, itdsCache.hits, itdsCache.misses);
+
+	/* served from the cache ... */
+	if ((WE_FAIL == ITDS_readConfig(&itds, &cachedConfig)) ||
+	    (WE_FAIL == ITDS_getTapThresholdX(&itds, &cachedTapThreshold)))
+	{
+		Debug_out("Cached configuration", false);
+		return -1;
+	}
+
+	/* ... and read from the device */
+	RegCacheInvalidate(&itds);
+	if ((WE_FAIL == ITDS_readConfig(&itds, &deviceConfig)) ||
+	    (WE_FAIL == ITDS_getTapThresholdX(&itds, &deviceTapThreshold)))
+	{
+		Debug_out("Device configuration", false);
+		return -1;
+	}
+
+	match = (count == ITDS_FIFO_DEPTH) &&
+	        (memcmp(&cachedConfig, &deviceConfig, sizeof(ITDS_config_t)) == 0) &&
+	        (memcmp(&cachedConfig, &config, sizeof(ITDS_config_t)) == 0) &&
+	        (cachedTapThreshold == deviceTapThreshold) && (deviceTapThreshold == TAP_THRESHOLD_X);
+	Debug_out("Register cache matches the device after a FIFO drain", match);
+
+	return match ? 0 : -1;
+}
@@ -24,39 +24,72 @@
 **/
 
 #include "WSEN_PADS_2511020213301.h"
+#include "platform_convert.h"
 #include <stdio.h>
 
 
+/* images of the consecutive registers CTRL_1 .. FIFO_WTM */
+typedef struct {
+	PADS_ctrl_1_t ctrl1;
+	PADS_ctrl_2_t ctrl2;
+	PADS_ctrl_3_t ctrl3;
+	PADS_fifo_ctrl_t fifoCtrl;
+	PADS_fifo_wtm_t fifoWtm;
+} PADS_ctrl_block_t;
+
+static int8_t PADS_readCtrlBlock(we_dev_t *dev, PADS_ctrl_block_t *ctrl);
+
+
 /**
 * @brief  Read the device ID
 * @param  Pointer to device ID.
 * @retval Error code
 */
-int8_t PADS_getDeviceID(uint8_t *devID)
+int8_t PADS_getDeviceID(we_dev_t *dev, uint8_t *devID)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_DEVICE_ID_REG, 1, devID))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_DEVICE_ID_REG, 1, devID))
 	return WE_FAIL;
 
 	return WE_SUCCESS; /* expected value is PADS_DEVICE_ID_VALUE */
 
 }
 
+/* control registers without self-clearing bits (INT_CFG and CTRL_2 are read from the sensor every time) */
+static const uint8_t PADS_cachedRegs[] = {
+	PADS_THR_P_L_REG, PADS_THR_P_H_REG, PADS_INTERFACE_CTRL_REG, PADS_CTRL_1_REG, PADS_CTRL_3_REG,
+	PADS_FIFO_CTRL_REG, PADS_FIFO_WTM_REG, PADS_OPC_P_L_REG, PADS_OPC_P_H_REG
+};
+
+/**
+* @brief  Attach a register shadow cache and load it from the sensor
+*         Setters then need a single bus write, configuration getters are served from memory.
+* @param  Pointer to the cache storage, must stay valid as long as the device is used
+* @retval Error code
+*/
+int8_t PADS_enableRegisterCache(we_dev_t *dev, we_reg_cache_t *cache)
+{
+	if (WE_FAIL == RegCacheInit(dev, cache, PADS_cachedRegs, sizeof(PADS_cachedRegs)))
+	return WE_FAIL;
+
+	return RegCacheSync(dev);
+}
+
 /**
 * @brief  Set the output data rate of the sensor
 * @param  output data rate
 * @retval Error code
 */
-int8_t PADS_setOutputDataRate(PADS_output_data_rate_t odr)
+int8_t PADS_setOutputDataRate(we_dev_t *dev, PADS_output_data_rate_t odr)
 {
 
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.outputDataRate = odr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -67,11 +100,11 @@ int8_t PADS_setOutputDataRate(PADS_output_data_rate_t odr)
 * @param  Pointer to Output Data Rate
 * @retval Error code
 */
-int8_t PADS_getOutputDataRate(PADS_output_data_rate_t* odr)
+int8_t PADS_getOutputDataRate(we_dev_t *dev, PADS_output_data_rate_t* odr)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*odr = (PADS_output_data_rate_t)ctrl_reg_1.outputDataRate;
@@ -83,16 +116,16 @@ int8_t PADS_getOutputDataRate(PADS_output_data_rate_t* odr)
 * @param  filter state
 * @retval Error code
 */
-int8_t PADS_setLowPassFilter(PADS_state_t filterStatus)
+int8_t PADS_setLowPassFilter(we_dev_t *dev, PADS_state_t filterStatus)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.enLowPassFilter = filterStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -103,11 +136,11 @@ int8_t PADS_setLowPassFilter(PADS_state_t filterStatus)
 * @param  Pointer to Low pass filter state
 * @retval Error code
 */
-int8_t PADS_getLowPassFilterStatus(PADS_state_t *filterStatus)
+int8_t PADS_getLowPassFilterStatus(we_dev_t *dev, PADS_state_t *filterStatus)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 	*filterStatus = (PADS_state_t)ctrl_reg_1.enLowPassFilter;
 
@@ -119,16 +152,16 @@ int8_t PADS_getLowPassFilterStatus(PADS_state_t *filterStatus)
 * @param  configuration parameter
 * @retval Error code
 */
-int8_t PADS_setLowPassFilterConf(PADS_filter_conf_t conf)
+int8_t PADS_setLowPassFilterConf(we_dev_t *dev, PADS_filter_conf_t conf)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.lowPassFilterConfig = conf;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -140,11 +173,11 @@ int8_t PADS_setLowPassFilterConf(PADS_filter_conf_t conf)
 * @param  Pointer to Low pass filter configuration
 * @retval Error code
 */
-int8_t PADS_getLowPassFilterConf(PADS_filter_conf_t *conf )
+int8_t PADS_getLowPassFilterConf(we_dev_t *dev, PADS_filter_conf_t *conf )
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 	*conf = (PADS_filter_conf_t)ctrl_reg_1.lowPassFilterConfig;
 
@@ -156,16 +189,16 @@ int8_t PADS_getLowPassFilterConf(PADS_filter_conf_t *conf )
 * @param  BDU state
 * @retval Error code
 */
-int8_t PADS_setBlockDataUpdate(PADS_state_t bdu)
+int8_t PADS_setBlockDataUpdate(we_dev_t *dev, PADS_state_t bdu)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	ctrl_reg_1.blockDataUpdate = bdu;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -176,11 +209,11 @@ int8_t PADS_setBlockDataUpdate(PADS_state_t bdu)
 * @param  Pointer to Block data update state
 * @retval Error code
 */
-int8_t PADS_getBlockDataUpdateState(PADS_state_t *bdu)
+int8_t PADS_getBlockDataUpdateState(we_dev_t *dev, PADS_state_t *bdu)
 {
 	PADS_ctrl_1_t ctrl_reg_1;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&ctrl_reg_1))
 	return WE_FAIL;
 
 	*bdu = (PADS_state_t)ctrl_reg_1.blockDataUpdate;
@@ -192,16 +225,16 @@ int8_t PADS_getBlockDataUpdateState(PADS_state_t *bdu)
 * @param  Power mode
 * @retval Error code
 */
-int8_t PADS_setPowerMode(PADS_pwr_mode_t mode)
+int8_t PADS_setPowerMode(we_dev_t *dev, PADS_pwr_mode_t mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.lowNoiseMode = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -212,11 +245,11 @@ int8_t PADS_setPowerMode(PADS_pwr_mode_t mode)
 * @param  pointer to Power mode
 * @retval Error code
 */
-int8_t PADS_getPowerMode(PADS_pwr_mode_t *mode)
+int8_t PADS_getPowerMode(we_dev_t *dev, PADS_pwr_mode_t *mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*mode = (PADS_pwr_mode_t)ctrl_reg_2.lowNoiseMode;
 
@@ -228,16 +261,16 @@ int8_t PADS_getPowerMode(PADS_pwr_mode_t *mode)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setAutoIncrement(PADS_state_t autoInc)
+int8_t PADS_setAutoIncrement(we_dev_t *dev, PADS_state_t autoInc)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.autoAddIncr = autoInc;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -248,11 +281,11 @@ int8_t PADS_setAutoIncrement(PADS_state_t autoInc)
 * @param  pointer to auto Increment state
 * @retval Error code
 */
-int8_t PADS_getAutoIncrementState(PADS_state_t *inc)
+int8_t PADS_getAutoIncrementState(we_dev_t *dev, PADS_state_t *inc)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*inc = (PADS_state_t)ctrl_reg_2.autoAddIncr;
 
@@ -264,18 +297,21 @@ int8_t PADS_getAutoIncrementState(PADS_state_t *inc)
 * @param  reboot state
 * @retval Error code
 */
-int8_t PADS_rebootMemory(PADS_state_t reboot)
+int8_t PADS_rebootMemory(we_dev_t *dev, PADS_state_t reboot)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.boot = reboot;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
+	/* all registers are reloaded with their default values */
+	RegCacheInvalidate(dev);
+
 	return WE_SUCCESS;
 }
 
@@ -284,11 +320,11 @@ int8_t PADS_rebootMemory(PADS_state_t reboot)
 * @param  Pointer to reboot memory state
 * @retval Error code
 */
-int8_t PADS_getRebootMemoryState(PADS_state_t *reboot)
+int8_t PADS_getRebootMemoryState(we_dev_t *dev, PADS_state_t *reboot)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*reboot = (PADS_state_t)ctrl_reg_2.boot;
 
@@ -300,11 +336,11 @@ int8_t PADS_getRebootMemoryState(PADS_state_t *reboot)
 * @param  Pointer to Boot state
 * @retval Error code
 */
-int8_t PADS_getBootStatus(PADS_state_t *boot)
+int8_t PADS_getBootStatus(we_dev_t *dev, PADS_state_t *boot)
 {
 	PADS_intSource_t int_source_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source_reg))
 	return WE_FAIL;
 	*boot = (PADS_state_t)int_source_reg.bootOn;
 
@@ -316,16 +352,16 @@ int8_t PADS_getBootStatus(PADS_state_t *boot)
 * @param  active level
 * @retval Error code
 */
-int8_t PADS_setIntActiveLevel(PADS_interrupt_level_t intLvl)
+int8_t PADS_setIntActiveLevel(we_dev_t *dev, PADS_interrupt_level_t intLvl)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.intActiveLevel = intLvl;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -336,11 +372,11 @@ int8_t PADS_setIntActiveLevel(PADS_interrupt_level_t intLvl)
 * @param  Pointer to Interrupt active level
 * @retval Error code
 */
-int8_t PADS_getIntActiveLevel(PADS_interrupt_level_t *intLvl)
+int8_t PADS_getIntActiveLevel(we_dev_t *dev, PADS_interrupt_level_t *intLvl)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*intLvl = (PADS_interrupt_level_t)ctrl_reg_2.intActiveLevel;
 
@@ -352,16 +388,16 @@ int8_t PADS_getIntActiveLevel(PADS_interrupt_level_t *intLvl)
 * @param  pin type
 * @retval Error code
 */
-int8_t PADS_setIntPinType(PADS_interrupt_pin_t intr)
+int8_t PADS_setIntPinType(we_dev_t *dev, PADS_interrupt_pin_t intr)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.openDrainOnINTpin = intr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -372,11 +408,11 @@ int8_t PADS_setIntPinType(PADS_interrupt_pin_t intr)
 * @param  pointer to interrupt pin type
 * @retval Error code
 */
-int8_t PADS_getIntPinType(PADS_interrupt_pin_t *intr)
+int8_t PADS_getIntPinType(we_dev_t *dev, PADS_interrupt_pin_t *intr)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*intr = (PADS_interrupt_pin_t)ctrl_reg_2.openDrainOnINTpin;
 
@@ -388,16 +424,16 @@ int8_t PADS_getIntPinType(PADS_interrupt_pin_t *intr)
 * @param  mode
 * @retval Error code
 */
-int8_t PADS_setSingleConvMode(PADS_state_t mode)
+int8_t PADS_setSingleConvMode(we_dev_t *dev, PADS_state_t mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.oneShotbit = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -408,11 +444,11 @@ int8_t PADS_setSingleConvMode(PADS_state_t mode)
 * @param  Pointer to Single Conversion Mode state
 * @retval Error code
 */
-int8_t PADS_getSingleConvModeState(PADS_state_t *mode)
+int8_t PADS_getSingleConvModeState(we_dev_t *dev, PADS_state_t *mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*mode = (PADS_state_t)ctrl_reg_2.oneShotbit;
 
@@ -424,18 +460,21 @@ int8_t PADS_getSingleConvModeState(PADS_state_t *mode)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setSwreset(PADS_state_t mode)
+int8_t PADS_setSwreset(we_dev_t *dev, PADS_state_t mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
 	ctrl_reg_2.softwareReset = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 
+	/* all registers are reloaded with their default values */
+	RegCacheInvalidate(dev);
+
 	return WE_SUCCESS;
 }
 
@@ -444,11 +483,11 @@ int8_t PADS_setSwreset(PADS_state_t mode)
 * @param  Pointer to software reset state
 * @retval Error code
 */
-int8_t PADS_getSwresetState(PADS_state_t *mode)
+int8_t PADS_getSwresetState(we_dev_t *dev, PADS_state_t *mode)
 {
 	PADS_ctrl_2_t ctrl_reg_2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_2_REG, 1, (uint8_t *)&ctrl_reg_2))
 	return WE_FAIL;
 	*mode = (PADS_state_t)ctrl_reg_2.softwareReset;
 
@@ -460,16 +499,16 @@ int8_t PADS_getSwresetState(PADS_state_t *mode)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setFifoFullInt(PADS_state_t fullState)
+int8_t PADS_setFifoFullInt(we_dev_t *dev, PADS_state_t fullState)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.fifoFullInt = fullState;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -480,17 +519,17 @@ int8_t PADS_setFifoFullInt(PADS_state_t fullState)
 * @param  state
 * @retval Error code [Error,NoError]
 */
-int8_t PADS_setFifoWtmInt(PADS_state_t WtmState)
+int8_t PADS_setFifoWtmInt(we_dev_t *dev, PADS_state_t WtmState)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.fifoThresholdInt = WtmState;
 
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -501,16 +540,16 @@ int8_t PADS_setFifoWtmInt(PADS_state_t WtmState)
 * @param  a variable , its Type is state
 * @retval Error code [Error,NoError]
 */
-int8_t PADS_setFifoOvrInterrupt(PADS_state_t OvrState)
+int8_t PADS_setFifoOvrInterrupt(we_dev_t *dev, PADS_state_t OvrState)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.fifoOverrunInt = OvrState;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -521,11 +560,11 @@ int8_t PADS_setFifoOvrInterrupt(PADS_state_t OvrState)
 * @param  Point to fifo full state
 * @retval Error code
 */
-int8_t PADS_getFifoFullState(PADS_state_t *fifoFull)
+int8_t PADS_getFifoFullState(we_dev_t *dev, PADS_state_t *fifoFull)
 {
 	PADS_fifo_status2_t fifo_status2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
 	return WE_FAIL;
 	*fifoFull = (PADS_state_t)fifo_status2.fifoFull;
 
@@ -537,11 +576,11 @@ int8_t PADS_getFifoFullState(PADS_state_t *fifoFull)
 * @param  Pointer to Fifo threshold level state
 * @retval Error code
 */
-int8_t PADS_getFifoWtmState(PADS_state_t *fifoWtm)
+int8_t PADS_getFifoWtmState(we_dev_t *dev, PADS_state_t *fifoWtm)
 {
 	PADS_fifo_status2_t fifo_status2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
 	return WE_FAIL;
 	*fifoWtm = (PADS_state_t)fifo_status2.fifoWtm;
 
@@ -553,11 +592,11 @@ int8_t PADS_getFifoWtmState(PADS_state_t *fifoWtm)
 * @param  Pointer to fifo overrun state
 * @retval Error code
 */
-int8_t PADS_getFifoOvrState(PADS_state_t *fifoOvr)
+int8_t PADS_getFifoOvrState(we_dev_t *dev, PADS_state_t *fifoOvr)
 {
 	PADS_fifo_status2_t fifo_status2;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_STATUS2_REG, 1, (uint8_t *)&fifo_status2))
 	return WE_FAIL;
 
 	*fifoOvr = (PADS_state_t)fifo_status2.fifoOverrun;
@@ -570,18 +609,18 @@ int8_t PADS_getFifoOvrState(PADS_state_t *fifoOvr)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setDrdyInt(PADS_state_t DRDYStatus)
+int8_t PADS_setDrdyInt(we_dev_t *dev, PADS_state_t DRDYStatus)
 {
 
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.dataReadyInt = DRDYStatus;
 
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -592,11 +631,11 @@ int8_t PADS_setDrdyInt(PADS_state_t DRDYStatus)
 * @param  Pointer to Data-ready signal interrupt state
 * @retval Error code
 */
-int8_t PADS_getDrdyIntState(PADS_state_t *drdy)
+int8_t PADS_getDrdyIntState(we_dev_t *dev, PADS_state_t *drdy)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 	*drdy = (PADS_state_t)ctrl_reg_3.dataReadyInt;
 
@@ -608,17 +647,17 @@ int8_t PADS_getDrdyIntState(PADS_state_t *drdy)
 * @param  event
 * @retval Error code
 */
-int8_t PADS_setIntEventCtrl(PADS_interrupt_event_t ctr)
+int8_t PADS_setIntEventCtrl(we_dev_t *dev, PADS_interrupt_event_t ctr)
 {
 
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	ctrl_reg_3.intEventCtrl = ctr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -629,11 +668,11 @@ int8_t PADS_setIntEventCtrl(PADS_interrupt_event_t ctr)
 * @param  Pointer to Interrupt control event
 * @retval Error code
 */
-int8_t PADS_getIntEventCtrlState(PADS_interrupt_event_t *intEvent)
+int8_t PADS_getIntEventCtrlState(we_dev_t *dev, PADS_interrupt_event_t *intEvent)
 {
 	PADS_ctrl_3_t ctrl_reg_3;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_CTRL_3_REG, 1, (uint8_t *)&ctrl_reg_3))
 	return WE_FAIL;
 	*intEvent = (PADS_interrupt_event_t)ctrl_reg_3.intEventCtrl;
 
@@ -646,11 +685,11 @@ int8_t PADS_getIntEventCtrlState(PADS_interrupt_event_t *intEvent)
 * @param  pointer to temperature data State
 * @retval error code
 */
-int8_t PADS_getTempStatus(PADS_state_t *state)
+int8_t PADS_getTempStatus(we_dev_t *dev, PADS_state_t *state)
 {
 	PADS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	*state = (PADS_state_t)status_reg.tempDataAvailable;
 
@@ -662,11 +701,11 @@ int8_t PADS_getTempStatus(PADS_state_t *state)
 * @param  pointer to pressure data State
 * @retval error code
 */
-int8_t PADS_getPresStatus(PADS_state_t *state)
+int8_t PADS_getPresStatus(we_dev_t *dev, PADS_state_t *state)
 {
 	PADS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	*state = (PADS_state_t)status_reg.presDataAvailable;
 
@@ -678,11 +717,11 @@ int8_t PADS_getPresStatus(PADS_state_t *state)
 * @param  Pointer to temperature overwritten State
 * @retval Error code
 */
-int8_t PADS_getTemperOverrunStatus(PADS_state_t *state)
+int8_t PADS_getTemperOverrunStatus(we_dev_t *dev, PADS_state_t *state)
 {
 	PADS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	*state = (PADS_state_t)status_reg.tempDataOverrun;
 
@@ -694,11 +733,11 @@ int8_t PADS_getTemperOverrunStatus(PADS_state_t *state)
 * @param  Pointer to pressure overwritten State
 * @retval Error code
 */
-int8_t PADS_getPressureOverrunStatus(PADS_state_t *state)
+int8_t PADS_getPressureOverrunStatus(we_dev_t *dev, PADS_state_t *state)
 {
 	PADS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	*state = (PADS_state_t)status_reg.presDataOverrun;
 
@@ -710,17 +749,17 @@ int8_t PADS_getPressureOverrunStatus(PADS_state_t *state)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setAutoRefp(PADS_state_t autorep)
+int8_t PADS_setAutoRefp(we_dev_t *dev, PADS_state_t autorep)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.autoRefp = autorep;
 
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -731,11 +770,11 @@ int8_t PADS_setAutoRefp(PADS_state_t autorep)
 * @param  pointer to autorefp function state
 * @retval Error code
 */
-int8_t PADS_getAutoRefpState(PADS_state_t *autoRefp)
+int8_t PADS_getAutoRefpState(we_dev_t *dev, PADS_state_t *autoRefp)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*autoRefp = (PADS_state_t)interrupt_Configuration_reg.autoRefp;
 	return WE_SUCCESS;
@@ -747,16 +786,16 @@ int8_t PADS_getAutoRefpState(PADS_state_t *autoRefp)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_resetAutoRefp(PADS_state_t autorep)
+int8_t PADS_resetAutoRefp(we_dev_t *dev, PADS_state_t autorep)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.resetAutoRefp = autorep;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -768,16 +807,16 @@ int8_t PADS_resetAutoRefp(PADS_state_t autorep)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setAutoZeroFunction(PADS_state_t autozero)
+int8_t PADS_setAutoZeroFunction(we_dev_t *dev, PADS_state_t autozero)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.autoZeroFunc = autozero;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -788,11 +827,11 @@ int8_t PADS_setAutoZeroFunction(PADS_state_t autozero)
 * @param  pointer to autozero function state
 * @retval Error code
 */
-int8_t PADS_getAutoZeroState(PADS_state_t *autoZero)
+int8_t PADS_getAutoZeroState(we_dev_t *dev, PADS_state_t *autoZero)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*autoZero = (PADS_state_t)interrupt_Configuration_reg.autoZeroFunc;
 	return WE_SUCCESS;
@@ -803,16 +842,16 @@ int8_t PADS_getAutoZeroState(PADS_state_t *autoZero)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_resetAutoZeroFunction(PADS_state_t autozeroRst)
+int8_t PADS_resetAutoZeroFunction(we_dev_t *dev, PADS_state_t autozeroRst)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.resetAutoZeroFunc = autozeroRst;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -823,16 +862,16 @@ int8_t PADS_resetAutoZeroFunction(PADS_state_t autozeroRst)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setDiffPresInt(PADS_state_t diffEn)
+int8_t PADS_setDiffPresInt(we_dev_t *dev, PADS_state_t diffEn)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.diffInt = diffEn;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -844,11 +883,11 @@ int8_t PADS_setDiffPresInt(PADS_state_t diffEn)
 * @param  pointer to differential interrupt state
 * @retval Error code
 */
-int8_t PADS_getDiffPresIntState(PADS_state_t *diffIntState)
+int8_t PADS_getDiffPresIntState(we_dev_t *dev, PADS_state_t *diffIntState)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*diffIntState = (PADS_state_t)interrupt_Configuration_reg.diffInt;
 	return WE_SUCCESS;
@@ -859,16 +898,16 @@ int8_t PADS_getDiffPresIntState(PADS_state_t *diffIntState)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setLatchInt(PADS_state_t state)
+int8_t PADS_setLatchInt(we_dev_t *dev, PADS_state_t state)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.latchedInt = state;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -879,11 +918,11 @@ int8_t PADS_setLatchInt(PADS_state_t state)
 * @param  Pointer to latch Interrupt state
 * @retval Error code
 */
-int8_t PADS_getLatchIntState(PADS_state_t *latchInt)
+int8_t PADS_getLatchIntState(we_dev_t *dev, PADS_state_t *latchInt)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*latchInt = (PADS_state_t)interrupt_Configuration_reg.latchedInt;
 	return WE_SUCCESS;
@@ -894,16 +933,16 @@ int8_t PADS_getLatchIntState(PADS_state_t *latchInt)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setLowPresInt(PADS_state_t state)
+int8_t PADS_setLowPresInt(we_dev_t *dev, PADS_state_t state)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.lowPresInt = state;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -914,11 +953,11 @@ int8_t PADS_setLowPresInt(PADS_state_t state)
 * @param  Pointer to state of the interrupt on pressure low event
 * @retval Error code
 */
-int8_t PADS_getLowPresIntState(PADS_state_t *lpint)
+int8_t PADS_getLowPresIntState(we_dev_t *dev, PADS_state_t *lpint)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*lpint = (PADS_state_t)interrupt_Configuration_reg.lowPresInt;
 	return WE_SUCCESS;
@@ -929,16 +968,16 @@ int8_t PADS_getLowPresIntState(PADS_state_t *lpint)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setHighPresInt(PADS_state_t state)
+int8_t PADS_setHighPresInt(we_dev_t *dev, PADS_state_t state)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	interrupt_Configuration_reg.highPresInt = state;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -949,11 +988,11 @@ int8_t PADS_setHighPresInt(PADS_state_t state)
 * @param  Pointer to state of the interrupt on pressure High event
 * @retval Error code
 */
-int8_t PADS_getHighPresIntState(PADS_state_t *hpint)
+int8_t PADS_getHighPresIntState(we_dev_t *dev, PADS_state_t *hpint)
 {
 	PADS_interrupt_configuration_t interrupt_Configuration_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_CFG_REG, 1, (uint8_t *)&interrupt_Configuration_reg))
 	return WE_FAIL;
 	*hpint = (PADS_state_t)interrupt_Configuration_reg.highPresInt;
 	return WE_SUCCESS;
@@ -966,11 +1005,11 @@ int8_t PADS_getHighPresIntState(PADS_state_t *hpint)
 * @retval Error code
 */
 
-int8_t PADS_setPresThrLSB(uint8_t thr)
+int8_t PADS_setPresThrLSB(we_dev_t *dev, uint8_t thr)
 {
 	uint8_t thresholdLSB = thr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_THR_P_L_REG, 1, &thresholdLSB))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_THR_P_L_REG, 1, &thresholdLSB))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -981,11 +1020,11 @@ int8_t PADS_setPresThrLSB(uint8_t thr)
 * @param  value
 * @retval Error code
 */
-int8_t PADS_setPresThrMSB(uint8_t thr)
+int8_t PADS_setPresThrMSB(we_dev_t *dev, uint8_t thr)
 {
 	uint8_t thresholdMSB = thr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_THR_P_H_REG, 1, &thresholdMSB))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_THR_P_H_REG, 1, &thresholdMSB))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -996,9 +1035,9 @@ int8_t PADS_setPresThrMSB(uint8_t thr)
 * @param  Pointer to store threshold pressure LSB value
 * @retval Error code
 */
-int8_t PADS_getPresThrLSB(uint8_t *thrLSB)
+int8_t PADS_getPresThrLSB(we_dev_t *dev, uint8_t *thrLSB)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_THR_P_L_REG, 1, thrLSB))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_THR_P_L_REG, 1, thrLSB))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1009,9 +1048,9 @@ int8_t PADS_getPresThrLSB(uint8_t *thrLSB)
 * @param  Pointer to threshold pressure MSB value
 * @retval Error code
 */
-int8_t PADS_getPresThrMSB(uint8_t *thrMSB)
+int8_t PADS_getPresThrMSB(we_dev_t *dev, uint8_t *thrMSB)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_THR_P_H_REG, 1, thrMSB))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_THR_P_H_REG, 1, thrMSB))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1022,16 +1061,16 @@ int8_t PADS_getPresThrMSB(uint8_t *thrMSB)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_disI2C(PADS_state_t I2CStatus)
+int8_t PADS_disI2C(we_dev_t *dev, PADS_state_t I2CStatus)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	interface_ctrl.disableI2C = I2CStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1042,11 +1081,11 @@ int8_t PADS_disI2C(PADS_state_t I2CStatus)
 * @param  Pointer to I2C interface state
 * @retval Error code
 */
-int8_t PADS_getI2CState(PADS_state_t *i2cState)
+int8_t PADS_getI2CState(we_dev_t *dev, PADS_state_t *i2cState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 	*i2cState = (PADS_state_t)interface_ctrl.disableI2C;
 	return WE_SUCCESS;
@@ -1058,15 +1097,15 @@ int8_t PADS_getI2CState(PADS_state_t *i2cState)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_disPullDownIntPin(PADS_state_t pullDownState)
+int8_t PADS_disPullDownIntPin(we_dev_t *dev, PADS_state_t pullDownState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	interface_ctrl.disPullDownOnIntPin = pullDownState;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1077,11 +1116,11 @@ int8_t PADS_disPullDownIntPin(PADS_state_t pullDownState)
 * @param  Pointer to state of the pull down on the interrupt pin
 * @retval Error code
 */
-int8_t PADS_getPullDownIntPinState(PADS_state_t *pinState)
+int8_t PADS_getPullDownIntPinState(we_dev_t *dev, PADS_state_t *pinState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 	*pinState = (PADS_state_t)interface_ctrl.disPullDownOnIntPin;
 
@@ -1094,15 +1133,15 @@ int8_t PADS_getPullDownIntPinState(PADS_state_t *pinState)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setSAOPullUp(PADS_state_t SaoStatus)
+int8_t PADS_setSAOPullUp(we_dev_t *dev, PADS_state_t SaoStatus)
 {
 	PADS_interface_ctrl_t interface_ctrl;
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	interface_ctrl.pullUpOnSAOpin = SaoStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1113,11 +1152,11 @@ int8_t PADS_setSAOPullUp(PADS_state_t SaoStatus)
 * @param  pointer to state of the pull up on the SAO pin
 * @retval Error code
 */
-int8_t PADS_getSAOPullUpState(PADS_state_t *saoPinState)
+int8_t PADS_getSAOPullUpState(we_dev_t *dev, PADS_state_t *saoPinState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 	*saoPinState = (PADS_state_t)interface_ctrl.pullUpOnSAOpin;
 
@@ -1129,15 +1168,15 @@ int8_t PADS_getSAOPullUpState(PADS_state_t *saoPinState)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setSDAPullUp(PADS_state_t SdaStatus)
+int8_t PADS_setSDAPullUp(we_dev_t *dev, PADS_state_t SdaStatus)
 {
 	PADS_interface_ctrl_t interface_ctrl;
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	interface_ctrl.pullUpOnSDApin = SdaStatus;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1148,11 +1187,11 @@ int8_t PADS_setSDAPullUp(PADS_state_t SdaStatus)
 * @param  state of the pull up on the SDA pin
 * @retval Error code
 */
-int8_t PADS_getSDAPullUpState(PADS_state_t *sdaPinState)
+int8_t PADS_getSDAPullUpState(we_dev_t *dev, PADS_state_t *sdaPinState)
 {
 	PADS_interface_ctrl_t interface_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INTERFACE_CTRL_REG, 1, (uint8_t *)&interface_ctrl))
 	return WE_FAIL;
 	*sdaPinState = (PADS_state_t)interface_ctrl.pullUpOnSDApin;
 
@@ -1164,16 +1203,16 @@ int8_t PADS_getSDAPullUpState(PADS_state_t *sdaPinState)
 * @param  config
 * @retval Error code
 */
-int8_t PADS_setFifoMode(PADS_fifo_mode_t fifoMode)
+int8_t PADS_setFifoMode(we_dev_t *dev, PADS_fifo_mode_t fifoMode)
 {
 	PADS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	fifo_ctrl_reg.fifoMode = fifoMode;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1184,11 +1223,11 @@ int8_t PADS_setFifoMode(PADS_fifo_mode_t fifoMode)
 * @param  Pointer to Fifo mode Configuration
 * @retval Error code
 */
-int8_t PADS_getFifoMode(PADS_fifo_mode_t *fifoMode)
+int8_t PADS_getFifoMode(we_dev_t *dev, PADS_fifo_mode_t *fifoMode)
 {
 	PADS_fifo_ctrl_t fifo_ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl_reg))
 	return WE_FAIL;
 	*fifoMode = (PADS_fifo_mode_t)fifo_ctrl_reg.fifoMode;
 
@@ -1201,16 +1240,16 @@ int8_t PADS_getFifoMode(PADS_fifo_mode_t *fifoMode)
 * @param  state
 * @retval Error code
 */
-int8_t PADS_setStopOnThr(PADS_state_t state)
+int8_t PADS_setStopOnThr(we_dev_t *dev, PADS_state_t state)
 {
 	PADS_fifo_ctrl_t fifo_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
 	return WE_FAIL;
 
 	fifo_ctrl.stopOnThreshold = state;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1221,11 +1260,11 @@ int8_t PADS_setStopOnThr(PADS_state_t state)
 * @param  Pointer to state of the StopOnThresholLevel
 * @retval Error code
 */
-int8_t PADS_getStopOnThrStatus(PADS_state_t *state)
+int8_t PADS_getStopOnThrStatus(we_dev_t *dev, PADS_state_t *state)
 {
 	PADS_fifo_ctrl_t fifo_ctrl;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_CTRL_REG, 1, (uint8_t *)&fifo_ctrl))
 	return WE_FAIL;
 	*state = (PADS_state_t)fifo_ctrl.stopOnThreshold;
 
@@ -1238,16 +1277,16 @@ int8_t PADS_getStopOnThrStatus(PADS_state_t *state)
 * @param  level
 * @retval Error code
 */
-int8_t PADS_setFifoThr(uint8_t fifoThr)
+int8_t PADS_setFifoThr(we_dev_t *dev, uint8_t fifoThr)
 {
 	PADS_fifo_wtm_t fifo_wtm;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
 	return WE_FAIL;
 
 	fifo_wtm.fifoThreshold = fifoThr;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1258,11 +1297,11 @@ int8_t PADS_setFifoThr(uint8_t fifoThr)
 * @param  pointer to fifo threshold level
 * @retval Error code
 */
-int8_t PADS_getFifoThr(uint8_t *fifoThr)
+int8_t PADS_getFifoThr(we_dev_t *dev, uint8_t *fifoThr)
 {
 	PADS_fifo_wtm_t fifo_wtm;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_WTM_REG, 1, (uint8_t *)&fifo_wtm))
 	return WE_FAIL;
 	*fifoThr = (uint8_t)fifo_wtm.fifoThreshold;
 
@@ -1274,11 +1313,11 @@ int8_t PADS_getFifoThr(uint8_t *fifoThr)
 * @param  Pointer to fifo filling level
 * @retval Error code
 */
-int8_t PADS_getFifoFillLevel(uint8_t *fifoLevel)
+int8_t PADS_getFifoFillLevel(we_dev_t *dev, uint8_t *fifoLevel)
 {
 	;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_STATUS1_REG, 1, fifoLevel))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_STATUS1_REG, 1, fifoLevel))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1289,9 +1328,9 @@ int8_t PADS_getFifoFillLevel(uint8_t *fifoLevel)
 * @param  Pointer to LSB pressure reference value
 * @retval Error code
 */
-int8_t PADS_getPresRefLSB(uint8_t *lowReferenceValue)
+int8_t PADS_getPresRefLSB(we_dev_t *dev, uint8_t *lowReferenceValue)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_REF_P_H_REG, 1, lowReferenceValue))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_REF_P_H_REG, 1, lowReferenceValue))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1302,9 +1341,9 @@ int8_t PADS_getPresRefLSB(uint8_t *lowReferenceValue)
 * @param  Pointer to MSB pressure reference value
 * @retval Error code
 */
-int8_t PADS_getPresRefMSB(uint8_t *highReferenceValue)
+int8_t PADS_getPresRefMSB(we_dev_t *dev, uint8_t *highReferenceValue)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_REF_P_H_REG, 1, highReferenceValue))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_REF_P_H_REG, 1, highReferenceValue))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1316,11 +1355,11 @@ int8_t PADS_getPresRefMSB(uint8_t *highReferenceValue)
 * @param  a variable,its Type is uint8_t
 * @retval Error code
 */
-int8_t PADS_setPresOffsetLSB(uint8_t offSet)
+int8_t PADS_setPresOffsetLSB(we_dev_t *dev, uint8_t offSet)
 {
 	uint8_t pressureOffsetLsb = offSet;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_OPC_P_L_REG, 1, &pressureOffsetLsb))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_OPC_P_L_REG, 1, &pressureOffsetLsb))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1331,10 +1370,10 @@ int8_t PADS_setPresOffsetLSB(uint8_t offSet)
 * @param  Pointer to LSB part of the pressure offset value
 * @retval Error code
 */
-int8_t PADS_getPresOffsetLSB(uint8_t *offSet)
+int8_t PADS_getPresOffsetLSB(we_dev_t *dev, uint8_t *offSet)
 {
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_OPC_P_L_REG, 1, offSet))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_OPC_P_L_REG, 1, offSet))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1345,11 +1384,11 @@ int8_t PADS_getPresOffsetLSB(uint8_t *offSet)
 * @param  a variable,its Type is uint8_t
 * @retval Error code [Error,NoError]
 */
-int8_t PADS_setPresOffsetMSB(uint8_t highPresureOffsetValue)
+int8_t PADS_setPresOffsetMSB(we_dev_t *dev, uint8_t highPresureOffsetValue)
 {
 	uint8_t pressureOffsetMsb = highPresureOffsetValue;
 
-	if (WE_FAIL == WriteReg((uint8_t)PADS_OPC_P_H_REG, 1, &pressureOffsetMsb))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_OPC_P_H_REG, 1, &pressureOffsetMsb))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1360,9 +1399,9 @@ int8_t PADS_setPresOffsetMSB(uint8_t highPresureOffsetValue)
 * @param  Pointer to MSB part of the pressure offset value
 * @retval Error code
 */
-int8_t PADS_getPresOffsetMSB(uint8_t *offSet)
+int8_t PADS_getPresOffsetMSB(we_dev_t *dev, uint8_t *offSet)
 {
-	if (WE_FAIL == ReadReg((uint8_t)PADS_OPC_P_H_REG, 1, offSet))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_OPC_P_H_REG, 1, offSet))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -1373,11 +1412,11 @@ int8_t PADS_getPresOffsetMSB(uint8_t *offSet)
 * @param  pointer to state of the interrupt generation
 * @retval Error code
 */
-int8_t PADS_getIntStatus(PADS_state_t *intState)
+int8_t PADS_getIntStatus(we_dev_t *dev, PADS_state_t *intState)
 {
 	PADS_intSource_t int_source;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
 	return WE_FAIL;
 	*intState = (PADS_state_t)int_source.intStatus;
 
@@ -1389,11 +1428,11 @@ int8_t PADS_getIntStatus(PADS_state_t *intState)
 * @param  Pointer to state of the differential low pressure interrupt
 * @retval Error code
 */
-int8_t PADS_getLowPresIntStatus(PADS_state_t *lpState)
+int8_t PADS_getLowPresIntStatus(we_dev_t *dev, PADS_state_t *lpState)
 {
 	PADS_intSource_t int_source;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
 	return WE_FAIL;
 	*lpState = (PADS_state_t)int_source.diffPresLowEvent;
 
@@ -1405,11 +1444,11 @@ int8_t PADS_getLowPresIntStatus(PADS_state_t *lpState)
 * @param  Pointer to state of the differential high pressure interrupt
 * @retval No error
 */
-int8_t PADS_getHighPresIntStatus(PADS_state_t *hpState)
+int8_t PADS_getHighPresIntStatus(we_dev_t *dev, PADS_state_t *hpState)
 {
 	PADS_intSource_t int_source;
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_INT_SOURCE_REG, 1, (uint8_t *)&int_source))
 	return WE_FAIL;
 	*hpState = int_source.diffPresHighEvent;
 
@@ -1421,11 +1460,11 @@ int8_t PADS_getHighPresIntStatus(PADS_state_t *hpState)
 * @param  Pointer to Pressure Measurement
 * @retval Error code
 */
-int8_t PADS_getRAWPressure(int32_t *rawPres)
+int8_t PADS_getRAWPressure(we_dev_t *dev, int32_t *rawPres)
 {
 	uint8_t tmp[3] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_DATA_P_XL_REG, 3, tmp))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_DATA_P_XL_REG, 3, tmp))
 	return WE_FAIL;
 
 	*rawPres = (int32_t)(tmp[2] << 16);
@@ -1442,10 +1481,10 @@ int8_t PADS_getRAWPressure(int32_t *rawPres)
 * @param  pointer to Pressure Measurement
 * @retval Error code
 */
-int8_t PADS_getPressure(float *presskPa)
+int8_t PADS_getPressure(we_dev_t *dev, float *presskPa)
 {
 	int32_t rawPressure = 0;
-	if(PADS_getRAWPressure(&rawPressure) == WE_SUCCESS)
+	if(PADS_getRAWPressure(dev, &rawPressure) == WE_SUCCESS)
 	{
 		*presskPa = (float)rawPressure;
 		*presskPa = *presskPa/40960;
@@ -1463,11 +1502,11 @@ int8_t PADS_getPressure(float *presskPa)
 * @param  pointer to Temperature Measurement
 * @retval Error code
 */
-int8_t PADS_getRAWTemperature(int16_t *rawTemp)
+int8_t PADS_getRAWTemperature(we_dev_t *dev, int16_t *rawTemp)
 {
 	uint8_t tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_DATA_T_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_DATA_T_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	*rawTemp = (int16_t)(tmp[1] << 8);
@@ -1481,10 +1520,10 @@ int8_t PADS_getRAWTemperature(int16_t *rawTemp)
 * @param  Pointer to Temperature Measurement
 * @retval Error code
 */
-int8_t PADS_getTemperature(float *tempdegC)
+int8_t PADS_getTemperature(we_dev_t *dev, float *tempdegC)
 {
 	int16_t rawTemp = 0;
-	if(PADS_getRAWTemperature(&rawTemp) == WE_SUCCESS)
+	if(PADS_getRAWTemperature(dev, &rawTemp) == WE_SUCCESS)
 	{
 		*tempdegC = (float)rawTemp;
 		*tempdegC = *tempdegC / 100;
@@ -1497,16 +1536,73 @@ int8_t PADS_getTemperature(float *tempdegC)
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Read the raw pressure and temperature values in a single burst
+*         DATA_P_XL .. DATA_T_H are consecutive; with a state pointer the burst starts one register earlier
+*         at STATUS, i.e. the data available flags are read in the same transfer, before reading the outputs clears them.
+* @param  Pointer to the raw values, only updated if both are new when a state pointer is given
+* @param  Pointer to the data state: PADS_enable if both values were new (P_DA and T_DA set), NULL: read unconditionally
+* @retval Error code
+*/
+int8_t PADS_getRAWPressureAndTemperature(we_dev_t *dev, PADS_raw_data_t *raw, PADS_state_t *newData)
+{
+	uint8_t tmp[6] = { 0 };
+	uint8_t *data = &tmp[1];
+	PADS_status_t *status_reg = (PADS_status_t *)&tmp[0];
+
+	if (newData != NULL)
+	{
+		if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_STATUS_REG, 6, tmp))
+		return WE_FAIL;
+
+		*newData = (status_reg->presDataAvailable && status_reg->tempDataAvailable) ? PADS_enable : PADS_disable;
+		if (*newData == PADS_disable)
+		return WE_SUCCESS;
+	}
+	else
+	{
+		if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_DATA_P_XL_REG, 5, data))
+		return WE_FAIL;
+	}
+
+	raw->pressure = (int32_t)(((uint32_t)data[2] << 16) | ((uint32_t)data[1] << 8) | data[0]);
+	raw->temperature = (int16_t)((data[4] << 8) | data[3]);
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read the pressure in kPa and the temperature in °C in a single burst
+* @param  Pointer to Pressure Measurement, only updated if new when a state pointer is given
+* @param  Pointer to Temperature Measurement, only updated if new when a state pointer is given
+* @param  Pointer to the data state, see PADS_getRAWPressureAndTemperature(), may be NULL
+* @retval Error code
+*/
+int8_t PADS_getPressureAndTemperature(we_dev_t *dev, float *presskPa, float *tempdegC, PADS_state_t *newData)
+{
+	PADS_raw_data_t raw;
+
+	if (WE_FAIL == PADS_getRAWPressureAndTemperature(dev, &raw, newData))
+	return WE_FAIL;
+
+	if ((newData != NULL) && (*newData == PADS_disable))
+	return WE_SUCCESS;
+
+	*presskPa = (float)raw.pressure / 40960;
+	*tempdegC = (float)raw.temperature / 100;
+	return WE_SUCCESS;
+}
+
 /**
 * @brief  Read the raw pressure value from Fifo
 * @param  Pointer to Fifo Pressure Measurement
 * @retval Error code
 */
-int8_t PADS_getFifoRAWPressure(int32_t *rawPres)
+int8_t PADS_getFifoRAWPressure(we_dev_t *dev, int32_t *rawPres)
 {
 	uint8_t tmp[3] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_DATA_P_XL_REG, 3, tmp))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_DATA_P_XL_REG, 3, tmp))
 	return WE_FAIL;
 
 	*rawPres = (int32_t)(tmp[2] << 16);
@@ -1520,10 +1616,10 @@ int8_t PADS_getFifoRAWPressure(int32_t *rawPres)
 * @param  Pointer to Fifo Pressure Measurement
 * @retval Error code
 */
-int8_t PADS_getFifoPressure(float *presskPa)
+int8_t PADS_getFifoPressure(we_dev_t *dev, float *presskPa)
 {
 	int32_t rawPressure = 0;
-	if(PADS_getFifoRAWPressure(&rawPressure) == WE_SUCCESS)
+	if(PADS_getFifoRAWPressure(dev, &rawPressure) == WE_SUCCESS)
 	{
 		*presskPa = (float)rawPressure;
 		*presskPa = *presskPa/40960;
@@ -1541,11 +1637,11 @@ int8_t PADS_getFifoPressure(float *presskPa)
 * @param  Pointer to Fifo Temperature Measurement
 * @retval Error code
 */
-int8_t PADS_getFifoRAWTemperature(int16_t *rawTemp)
+int8_t PADS_getFifoRAWTemperature(we_dev_t *dev, int16_t *rawTemp)
 {
 	uint8_t tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)PADS_FIFO_DATA_T_L_REG, 2, tmp))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_DATA_T_L_REG, 2, tmp))
 	return WE_FAIL;
 
 	*rawTemp = (int16_t)(tmp[1] << 8);
@@ -1559,11 +1655,11 @@ int8_t PADS_getFifoRAWTemperature(int16_t *rawTemp)
 * @param  Pointer to Fifo Temperature Measurement
 * @retval error code
 */
-int8_t PADS_getFifoTemperature(float *tempdegC)
+int8_t PADS_getFifoTemperature(we_dev_t *dev, float *tempdegC)
 {
 
 	int16_t rawTemp = 0;
-	if(PADS_getFifoRAWTemperature(&rawTemp) == WE_SUCCESS)
+	if(PADS_getFifoRAWTemperature(dev, &rawTemp) == WE_SUCCESS)
 	{
 		*tempdegC = (float)rawTemp;
 		*tempdegC = *tempdegC / 100;
@@ -1576,4 +1672,345 @@ int8_t PADS_getFifoTemperature(float *tempdegC)
 	return WE_SUCCESS;
 }
 
+/**
+* @brief  Drain the FIFO
+*         Reads FIFO_STATUS1 and FIFO_STATUS2 once and then up to maxSamples pressure and temperature samples,
+*         oldest first, in a single burst from FIFO_DATA_P_XL: with the address auto increment on (CTRL_2 IF_ADD_INC),
+*         the address rolls over from FIFO_DATA_T_H to FIFO_DATA_P_XL, so every 5 bytes are the next sample.
+*         Samples beyond maxSamples stay in the FIFO.
+* @param  Buffer for the raw samples
+* @param  Maximum number of samples to read, size of the buffer
+* @param  Pointer to the number of samples read
+* @param  Pointer to the FIFO watermark state before the drain (PADS_enable: level >= threshold), may be NULL
+* @param  Pointer to the FIFO overrun state before the drain (PADS_enable: samples have been lost), may be NULL
+* @retval Error code
+*/
+int8_t PADS_readFifo(we_dev_t *dev, PADS_raw_data_t *buffer, uint8_t maxSamples, uint8_t *count, PADS_state_t *watermark, PADS_state_t *overrun)
+{
+	uint8_t status[2];
+	PADS_fifo_status2_t *fifo_status2 = (PADS_fifo_status2_t *)&status[1];
+	uint8_t tmp[5 * PADS_FIFO_DEPTH];
+	uint8_t samples;
+	uint8_t i;
+
+	*count = 0;
+
+	/* FIFO_STATUS1 (fill level) and FIFO_STATUS2 (flags) are consecutive */
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_STATUS1_REG, 2, status))
+	return WE_FAIL;
+
+	if (watermark != NULL)
+	{
+		*watermark = (PADS_state_t)fifo_status2->fifoWtm;
+	}
+	if (overrun != NULL)
+	{
+		*overrun = (PADS_state_t)fifo_status2->fifoOverrun;
+	}
+
+	samples = status[0];
+	if (samples > PADS_FIFO_DEPTH)
+	{
+		samples = PADS_FIFO_DEPTH;
+	}
+	if (samples > maxSamples)
+	{
+		samples = maxSamples;
+	}
+	if (samples == 0)
+	return WE_SUCCESS;
+
+	if (WE_FAIL == ReadReg(dev, (uint8_t)PADS_FIFO_DATA_P_XL_REG, 5 * samples, tmp))
+	return WE_FAIL;
+
+	for (i = 0; i < samples; i++)
+	{
+		buffer[i].pressure = (int32_t)(((uint32_t)tmp[5 * i + 2] << 16) | ((uint32_t)tmp[5 * i + 1] << 8) | tmp[5 * i]);
+		buffer[i].temperature = (int16_t)((tmp[5 * i + 4] << 8) | tmp[5 * i + 3]);
+	}
+
+	*count = samples;
+	return WE_SUCCESS;
+}
+
+/* output data period in ns for ODR[2:0] */
+static const uint64_t PADS_periodNs[8] = { 0, 1000000000ULL, 100000000ULL, 40000000ULL, 20000000ULL, 13333333ULL, 10000000ULL, 5000000ULL };
+
+/**
+* @brief  Nominal output data period, e.g. for SampleClockInit()
+* @param  Output data rate (CTRL_1 ODR)
+* @retval Period in ns, 0 in power down / single conversion mode
+*/
+uint64_t PADS_getSamplePeriodNs(PADS_output_data_rate_t odr)
+{
+	if (odr > outputDataRate200HZ)
+	return 0;
+
+	return PADS_periodNs[odr];
+}
+
+/**
+* @brief  Drain the FIFO and timestamp the samples
+*         PADS_readFifo() followed by a single clock reading: the newest sample is dated at the drain, the older
+*         ones back-dated by the period of the sample clock, which is drift corrected over successive drains.
+*         A FIFO overrun restarts the sample clock.
+* @param  Sample clock initialized with PADS_getSamplePeriodNs() of the active output data rate
+* @param  Buffer for the timestamped samples
+* @param  Maximum number of samples to read, size of the buffer
+* @param  Pointer to the number of samples read
+* @retval Error code
+*/
+int8_t PADS_readFifoTimestamped(we_dev_t *dev, we_sample_clock_t *clock, PADS_sample_t *buffer, uint8_t maxSamples, uint8_t *count)
+{
+	PADS_raw_data_t raw[PADS_FIFO_DEPTH];
+	PADS_state_t overrun;
+	uint64_t firstNs, periodNs;
+	uint8_t i;
+
+	if (maxSamples > PADS_FIFO_DEPTH)
+	{
+		maxSamples = PADS_FIFO_DEPTH;
+	}
+
+	if (WE_FAIL == PADS_readFifo(dev, raw, maxSamples, count, NULL, &overrun))
+	return WE_FAIL;
+
+	SampleClockDrain(clock, SampleClockNowNs(), *count, overrun == PADS_enable, &firstNs, &periodNs);
+
+	for (i = 0; i < *count; i++)
+	{
+		buffer[i].timestampNs = firstNs + i * periodNs;
+		buffer[i].raw = raw[i];
+	}
+
+	return WE_SUCCESS;
+}
+
+/* Integer output */
+
+/**
+* @brief  Read the measured pressure value in Pa, integer arithmetic only
+*         40960 digit/kPa: Pa = raw * 1000 / 40960 = raw * 25 / 1024, rounded
+* @param  Pointer to pressure in Pa
+* @retval Error code
+*/
+int8_t PADS_getPressurePa(we_dev_t *dev, int32_t *pressPa)
+{
+	int32_t rawPressure = 0;
+
+	if (WE_FAIL == PADS_getRAWPressure(dev, &rawPressure))
+	return WE_FAIL;
+
+	/* raw value < 2^24, the product fits 32 bit */
+	*pressPa = WE_DIV_ROUND(rawPressure * 25, 1024);
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read the measured temperature value in 0.01 °C, integer arithmetic only
+* @param  Pointer to temperature in 0.01 °C
+* @retval Error code
+*/
+int8_t PADS_getTemperatureCentiDegC(we_dev_t *dev, int32_t *tempCentiDegC)
+{
+	int16_t rawTemp = 0;
+
+	if (WE_FAIL == PADS_getRAWTemperature(dev, &rawTemp))
+	return WE_FAIL;
+
+	/* the raw value already is in 0.01 °C */
+	*tempCentiDegC = rawTemp;
+	return WE_SUCCESS;
+}
+
+/* Conversion of sample buffers */
+
+/**
+* @brief  Convert a buffer of raw pressure values to kPa (40960 digit/kPa)
+*         Uses the SIMD kernel of the platform (ConvertInt32ToFloat()), the division is replaced by
+*         a multiplication with the reciprocal.
+* @param  Raw pressure values as returned by PADS_getRAWPressure() / PADS_getFifoRAWPressure()
+* @param  Converted pressure values in kPa
+* @param  Number of values
+* @retval None
+*/
+void PADS_convertPressureBuffer(const int32_t *rawPres, float *presskPa, int count)
+{
+	ConvertInt32ToFloat(rawPres, presskPa, count, 1.0f / 40960.0f, 0.0f);
+}
+
+/**
+* @brief  Convert a buffer of raw temperature values to °C (100 digit/°C)
+* @param  Raw temperature values as returned by PADS_getRAWTemperature() / PADS_getFifoRAWTemperature()
+* @param  Converted temperature values in °C
+* @param  Number of values
+* @retval None
+*/
+void PADS_convertTemperatureBuffer(const int16_t *rawTemp, float *tempdegC, int count)
+{
+	ConvertInt16ToFloat(rawTemp, tempdegC, count, 0, 1.0f / 100.0f, 0.0f);
+}
+
+/* Configuration */
+
+/**
+* @brief  Read CTRL_1 .. FIFO_WTM in a single batch (one byte per register, independent of IF_ADD_INC)
+* @param  Pointer to the register images
+* @retval Error code
+*/
+static int8_t PADS_readCtrlBlock(we_dev_t *dev, PADS_ctrl_block_t *ctrl)
+{
+	we_reg_read_t reads[sizeof(PADS_ctrl_block_t)];
+	int i;
+
+	for (i = 0; i < (int)sizeof(PADS_ctrl_block_t); i++)
+	{
+		reads[i].RegAdr = (uint8_t)(PADS_CTRL_1_REG + i);
+		reads[i].NumByteToRead = 1;
+		reads[i].Data = (uint8_t *)ctrl + i;
+	}
+
+	return ReadRegBatch(dev, reads, sizeof(PADS_ctrl_block_t));
+}
+
+/**
+* @brief  Apply a complete configuration, the bus lock is held by the caller
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+static int8_t PADS_writeConfig(we_dev_t *dev, const PADS_config_t *config)
+{
+	PADS_ctrl_block_t current, target;
+	bool burst;
+
+	if (WE_FAIL == PADS_readCtrlBlock(dev, &current))
+	return WE_FAIL;
+
+	target = current;
+
+	/* never re-trigger self-clearing functions */
+	target.ctrl2.oneShotbit = 0;
+	target.ctrl2.softwareReset = 0;
+	target.ctrl2.boot = 0;
+
+	target.ctrl1.outputDataRate = config->outputDataRate;
+	target.ctrl1.enLowPassFilter = config->lowPassFilter;
+	target.ctrl1.lowPassFilterConfig = config->lowPassFilterConfig;
+	target.ctrl1.blockDataUpdate = config->blockDataUpdate;
+	target.ctrl2.lowNoiseMode = config->powerMode;
+	target.ctrl2.autoAddIncr = config->autoIncrement;
+	target.ctrl2.openDrainOnINTpin = config->intPinType;
+	target.ctrl2.intActiveLevel = config->intActiveLevel;
+	target.fifoCtrl.fifoMode = config->fifoMode;
+	target.fifoCtrl.stopOnThreshold = config->stopOnThreshold;
+	target.fifoWtm.fifoThreshold = config->fifoThreshold;
+
+	/* LOW_NOISE_EN may only be changed in power down: stop the conversions first */
+	if ((current.ctrl2.lowNoiseMode != target.ctrl2.lowNoiseMode) && (current.ctrl1.outputDataRate != outputDataRatePowerDown))
+	{
+		current.ctrl1.outputDataRate = outputDataRatePowerDown;
+		if (WE_FAIL == WriteReg(dev, (uint8_t)PADS_CTRL_1_REG, 1, (uint8_t *)&current.ctrl1))
+		return WE_FAIL;
+	}
+
+	/* a burst needs the address auto increment before and after the write */
+	burst = current.ctrl2.autoAddIncr && target.ctrl2.autoAddIncr;
+
+	if (WE_FAIL == WriteRegDiff(dev, PADS_CTRL_1_REG, sizeof(PADS_ctrl_block_t), (uint8_t *)&current, (uint8_t *)&target, burst))
+	return WE_FAIL;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Apply a complete configuration
+*         The final register images are computed first; only the registers that change are written, in one burst.
+*         Runs as one bus transaction, no other thread can access the bus between reading the current
+*         and writing the new register images.
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+int8_t PADS_applyConfig(we_dev_t *dev, const PADS_config_t *config)
+{
+	int8_t ret;
+
+	BusLock(dev->bus);
+	ret = PADS_writeConfig(dev, config);
+	BusUnlock(dev->bus);
+
+	return ret;
+}
+
+/**
+* @brief  Read the current configuration in a single batch
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+int8_t PADS_readConfig(we_dev_t *dev, PADS_config_t *config)
+{
+	PADS_ctrl_block_t ctrl;
+
+	if (WE_FAIL == PADS_readCtrlBlock(dev, &ctrl))
+	return WE_FAIL;
+
+	config->outputDataRate = (PADS_output_data_rate_t)ctrl.ctrl1.outputDataRate;
+	config->lowPassFilter = (PADS_state_t)ctrl.ctrl1.enLowPassFilter;
+	config->lowPassFilterConfig = (PADS_filter_conf_t)ctrl.ctrl1.lowPassFilterConfig;
+	config->blockDataUpdate = (PADS_state_t)ctrl.ctrl1.blockDataUpdate;
+	config->powerMode = (PADS_pwr_mode_t)ctrl.ctrl2.lowNoiseMode;
+	config->autoIncrement = (PADS_state_t)ctrl.ctrl2.autoAddIncr;
+	config->intPinType = (PADS_interrupt_pin_t)ctrl.ctrl2.openDrainOnINTpin;
+	config->intActiveLevel = (PADS_interrupt_level_t)ctrl.ctrl2.intActiveLevel;
+	config->fifoMode = (PADS_fifo_mode_t)ctrl.fifoCtrl.fifoMode;
+	config->stopOnThreshold = (PADS_state_t)ctrl.fifoCtrl.stopOnThreshold;
+	config->fifoThreshold = ctrl.fifoWtm.fifoThreshold;
+
+	return WE_SUCCESS;
+}
+
+/* Interrupt driven acquisition */
+
+/**
+* @brief  Wait for a new pressure sample
+*         Sleeps on the interrupt line connected to INT (data-ready signal enabled with PADS_setDrdyInt() and
+*         PADS_setIntEventCtrl(dataReady)); the bus is only accessed if no edge arrives within the timeout.
+*         Without an interrupt line (NULL) the status is polled once per ms.
+* @param  Interrupt line connected to INT, or NULL
+* @param  Maximum time to wait in ms, -1: no timeout
+* @param  Pointer to pressure data available state, PADS_disable on timeout
+* @retval Error code
+*/
+int8_t PADS_waitForDataReady(we_dev_t *dev, we_int_line_t *intLine, int timeoutMs, PADS_state_t *drdy)
+{
+	bool fired;
+	int elapsedMs = 0;
+
+	if (intLine == NULL)
+	{
+		while (1)
+		{
+			if (WE_FAIL == PADS_getPresStatus(dev, drdy))
+			return WE_FAIL;
+
+			if ((*drdy == PADS_enable) || ((timeoutMs >= 0) && (elapsedMs >= timeoutMs)))
+			return WE_SUCCESS;
+
+			BusDelay(dev->bus, 1);
+			elapsedMs++;
+		}
+	}
+
+	if (WE_FAIL == IntLineWait(intLine, timeoutMs, &fired))
+	return WE_FAIL;
+
+	if (fired)
+	{
+		*drdy = PADS_enable;
+		return WE_SUCCESS;
+	}
+
+	/* the data-ready signal may already have been active when waiting started */
+	return PADS_getPresStatus(dev, drdy);
+}
+
 /**         EOF         */
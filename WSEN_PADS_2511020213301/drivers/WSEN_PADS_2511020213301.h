@@ -30,12 +30,17 @@
 
 #include <stdint.h> 											/* for support of uint8_t datatypes etc */
 #include "platform.h"
+#include "platform_timestamp.h"
 
 /**         Available PADS 2511020213301 I2C Slave addresses         */
 
 #define PADS_ADDRESS_I2C_0					(uint8_t)0x5C /* when SAO of PADS is connected to logic LOW level */
 #define PADS_ADDRESS_I2C_1					(uint8_t)0x5D /* when SAO of PADS is connected to logic HIGH level */
 
+/* Multi-byte (burst) accesses on I2C and SPI rely on the IF_ADD_INC bit, see PADS_setAutoIncrement(). No address bit is required (we_dev_t.multiByteMask = 0). */
+
+#define PADS_FIFO_DEPTH						128			/* pressure and temperature samples stored in the FIFO */
+
 
 /**         PADS 2511020213301 DEVICE_ID         */
 
@@ -357,144 +362,209 @@ typedef enum {
 }PADS_fifo_mode_t;
 
 
+/**
+* Sensor configuration applied with PADS_applyConfig() and read with PADS_readConfig()
+* Covers CTRL_1, CTRL_2, FIFO_CTRL and FIFO_WTM. Registers not covered keep their current content.
+*/
+typedef struct {
+	PADS_output_data_rate_t outputDataRate;  /* CTRL_1 ODR[2:0] */
+	PADS_state_t lowPassFilter;              /* CTRL_1 EN_LPFP */
+	PADS_filter_conf_t lowPassFilterConfig;  /* CTRL_1 LPFP_CFG */
+	PADS_state_t blockDataUpdate;            /* CTRL_1 BDU */
+	PADS_pwr_mode_t powerMode;               /* CTRL_2 LOW_NOISE_EN */
+	PADS_state_t autoIncrement;              /* CTRL_2 IF_ADD_INC */
+	PADS_interrupt_pin_t intPinType;         /* CTRL_2 PP_OD */
+	PADS_interrupt_level_t intActiveLevel;   /* CTRL_2 INT_H_L */
+	PADS_fifo_mode_t fifoMode;               /* FIFO_CTRL [TRIG_MODES;FMODE[1:0]] */
+	PADS_state_t stopOnThreshold;            /* FIFO_CTRL STOP_ON_WTM */
+	uint8_t fifoThreshold;                   /* FIFO_WTM WTM[6:0] */
+} PADS_config_t;
+
+/**
+* Raw pressure and temperature of one sample, as stored in DATA_P_XL .. DATA_T_H and in each FIFO entry
+*/
+typedef struct {
+	int32_t pressure;                        /* 24 bit, 40960 digit/kPa */
+	int16_t temperature;                     /* 100 digit/°C */
+} PADS_raw_data_t;
+
+/**
+* Raw pressure and temperature with the CLOCK_MONOTONIC time they were sampled at, see PADS_readFifoTimestamped()
+*/
+typedef struct {
+	uint64_t timestampNs;
+	PADS_raw_data_t raw;
+} PADS_sample_t;
+
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
 	/**         Functions definition         */
+	/* all functions take the device context opened with DeviceInit() as first argument */
+
+	int8_t PADS_getDeviceID(we_dev_t *dev, uint8_t *devID);
+
+	/* Register shadow cache (optional) */
+	int8_t PADS_enableRegisterCache(we_dev_t *dev, we_reg_cache_t *cache);
+
+	/* Complete configuration in one batched read and a single burst write */
+	int8_t PADS_applyConfig(we_dev_t *dev, const PADS_config_t *config);
+	int8_t PADS_readConfig(we_dev_t *dev, PADS_config_t *config);
 
-	int8_t PADS_getDeviceID(uint8_t *devID);
+	/* Interrupt driven acquisition: sleep on the GPIO connected to INT instead of polling STATUS */
+	int8_t PADS_waitForDataReady(we_dev_t *dev, we_int_line_t *intLine, int timeoutMs, PADS_state_t *drdy);
 
 	/* definition of Interrupt functions  */
-	int8_t PADS_setAutoRefp(PADS_state_t autorep);
-	int8_t PADS_getAutoRefpState(PADS_state_t *autoRefp);
-	int8_t PADS_resetAutoRefp(PADS_state_t autorep);
+	int8_t PADS_setAutoRefp(we_dev_t *dev, PADS_state_t autorep);
+	int8_t PADS_getAutoRefpState(we_dev_t *dev, PADS_state_t *autoRefp);
+	int8_t PADS_resetAutoRefp(we_dev_t *dev, PADS_state_t autorep);
 
-	int8_t PADS_setAutoZeroFunction(PADS_state_t autozero);
-	int8_t PADS_getAutoZeroState(PADS_state_t *autoZero);
-	int8_t PADS_resetAutoZeroFunction(PADS_state_t autozeroRst);
+	int8_t PADS_setAutoZeroFunction(we_dev_t *dev, PADS_state_t autozero);
+	int8_t PADS_getAutoZeroState(we_dev_t *dev, PADS_state_t *autoZero);
+	int8_t PADS_resetAutoZeroFunction(we_dev_t *dev, PADS_state_t autozeroRst);
 
-	int8_t PADS_setDiffPresInt(PADS_state_t diffEn);
-	int8_t PADS_getDiffPresIntState(PADS_state_t *diffIntState);
+	int8_t PADS_setDiffPresInt(we_dev_t *dev, PADS_state_t diffEn);
+	int8_t PADS_getDiffPresIntState(we_dev_t *dev, PADS_state_t *diffIntState);
 
-	int8_t PADS_setLatchInt(PADS_state_t state);
-	int8_t PADS_getLatchIntState(PADS_state_t *latchInt);
+	int8_t PADS_setLatchInt(we_dev_t *dev, PADS_state_t state);
+	int8_t PADS_getLatchIntState(we_dev_t *dev, PADS_state_t *latchInt);
 
-	int8_t PADS_setLowPresInt(PADS_state_t state);
-	int8_t PADS_getLowPresIntState(PADS_state_t *lpint);
-	int8_t PADS_setHighPresInt(PADS_state_t state);
-	int8_t PADS_getHighPresIntState(PADS_state_t *hpint);
+	int8_t PADS_setLowPresInt(we_dev_t *dev, PADS_state_t state);
+	int8_t PADS_getLowPresIntState(we_dev_t *dev, PADS_state_t *lpint);
+	int8_t PADS_setHighPresInt(we_dev_t *dev, PADS_state_t state);
+	int8_t PADS_getHighPresIntState(we_dev_t *dev, PADS_state_t *hpint);
 
-	int8_t PADS_getIntStatus(PADS_state_t *intState);
-	int8_t PADS_getLowPresIntStatus(PADS_state_t *lpState);
-	int8_t PADS_getHighPresIntStatus(PADS_state_t *hpState);
+	int8_t PADS_getIntStatus(we_dev_t *dev, PADS_state_t *intState);
+	int8_t PADS_getLowPresIntStatus(we_dev_t *dev, PADS_state_t *lpState);
+	int8_t PADS_getHighPresIntStatus(we_dev_t *dev, PADS_state_t *hpState);
 
-	int8_t PADS_setFifoFullInt(PADS_state_t fullState);
-	int8_t PADS_setFifoWtmInt(PADS_state_t WtmState);
-	int8_t PADS_setFifoOvrInt(PADS_state_t OvrState);
+	int8_t PADS_setFifoFullInt(we_dev_t *dev, PADS_state_t fullState);
+	int8_t PADS_setFifoWtmInt(we_dev_t *dev, PADS_state_t WtmState);
+	int8_t PADS_setFifoOvrInt(we_dev_t *dev, PADS_state_t OvrState);
 
-	int8_t PADS_setFifoOvrInterrupt(PADS_state_t OvrState);
+	int8_t PADS_setFifoOvrInterrupt(we_dev_t *dev, PADS_state_t OvrState);
 
-	int8_t PADS_getFifoFullState(PADS_state_t *fifoFull);
-	int8_t PADS_getFifoWtmState(PADS_state_t *fifoWtm);
-	int8_t PADS_getFifoOvrState(PADS_state_t *fifoOvr);
+	int8_t PADS_getFifoFullState(we_dev_t *dev, PADS_state_t *fifoFull);
+	int8_t PADS_getFifoWtmState(we_dev_t *dev, PADS_state_t *fifoWtm);
+	int8_t PADS_getFifoOvrState(we_dev_t *dev, PADS_state_t *fifoOvr);
 
-	int8_t  PADS_setDrdyInt(PADS_state_t DRDYStatus);
-	int8_t PADS_getDrdyIntState(PADS_state_t *drdy);
+	int8_t  PADS_setDrdyInt(we_dev_t *dev, PADS_state_t DRDYStatus);
+	int8_t PADS_getDrdyIntState(we_dev_t *dev, PADS_state_t *drdy);
 
-	int8_t  PADS_setIntEventCtrl(PADS_interrupt_event_t ctr);
-	int8_t PADS_getIntEventCtrlState(PADS_interrupt_event_t *intEvent);
+	int8_t  PADS_setIntEventCtrl(we_dev_t *dev, PADS_interrupt_event_t ctr);
+	int8_t PADS_getIntEventCtrlState(we_dev_t *dev, PADS_interrupt_event_t *intEvent);
 
-	int8_t  PADS_setPresThrLSB(uint8_t thr);
-	int8_t  PADS_setPresThrMSB(uint8_t thr);
-	int8_t PADS_getPresThrLSB(uint8_t *thrLSB);
-	int8_t PADS_getPresThrMSB(uint8_t *thrMSB);
+	int8_t  PADS_setPresThrLSB(we_dev_t *dev, uint8_t thr);
+	int8_t  PADS_setPresThrMSB(we_dev_t *dev, uint8_t thr);
+	int8_t PADS_getPresThrLSB(we_dev_t *dev, uint8_t *thrLSB);
+	int8_t PADS_getPresThrMSB(we_dev_t *dev, uint8_t *thrMSB);
 
 	/* Standard Configurations */
-	int8_t  PADS_disI2C(PADS_state_t I2CStatus);
-	int8_t PADS_getI2CState(PADS_state_t *i2cState);
-	int8_t  PADS_disPullDownIntPin(PADS_state_t pullDown);
-	int8_t PADS_getPullDownIntPinState(PADS_state_t *pinState);
-	int8_t  PADS_setSAOPullUp(PADS_state_t SaoStatus);
-	int8_t PADS_getSAOPullUpState(PADS_state_t *saoPinState);
-	int8_t  PADS_setSDAPullUp(PADS_state_t SdaStatus);
-	int8_t PADS_getSDAPullUpState(PADS_state_t *sdaPinState);
+	int8_t  PADS_disI2C(we_dev_t *dev, PADS_state_t I2CStatus);
+	int8_t PADS_getI2CState(we_dev_t *dev, PADS_state_t *i2cState);
+	int8_t  PADS_disPullDownIntPin(we_dev_t *dev, PADS_state_t pullDown);
+	int8_t PADS_getPullDownIntPinState(we_dev_t *dev, PADS_state_t *pinState);
+	int8_t  PADS_setSAOPullUp(we_dev_t *dev, PADS_state_t SaoStatus);
+	int8_t PADS_getSAOPullUpState(we_dev_t *dev, PADS_state_t *saoPinState);
+	int8_t  PADS_setSDAPullUp(we_dev_t *dev, PADS_state_t SdaStatus);
+	int8_t PADS_getSDAPullUpState(we_dev_t *dev, PADS_state_t *sdaPinState);
 
 
-	int8_t  PADS_setOutputDataRate(PADS_output_data_rate_t odr);
-	int8_t PADS_getOutputDataRate(PADS_output_data_rate_t* odr);
+	int8_t  PADS_setOutputDataRate(we_dev_t *dev, PADS_output_data_rate_t odr);
+	int8_t PADS_getOutputDataRate(we_dev_t *dev, PADS_output_data_rate_t* odr);
 
-	int8_t  PADS_setLowPassFilter(PADS_state_t filterStatus);
-	int8_t PADS_getLowPassFilterStatus(PADS_state_t *filterStatus);
-	int8_t  PADS_setLowPassFilterConf(PADS_filter_conf_t conf);
-	int8_t PADS_getLowPassFilterConf(PADS_filter_conf_t *conf);
+	int8_t  PADS_setLowPassFilter(we_dev_t *dev, PADS_state_t filterStatus);
+	int8_t PADS_getLowPassFilterStatus(we_dev_t *dev, PADS_state_t *filterStatus);
+	int8_t  PADS_setLowPassFilterConf(we_dev_t *dev, PADS_filter_conf_t conf);
+	int8_t PADS_getLowPassFilterConf(we_dev_t *dev, PADS_filter_conf_t *conf);
 
-	int8_t  PADS_setBlockDataUpdate(PADS_state_t bdu);
-	int8_t PADS_getBlockDataUpdateState(PADS_state_t *bdu);
+	int8_t  PADS_setBlockDataUpdate(we_dev_t *dev, PADS_state_t bdu);
+	int8_t PADS_getBlockDataUpdateState(we_dev_t *dev, PADS_state_t *bdu);
 
-	int8_t  PADS_rebootMemory(PADS_state_t reboot);
-	int8_t PADS_getRebootMemoryState(PADS_state_t *reboot);
-	int8_t PADS_getBootStatus(PADS_state_t *boot);
+	int8_t  PADS_rebootMemory(we_dev_t *dev, PADS_state_t reboot);
+	int8_t PADS_getRebootMemoryState(we_dev_t *dev, PADS_state_t *reboot);
+	int8_t PADS_getBootStatus(we_dev_t *dev, PADS_state_t *boot);
 
-	int8_t  PADS_setIntActiveLevel(PADS_interrupt_level_t intLvl);
-	int8_t PADS_getIntActiveLevel(PADS_interrupt_level_t *intLvl);
+	int8_t  PADS_setIntActiveLevel(we_dev_t *dev, PADS_interrupt_level_t intLvl);
+	int8_t PADS_getIntActiveLevel(we_dev_t *dev, PADS_interrupt_level_t *intLvl);
 
-	int8_t  PADS_setIntPinType(PADS_interrupt_pin_t intr);
-	int8_t PADS_getIntPinType(PADS_interrupt_pin_t *intr);
+	int8_t  PADS_setIntPinType(we_dev_t *dev, PADS_interrupt_pin_t intr);
+	int8_t PADS_getIntPinType(we_dev_t *dev, PADS_interrupt_pin_t *intr);
 
-	int8_t  PADS_setAutoIncrement(PADS_state_t inc);
-	int8_t PADS_getAutoIncrementState(PADS_state_t *inc);
+	int8_t  PADS_setAutoIncrement(we_dev_t *dev, PADS_state_t inc);
+	int8_t PADS_getAutoIncrementState(we_dev_t *dev, PADS_state_t *inc);
 
-	int8_t  PADS_setSwreset(PADS_state_t mode);
-	int8_t PADS_getSwresetState(PADS_state_t *mode);
+	int8_t  PADS_setSwreset(we_dev_t *dev, PADS_state_t mode);
+	int8_t PADS_getSwresetState(we_dev_t *dev, PADS_state_t *mode);
 
-	int8_t  PADS_setPowerMode(PADS_pwr_mode_t mode);
-	int8_t PADS_getPowerMode(PADS_pwr_mode_t *mode);
+	int8_t  PADS_setPowerMode(we_dev_t *dev, PADS_pwr_mode_t mode);
+	int8_t PADS_getPowerMode(we_dev_t *dev, PADS_pwr_mode_t *mode);
 
-	int8_t  PADS_setSingleConvMode(PADS_state_t mode);
-	int8_t PADS_getSingleConvModeState(PADS_state_t *mode);
+	int8_t  PADS_setSingleConvMode(we_dev_t *dev, PADS_state_t mode);
+	int8_t PADS_getSingleConvModeState(we_dev_t *dev, PADS_state_t *mode);
 
 	/* pressure offset value */
-	int8_t  PADS_setPresOffsetLSB(uint8_t offSet);
-	int8_t PADS_getPresOffsetLSB(uint8_t *offSet);
-	int8_t  PADS_setPresOffsetMSB(uint8_t offSet);
-	int8_t PADS_getPresOffsetMSB(uint8_t *offSet);
+	int8_t  PADS_setPresOffsetLSB(we_dev_t *dev, uint8_t offSet);
+	int8_t PADS_getPresOffsetLSB(we_dev_t *dev, uint8_t *offSet);
+	int8_t  PADS_setPresOffsetMSB(we_dev_t *dev, uint8_t offSet);
+	int8_t PADS_getPresOffsetMSB(we_dev_t *dev, uint8_t *offSet);
 
 	/* SET FIFO CTRL_REG */
-	int8_t  PADS_setFifoMode(PADS_fifo_mode_t fifoMode);
-	int8_t PADS_getFifoMode(PADS_fifo_mode_t *fifoMode);
+	int8_t  PADS_setFifoMode(we_dev_t *dev, PADS_fifo_mode_t fifoMode);
+	int8_t PADS_getFifoMode(we_dev_t *dev, PADS_fifo_mode_t *fifoMode);
 
-	int8_t  PADS_setStopOnThr(PADS_state_t state);
-	int8_t PADS_getStopOnThrStatus(PADS_state_t *state);
+	int8_t  PADS_setStopOnThr(we_dev_t *dev, PADS_state_t state);
+	int8_t PADS_getStopOnThrStatus(we_dev_t *dev, PADS_state_t *state);
 
-	int8_t  PADS_setFifoThr(uint8_t fifoThr);
-	int8_t PADS_getFifoThr(uint8_t *fifoThr);
+	int8_t  PADS_setFifoThr(we_dev_t *dev, uint8_t fifoThr);
+	int8_t PADS_getFifoThr(we_dev_t *dev, uint8_t *fifoThr);
 
-	int8_t PADS_getFifoFillLevel(uint8_t *fifoLevel);
+	int8_t PADS_getFifoFillLevel(we_dev_t *dev, uint8_t *fifoLevel);
 
 	/* Getting Reference pressure value */
-	int8_t PADS_getPresRefLSB(uint8_t *lowReferenceValue);
-	int8_t PADS_getPresRefMSB(uint8_t *highReferenceValue);
+	int8_t PADS_getPresRefLSB(we_dev_t *dev, uint8_t *lowReferenceValue);
+	int8_t PADS_getPresRefMSB(we_dev_t *dev, uint8_t *highReferenceValue);
 
 	/* Temperature and Pressure data overrun State */
-	int8_t PADS_getTemperOverrunStatus(PADS_state_t *state);
-	int8_t PADS_getPressureOverrunStatus(PADS_state_t *state);
+	int8_t PADS_getTemperOverrunStatus(we_dev_t *dev, PADS_state_t *state);
+	int8_t PADS_getPressureOverrunStatus(we_dev_t *dev, PADS_state_t *state);
 	/* Temperature and Pressure data available State */
-	int8_t PADS_getTempStatus(PADS_state_t *state);
-	int8_t PADS_getPresStatus(PADS_state_t *state);
+	int8_t PADS_getTempStatus(we_dev_t *dev, PADS_state_t *state);
+	int8_t PADS_getPresStatus(we_dev_t *dev, PADS_state_t *state);
 
 	/* standard Data Out */
-	int8_t PADS_getRAWPressure(int32_t *rawPres);
-	int8_t PADS_getRAWTemperature(int16_t *rawTemp);
-	int8_t PADS_getPressure(float *presskPa);     // Pressure Value in kPa
-	int8_t PADS_getTemperature(float *tempdegC);  // Temperature Value in °C
+	int8_t PADS_getRAWPressure(we_dev_t *dev, int32_t *rawPres);
+	int8_t PADS_getRAWTemperature(we_dev_t *dev, int16_t *rawTemp);
+	int8_t PADS_getPressure(we_dev_t *dev, float *presskPa);     // Pressure Value in kPa
+	int8_t PADS_getTemperature(we_dev_t *dev, float *tempdegC);  // Temperature Value in °C
+
+	/* Pressure and temperature in a single burst, optionally gated on STATUS */
+	int8_t PADS_getRAWPressureAndTemperature(we_dev_t *dev, PADS_raw_data_t *raw, PADS_state_t *newData);
+	int8_t PADS_getPressureAndTemperature(we_dev_t *dev, float *presskPa, float *tempdegC, PADS_state_t *newData);
 
 	/*Fifo Data Out */
-	int8_t PADS_getFifoRAWTemperature(int16_t *rawTemp);
-	int8_t PADS_getFifoRAWPressure(int32_t *rawPres);
-	int8_t PADS_getFifoTemperature(float *tempdegC);  // Temperature Value in °C
-	int8_t PADS_getFifoPressure(float *presskPa);    // Pressure Value in kPa
+	int8_t PADS_getFifoRAWTemperature(we_dev_t *dev, int16_t *rawTemp);
+	int8_t PADS_getFifoRAWPressure(we_dev_t *dev, int32_t *rawPres);
+	int8_t PADS_getFifoTemperature(we_dev_t *dev, float *tempdegC);  // Temperature Value in °C
+	int8_t PADS_getFifoPressure(we_dev_t *dev, float *presskPa);    // Pressure Value in kPa
+
+	/* FIFO drain: status read once, then all pending samples in a single burst */
+	int8_t PADS_readFifo(we_dev_t *dev, PADS_raw_data_t *buffer, uint8_t maxSamples, uint8_t *count, PADS_state_t *watermark, PADS_state_t *overrun);
+
+	/* Timestamped FIFO drain: samples back-dated from the drain time with the drift corrected output data period */
+	uint64_t PADS_getSamplePeriodNs(PADS_output_data_rate_t odr);
+	int8_t PADS_readFifoTimestamped(we_dev_t *dev, we_sample_clock_t *clock, PADS_sample_t *buffer, uint8_t maxSamples, uint8_t *count);
+
+	/* Integer output */
+	int8_t PADS_getPressurePa(we_dev_t *dev, int32_t *pressPa);                 // Pressure Value in Pa
+	int8_t PADS_getTemperatureCentiDegC(we_dev_t *dev, int32_t *tempCentiDegC);  // Temperature Value in 0.01 °C
+
+	/* Conversion of sample buffers */
+	void PADS_convertPressureBuffer(const int32_t *rawPres, float *presskPa, int count);
+	void PADS_convertTemperatureBuffer(const int16_t *rawTemp, float *tempdegC, int count);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,251 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "WSEN_PADS_2511020213301_sim.h"
+#include "WSEN_PADS_2511020213301.h"
+#include <string.h>
+
+#define PADS_SIM_FIFO_DEPTH          128
+#define PADS_SIM_ONE_SHOT_US         13000 /* duration of a one-shot conversion, low power */
+#define PADS_SIM_ONE_SHOT_LN_US      40000 /* duration of a one-shot conversion, low noise */
+
+/* output data period in us for ODR[2:0] */
+static const uint32_t PADS_simPeriodUs[8] = { 0, 1000000, 100000, 40000, 20000, 13333, 10000, 5000 };
+
+
+/**
+* @brief  Store one sample in the output registers and the FIFO
+* @param  -sim : simulated device
+* @retval None
+*/
+static void PADS_simSample(we_sim_device_t *sim)
+{
+	uint8_t record[5];
+	uint8_t fifoMode = sim->regs[PADS_FIFO_CTRL_REG] & 0x07;
+	uint8_t watermark = sim->regs[PADS_FIFO_WTM_REG] & 0x7F;
+	int32_t pressure;
+	int16_t temperature;
+	int depth = PADS_SIM_FIFO_DEPTH;
+	int i;
+
+	sim->sampleCount++;
+	pressure = 4149248 + SimWave(sim->sampleCount, 4096, 100); /* 101.3 kPa */
+	temperature = (int16_t)(2350 + SimWave(sim->sampleCount, 50, 200)); /* 23.5 degC */
+
+	record[0] = (uint8_t)(pressure & 0xFF);
+	record[1] = (uint8_t)((pressure >> 8) & 0xFF);
+	record[2] = (uint8_t)((pressure >> 16) & 0xFF);
+	record[3] = (uint8_t)(temperature & 0xFF);
+	record[4] = (uint8_t)((uint16_t)temperature >> 8);
+
+	for (i = 0; i < 5; i++)
+	{
+		sim->regs[PADS_DATA_P_XL_REG + i] = record[i];
+	}
+	if (sim->regs[PADS_STATUS_REG] & 0x01)
+	{
+		sim->regs[PADS_STATUS_REG] |= 0x30; /* previous sample not read: overrun */
+	}
+	sim->regs[PADS_STATUS_REG] |= 0x03;
+
+	if (fifoMode != 0)
+	{
+		/* STOP_ON_WTM limits the FIFO depth to the watermark level */
+		if ((sim->regs[PADS_FIFO_CTRL_REG] & 0x08) && watermark != 0)
+		{
+			depth = watermark;
+		}
+		/* FIFO mode (1) stops when full, the continuous modes overwrite the oldest sample */
+		SimFifoPush(sim, record, 5, depth, (fifoMode & 0x03) != 1);
+	}
+}
+
+/**
+* @brief  Load the power-on register values
+* @param  -sim : simulated device
+* @retval None
+*/
+static void PADS_simReset(we_sim_device_t *sim)
+{
+	memset(sim->regs, 0, sizeof(sim->regs));
+	sim->regs[PADS_DEVICE_ID_REG] = PADS_DEVICE_ID_VALUE;
+	sim->regs[PADS_CTRL_2_REG] = 0x10; /* IF_ADD_INC */
+	sim->periodUs = 0;
+	sim->conversionDoneUs = 0;
+	SimFifoClear(sim);
+}
+
+/**
+* @brief  Produce the samples due up to the current time
+* @param  -sim : simulated device
+* @retval None
+*/
+static void PADS_simUpdate(we_sim_device_t *sim)
+{
+	uint32_t due;
+
+	for (due = SimSamplesDue(sim, PADS_simPeriodUs[(sim->regs[PADS_CTRL_1_REG] >> 4) & 0x07]); due > 0; due--)
+	{
+		PADS_simSample(sim);
+	}
+
+	if (sim->conversionDoneUs != 0 && sim->conversionDoneUs <= sim->nowUs)
+	{
+		sim->conversionDoneUs = 0;
+		sim->regs[PADS_CTRL_2_REG] &= (uint8_t)~0x01;
+		PADS_simSample(sim);
+	}
+}
+
+/**
+* @brief  Read one register, FIFO status and FIFO data are computed from the FIFO state
+* @param  -sim : simulated device
+*         -RegAdr : register address
+* @retval register value
+*/
+static uint8_t PADS_simRead(we_sim_device_t *sim, uint8_t RegAdr)
+{
+	uint8_t watermark = sim->regs[PADS_FIFO_WTM_REG] & 0x7F;
+	uint8_t value;
+
+	switch (RegAdr)
+	{
+	case PADS_FIFO_STATUS1_REG:
+		return (uint8_t)sim->fifoLevel;
+
+	case PADS_FIFO_STATUS2_REG:
+		value = 0;
+		if (sim->fifoLevel >= PADS_SIM_FIFO_DEPTH)
+		{
+			value |= 0x20;
+		}
+		if (sim->fifoOverrun)
+		{
+			value |= 0x40;
+		}
+		if (watermark != 0 && sim->fifoLevel >= watermark)
+		{
+			value |= 0x80;
+		}
+		return value;
+
+	case PADS_DATA_P_XL_REG:
+	case PADS_DATA_P_L_REG:
+		return sim->regs[RegAdr];
+
+	case PADS_DATA_P_H_REG:
+		sim->regs[PADS_STATUS_REG] &= (uint8_t)~0x11;
+		return sim->regs[RegAdr];
+
+	case PADS_DATA_T_L_REG:
+		return sim->regs[RegAdr];
+
+	case PADS_DATA_T_H_REG:
+		sim->regs[PADS_STATUS_REG] &= (uint8_t)~0x22;
+		return sim->regs[RegAdr];
+
+	case PADS_FIFO_DATA_P_XL_REG:
+	case PADS_FIFO_DATA_P_L_REG:
+	case PADS_FIFO_DATA_P_H_REG:
+	case PADS_FIFO_DATA_T_L_REG:
+	case PADS_FIFO_DATA_T_H_REG:
+		return SimFifoReadByte(sim, RegAdr - PADS_FIFO_DATA_P_XL_REG, 5);
+
+	default:
+		return sim->regs[RegAdr];
+	}
+}
+
+/**
+* @brief  Write one register including the software reset, one-shot trigger and FIFO mode change
+* @param  -sim : simulated device
+*         -RegAdr : register address
+*         -value : value to write
+* @retval None
+*/
+static void PADS_simWrite(we_sim_device_t *sim, uint8_t RegAdr, uint8_t value)
+{
+	switch (RegAdr)
+	{
+	case PADS_DEVICE_ID_REG:
+	case PADS_INT_SOURCE_REG:
+	case PADS_FIFO_STATUS1_REG:
+	case PADS_FIFO_STATUS2_REG:
+	case PADS_STATUS_REG:
+		return; /* read only */
+
+	case PADS_CTRL_2_REG:
+		if (value & 0x04)
+		{
+			PADS_simReset(sim);
+			return;
+		}
+		if ((value & 0x01) && ((sim->regs[PADS_CTRL_1_REG] & 0x70) == 0))
+		{
+			sim->conversionDoneUs = sim->nowUs + ((value & 0x02) ? PADS_SIM_ONE_SHOT_LN_US : PADS_SIM_ONE_SHOT_US);
+		}
+		break;
+
+	case PADS_FIFO_CTRL_REG:
+		if ((value & 0x07) == 0)
+		{
+			SimFifoClear(sim); /* bypass mode empties the FIFO */
+		}
+		break;
+
+	default:
+		break;
+	}
+	sim->regs[RegAdr] = value;
+}
+
+/**
+* @brief  Auto increment, FIFO_DATA_T_H rolls over to FIFO_DATA_P_XL
+* @param  -sim : simulated device
+*         -RegAdr : current register address
+* @retval next register address
+*/
+static uint8_t PADS_simNextAddress(we_sim_device_t *sim, uint8_t RegAdr)
+{
+	if ((sim->regs[PADS_CTRL_2_REG] & 0x10) == 0)
+	{
+		return RegAdr;
+	}
+	if (RegAdr == PADS_FIFO_DATA_T_H_REG)
+	{
+		return PADS_FIFO_DATA_P_XL_REG;
+	}
+	return (uint8_t)(RegAdr + 1);
+}
+
+const we_sim_model_t PADS_simModel = {
+	PADS_simReset,
+	PADS_simUpdate,
+	PADS_simRead,
+	PADS_simWrite,
+	PADS_simNextAddress
+};
+
+/**         EOF         */
@@ -40,6 +40,9 @@
 bool AbortMainLoop = false;
 pthread_t thread_main;
 
+static we_bus_t bus;  /* bus the sensor is attached to */
+static we_dev_t pads; /* sensor device context */
+
 
 static void Application(void);
 void continuousMode(void);
@@ -145,7 +148,11 @@ static void Application()
 	int8_t retVal = -1;
 
 	/* initialize the platform SPI drivers */
-	status = SpiInit(spi_channel);
+	status = SpiBusInit(&bus, &WE_wiringPiBusOps, 0, 4000000, 0); /* /dev/spidev0.x, 4MHz, SPI mode 0 */
+	if (status == WE_SUCCESS)
+	{
+		status = DeviceInit(&pads, &bus, spi_channel);
+	}
 
 	if (status != WE_SUCCESS)
 	{
@@ -160,7 +167,11 @@ static void Application()
 	uint8_t deviceIdValue = 0, retVal = WE_FAIL;
 
 	/* initialize the platform I2C drivers */
-	status = I2CInit(addr_wsen_pads);
+	status = I2CBusInit(&bus, &WE_wiringPiBusOps, 1); /* /dev/i2c-1 on the Raspberry Pi header */
+	if (status == WE_SUCCESS)
+	{
+		status = DeviceInit(&pads, &bus, addr_wsen_pads);
+	}
 
 	if (status != WE_SUCCESS)
 	{
@@ -170,7 +181,7 @@ static void Application()
 #endif
 
 	/* first communication test */
-	retVal = PADS_getDeviceID(&deviceIdValue);
+	retVal = PADS_getDeviceID(&pads, &deviceIdValue);
 	if ((retVal == WE_SUCCESS) && (deviceIdValue == PADS_DEVICE_ID_VALUE))
 	{
 		Debug_out("WSEN_PADS Communication success\r\n", true);
@@ -184,22 +195,22 @@ static void Application()
 
 
 	/*set ODR to Power down*/
-	PADS_setOutputDataRate(outputDataRatePowerDown);
+	PADS_setOutputDataRate(&pads, outputDataRatePowerDown);
 
 	/*set low pass filter to BW=ODR/20*/
-	PADS_setLowPassFilterConf(lPfilterBW2);
+	PADS_setLowPassFilterConf(&pads, lPfilterBW2);
 
 	/*enable low pass filter */
-	PADS_setLowPassFilter(PADS_enable);
+	PADS_setLowPassFilter(&pads, PADS_enable);
 
 	/*enable Block Data Update*/
-	PADS_setBlockDataUpdate(PADS_enable);
+	PADS_setBlockDataUpdate(&pads, PADS_enable);
 
 	/*select Power Mode [0:low Current Mode; 1:low noise Mode]*/
-	PADS_setPowerMode(lowNoise);
+	PADS_setPowerMode(&pads, lowNoise);
 
 	/*enable the Auto Increment */
-	PADS_setAutoIncrement(PADS_enable);
+	PADS_setAutoIncrement(&pads, PADS_enable);
 
 	/*Select one of the two mode by uncommenting/commenting*/
 	//continuousMode();
@@ -225,14 +236,14 @@ void singleConversionMode()
 	{
 		getchar();
 		/*Start a conversion*/
-		PADS_setSingleConvMode(PADS_enable);
+		PADS_setSingleConvMode(&pads, PADS_enable);
 
 		delay(15);
 
-		PADS_getPressure(&pressureData);
+		PADS_getPressure(&pads, &pressureData);
 		printf("Pressure [kPa]= %f\r\n", pressureData);
 
-		PADS_getTemperature(&temperatureData);
+		PADS_getTemperature(&pads, &temperatureData);
 		printf("Temperature [°C]= %f\r\n", temperatureData);
 
 	}
@@ -250,15 +261,13 @@ void continuousMode()
 	float pressureData = 0;
 
 	/*Set ODR to 1Hz to start continuous mode*/
-	PADS_setOutputDataRate(outputDataRate1HZ);
+	PADS_setOutputDataRate(&pads, outputDataRate1HZ);
 
 	printf("\nStarting continuous mode...\r\n");
 	while (1)
 	{
-		PADS_getPressure(&pressureData);
+		PADS_getPressureAndTemperature(&pads, &pressureData, &temperatureData, NULL);
 		printf("Pressure [kPa]=%f\r\n", pressureData);
-
-		PADS_getTemperature(&temperatureData);
 		printf("Temperature [°C]=%f\r\n", temperatureData);
 
 		delay(DELAY_1_HZ_IN_MS);
@@ -24,50 +24,55 @@
  **/
 
 #include "WSEN_PDUS_25131308XXX01.h"
+#include "platform_convert.h"
 #include <stdio.h>
 
 
-static int8_t PDUS_I2C_read(uint8_t bytesToRead, uint8_t *valueP);
+static int8_t PDUS_I2C_read(we_dev_t *dev, uint8_t bytesToRead, uint8_t *valueP);
+
+/*
+ * Conversion of the sensor types, the pressure range is mapped linearly on P_MIN_VAL_PDUS .. P_MAX_VAL_PDUS.
+ * kPa/digit as given in the user manual; offset is the pressure at raw value 0, folded at compile time.
+ */
+#define PDUS_CONVERSION(typ, kPaPerDigit, minkPa, minPa, maxPa) \
+	{ typ, kPaPerDigit, (float)(minkPa) - (float)P_MIN_VAL_PDUS * (kPaPerDigit), minPa, (maxPa) - (minPa) }
+
+static const PDUS_conversion_t PDUS_conversions[] = {
+	PDUS_CONVERSION(pdus0, 7.63e-6f, -0.1f, -100, 100),
+	PDUS_CONVERSION(pdus1, 7.63e-5f, -1.0f, -1000, 1000),
+	PDUS_CONVERSION(pdus2, 7.63e-4f, -10.0f, -10000, 10000),
+	PDUS_CONVERSION(pdus3, 3.815e-3f, 0.0f, 0, 100000),
+	PDUS_CONVERSION(pdus4, 4.196e-2f, -100.0f, -100000, 1000000),
+};
 
 
 /**
-* @brief  write the sensor address and read 2 or 4 bytes of data [Funtion not implemented]
-* @param  Pointer to read values (16 or 32 bits) 
+* @brief  write the sensor address and read 2 or 4 bytes of data
+*         No register address is sent, see chapter "reading digital output data" of the PDUS user manual.
+*         Caution: This sensor uses 5 V Vcc and Logic levels.
+*         Level conversion to 3.3 V is required to talk with a raspberry pi or any other 3.3 V MCU
+* @param  Number of bytes to read, 2 (pressure) or 4 (pressure and temperature)
+* @param  Pointer to read values (16 or 32 bits), MSB first
 * @retval Error code
 */
-static int8_t PDUS_I2C_read(uint8_t bytesToRead, uint8_t *valueP)
-{	
-	#warning "Implement the required I2C method here"
-	/* 
-	 * Caution: This sensor uses 5 V Vcc and Logic levels.
-	 * Level conversion to 3.3 V is required to talk with a raspberry pi or any other 3.3 V MCU
-	 * This sensor only supports I2C read operation and returns either 2 or 4 bytes when the sensor address is written in the I2C bus.
-	 * Sending a register address is not required
-	 * The first 2 bytes returned are the raw pressure value and the next 2 bytes are the raw temperature values 
-	 */
-	
-	/* see chapter "reading digital output dat" of the PDUS user manual for the protocol */
-	
-	/* 
-	 * 1st i2c master sends sensor's i2c address (PDUS_ADDRESS_I2C) with read bit set and waits for ACK by sensor
-	 * 2nd i2c master read either 2 or 4 bytes back from the sensor; the slave (sensor) will send up to 4 bytes. master has to ACK each byte and provide clock.
-	 */
-	return WE_FAIL;
+static int8_t PDUS_I2C_read(we_dev_t *dev, uint8_t bytesToRead, uint8_t *valueP)
+{
+	if ((bytesToRead != 2) && (bytesToRead != 4))
+	{
+		return WE_FAIL;
+	}
+
+	return ReadRaw(dev, bytesToRead, valueP);
 }
 
 /**
-* @brief  Read the pressure value
+* @brief  Read the pressure and temperature values
 * @param  Pointer to raw pressure and temperature value (unconverted), 32 bits
 * @retval Error code
 */
-int8_t PDUS_readRawDataP(uint8_t *dataP)
+int8_t PDUS_readRawData(we_dev_t *dev, uint8_t *dataP)
 {
-  if(I2C_read(PDUS_ADDRESS_I2C, 4, dataP))
-  {
-    return WE_SUCCESS;
-  }
-  
-  return WE_FAIL;
+	return PDUS_I2C_read(dev, 4, dataP);
 }
 
 
@@ -76,119 +81,233 @@ int8_t PDUS_readRawDataP(uint8_t *dataP)
 * @param  Pointer to raw pressure value (unconverted), 16 bits
 * @retval Error code
 */
-int8_t PDUS_readRawPressure(uint8_t *dataP)
+int8_t PDUS_readRawPressure(we_dev_t *dev, uint8_t *dataP)
+{
+	return PDUS_I2C_read(dev, 2, dataP);
+}
+
+/**
+* @brief  Read the raw pressure and optionally the raw temperature value, with stale data check
+*         The stale bit is masked out of the returned pressure.
+* @param  Pointer to raw pressure value
+* @param  Pointer to raw temperature value, NULL: read the pressure only (2 bytes)
+* @param  Pointer to stale flag: true if the values have already been read before, NULL: ignore
+* @retval Error code
+*/
+int8_t PDUS_getRawValues(we_dev_t *dev, uint16_t *rawPresP, uint16_t *rawTempP, bool *staleP)
 {
-  if(I2C_read(PDUS_ADDRESS_I2C, 2, dataP))
-  {
-    return WE_SUCCESS;
-  }
-  
-  return WE_FAIL;
+	uint8_t tmp[4];
+
+	if (PDUS_I2C_read(dev, (rawTempP == NULL) ? 2 : 4, tmp) == WE_FAIL)
+	{
+		return WE_FAIL;
+	}
+
+	if (staleP != NULL)
+	{
+		*staleP = (tmp[0] & (PDUS_STATUS_STALE_BIT >> 8)) != 0;
+	}
+
+	*rawPresP = (uint16_t)((tmp[0] << 8) | tmp[1]) & (uint16_t)~PDUS_STATUS_STALE_BIT;
+
+	if (rawTempP != NULL)
+	{
+		*rawTempP = (uint16_t)((tmp[2] << 8) | tmp[3]);
+	}
+
+	return WE_SUCCESS;
 }
 
 
 /**
-* @brief  Read the pressure and temperature values
-* @param  pdus sensor type (i.e. pressure ranges) for internal conversion of pressure
-* @param  Pointer to pressure value
+* @brief  Get the conversion of a sensor type
+*         For the conversion functions below; the getters use the conversion set with PDUS_setSensorType().
+* @param  pdus sensor type (i.e. pressure ranges)
+* @retval Pointer to the conversion, NULL for an unknown type
+*/
+const PDUS_conversion_t *PDUS_getConversion(PDUS_Sensor_Type typ)
+{
+	if ((uint32_t)typ >= sizeof(PDUS_conversions) / sizeof(PDUS_conversions[0]))
+	{
+		return NULL;
+	}
+
+	return &PDUS_conversions[typ];
+}
+
+/**
+* @brief  Set the sensor type of a device
+*         Resolves the conversion once and stores it on the device (we_dev_t.driverData), the getters
+*         below then convert each sample without a lookup. Call once after DeviceInit().
+* @param  pdus sensor type (i.e. pressure ranges)
 * @retval Error code
 */
-int8_t PDUS_getPressure(PDUS_Sensor_Type typ, float *presskPaP)
+int8_t PDUS_setSensorType(we_dev_t *dev, PDUS_Sensor_Type typ)
 {
-	uint8_t tmp[2] = { 0 };
-	uint16_t rawPres = 0, temp = 0;
-	if(PDUS_ReadRawPressure(tmp) == WE_FAIL)
+	const PDUS_conversion_t *conversion = PDUS_getConversion(typ);
+
+	if (conversion == NULL)
 	{
 		return WE_FAIL;
 	}
-	
-    rawPres = (uint16_t)(tmp[0] << 8);
-	rawPres |= (uint16_t)tmp[1];
-	
-	/* perform conversion regarding sensor sub-type */
-	switch(typ)
+
+	dev->driverData = (void *)conversion;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Convert a raw pressure value into kPa
+* @param  Pointer to the conversion
+* @param  Raw pressure value
+* @retval Pressure in kPa
+*/
+float PDUS_convertPressure(const PDUS_conversion_t *conversion, uint16_t rawPres)
+{
+	return (float)rawPres * conversion->kPaPerDigit + conversion->kPaOffset;
+}
+
+/**
+* @brief  Convert a raw pressure value into Pa, integer arithmetic only
+* @param  Pointer to the conversion
+* @param  Raw pressure value
+* @retval Pressure in Pa
+*/
+int32_t PDUS_convertPressureToPa(const PDUS_conversion_t *conversion, uint16_t rawPres)
+{
+	/* up to 2^16 digits times 200000 Pa span exceeds 32 bit */
+	int64_t num = ((int64_t)rawPres - P_MIN_VAL_PDUS) * conversion->spanPa;
+
+	return (int32_t)WE_DIV_ROUND(num, (int64_t)(P_MAX_VAL_PDUS - P_MIN_VAL_PDUS)) + conversion->minPa;
+}
+
+/**
+* @brief  Convert a raw temperature value into °C
+* @param  Raw temperature value
+* @retval Temperature in °C
+*/
+float PDUS_convertTemperature(uint16_t rawTemp)
+{
+	return ((float)rawTemp - T_MIN_VAL_PDUS) * 4.272e-3f;
+}
+
+/**
+* @brief  Convert a buffer of raw pressure values into kPa
+*         Uses the SIMD kernel of the platform (ConvertInt16ToFloat()): the raw values must have the
+*         stale bit cleared, as returned by PDUS_getRawValues(), so that they fit 15 bit.
+* @param  Pointer to the conversion
+* @param  Raw pressure values
+* @param  Converted pressure values in kPa
+* @param  Number of values
+* @retval None
+*/
+void PDUS_convertPressureBuffer(const PDUS_conversion_t *conversion, const uint16_t *rawPres, float *presskPa, int count)
+{
+	ConvertInt16ToFloat((const int16_t *)rawPres, presskPa, count, 0, conversion->kPaPerDigit, conversion->kPaOffset);
+}
+
+/**
+* @brief  Convert a buffer of raw temperature values into °C
+* @param  Raw temperature values
+* @param  Converted temperature values in °C
+* @param  Number of values
+* @retval None
+*/
+void PDUS_convertTemperatureBuffer(const uint16_t *rawTemp, float *tempDegC, int count)
+{
+	int i;
+
+	/* raw temperatures above 125 °C exceed 15 bit, no int16 kernel */
+	for (i = 0; i < count; i++)
+	{
+		tempDegC[i] = PDUS_convertTemperature(rawTemp[i]);
+	}
+}
+
+/**
+* @brief  Read the pressure value
+*         Converted with the sensor type set by PDUS_setSensorType().
+* @param  Pointer to pressure value
+* @retval Error code
+*/
+int8_t PDUS_getPressure(we_dev_t *dev, float *presskPaP)
+{
+	const PDUS_conversion_t *conversion = (const PDUS_conversion_t *)dev->driverData;
+	uint16_t rawPres;
+
+	if ((conversion == NULL) || (PDUS_getRawValues(dev, &rawPres, NULL, NULL) == WE_FAIL))
 	{
-		case pdus0:
-			temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 7.63)/(1000000)) - 0.1; 
-			break;
-		case pdus1:
-		    temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 7.63)/(100000)) - 1; 
-			break;
-		case pdus2:
-		    temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 7.63)/(10000)) - 10; 
-			break;
-		case pdus3:
-		    temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 3.815)/(1000)); 
-			break;
-		case pdus4:
-			temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 4.196)/(100)) + 100; 
-			break;
-		default:
-			return WE_FAIL;
+		return WE_FAIL;
 	}
-	
+
+	*presskPaP = PDUS_convertPressure(conversion, rawPres);
+
 	return WE_SUCCESS;
 }
 
 
 /**
 * @brief  Read the pressure and temperature values
-* @param  pdus sensor type (i.e. pressure ranges) for internal conversion of pressure and temperature
 * @param  Pointer to pressure value
 * @param  Pointer to temperature value
 * @retval Error code
 */
-int8_t PDUS_getPresAndTemp(PDUS_Sensor_Type typ, float *presskPaP, float *tempDegCP)
+int8_t PDUS_getPresAndTemp(we_dev_t *dev, float *presskPaP, float *tempDegCP)
 {
-	uint8_t tmp[4] = { 0 };
-	uint16_t rawPres = 0, temp = 0;
-	uint16_t rawTemp = 0;
-	if(PDUS_readRawDataP(tmp) == WE_FAIL)
+	const PDUS_conversion_t *conversion = (const PDUS_conversion_t *)dev->driverData;
+	uint16_t rawPres, rawTemp;
+
+	if ((conversion == NULL) || (PDUS_getRawValues(dev, &rawPres, &rawTemp, NULL) == WE_FAIL))
 	{
 		return WE_FAIL;
 	}
-	
-    rawPres = (uint16_t)(tmp[0] << 8);
-	rawPres |= (uint16_t)tmp[1];
-	
-	rawTemp = (uint16_t)(tmp[2] << 8);
-	rawTemp |= (uint16_t)tmp[3];
-	
-	temp = rawTemp - T_MIN_VAL_PDUS; /* apply temperature offset to RAW temperature */
-	*tempDegCP = (((float)temp * 4.272)/(1000)); /* convert RAW temperature to °C */
-	
-	/* perform conversion regarding sensor sub-type */
-	switch(typ)
+
+	*presskPaP = PDUS_convertPressure(conversion, rawPres);
+	*tempDegCP = PDUS_convertTemperature(rawTemp);
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read the pressure value in Pa, integer arithmetic only
+* @param  Pointer to pressure value in Pa
+* @retval Error code
+*/
+int8_t PDUS_getPressurePa(we_dev_t *dev, int32_t *pressPaP)
+{
+	const PDUS_conversion_t *conversion = (const PDUS_conversion_t *)dev->driverData;
+	uint16_t rawPres;
+
+	if ((conversion == NULL) || (PDUS_getRawValues(dev, &rawPres, NULL, NULL) == WE_FAIL))
 	{
-		case pdus0:
-			temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 7.63)/(1000000)) - 0.1; 
-			break;
-		case pdus1:
-		    temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 7.63)/(100000)) - 1; 
-			break;
-		case pdus2:
-		    temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 7.63)/(10000)) - 10; 
-			break;
-		case pdus3:
-		    temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 3.815)/(1000)); 
-			break;
-		case pdus4:
-			temp = rawPres - P_MIN_VAL_PDUS;
-			*presskPaP = (((float)temp * 4.196)/(100)) + 100; 
-			break;			
-		default:
-			return WE_FAIL;
+		return WE_FAIL;
 	}
-	
+
+	*pressPaP = PDUS_convertPressureToPa(conversion, rawPres);
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Read the pressure and temperature values in Pa and 0.01 °C, integer arithmetic only
+* @param  Pointer to pressure value in Pa
+* @param  Pointer to temperature value in 0.01 °C
+* @retval Error code
+*/
+int8_t PDUS_getPresAndTempInt(we_dev_t *dev, int32_t *pressPaP, int32_t *tempCentiDegCP)
+{
+	const PDUS_conversion_t *conversion = (const PDUS_conversion_t *)dev->driverData;
+	uint16_t rawPres, rawTemp;
+
+	if ((conversion == NULL) || (PDUS_getRawValues(dev, &rawPres, &rawTemp, NULL) == WE_FAIL))
+	{
+		return WE_FAIL;
+	}
+
+	*pressPaP = PDUS_convertPressureToPa(conversion, rawPres);
+	/* 4.272 m°C per digit above T_MIN_VAL_PDUS */
+	*tempCentiDegCP = WE_DIV_ROUND(((int32_t)rawTemp - T_MIN_VAL_PDUS) * 4272, 10000);
+
 	return WE_SUCCESS;
 }
 
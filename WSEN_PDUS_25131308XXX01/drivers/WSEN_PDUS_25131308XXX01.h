@@ -39,36 +39,73 @@
  * It will automatically send up to 4 bytes as reply to any read request to it's PDUS_ADDRESS_I2C.
  * This sensor does not support write requests.
  * This sensor only has a i2c communication interface alongside the analog interface.
+ * The reads use ReadRaw() of the platform layer, the bus backend has to support register-less reads.
  */
 
 
 #define P_MIN_VAL_PDUS               (uint16_t)3277 /* minimum raw value for pressure */
+#define P_MAX_VAL_PDUS               (uint16_t)29491 /* maximum raw value for pressure */
 #define T_MIN_VAL_PDUS               (uint16_t)8192 /* minimum raw value for temperature in degree celsius */
 
+#define PDUS_STATUS_STALE_BIT        (uint16_t)0x8000 /* status bit of the pressure word, 1: data already read, no new conversion since */
+
 typedef enum {
 	pdus0,           /* order code 2513130810001  Range =  -0.1 to +0.1 kPa */
 	pdus1,           /* order code 2513130810101  Range =  -1 to +1 kPa */
 	pdus2,           /* order code 2513130810201  Range =  -10 to +10 kPa */
 	pdus3,           /* order code 2513130810301  Range =   0 to 100 kPa */
-	pdus4,           /* order code 2513130810401  Range =  -100 to +100 kPa */
+	pdus4,           /* order code 2513130810401  Range =  -100 to +1000 kPa */
 }PDUS_Sensor_Type;
 
+/**
+* Conversion of raw pressure values for one sensor type, see PDUS_getConversion()
+* The table of all types is built at compile time. PDUS_setSensorType() resolves the entry of a device
+* once, so converting a sample is a multiply-add without a lookup of the sensor type.
+*/
+typedef struct {
+	PDUS_Sensor_Type type;
+	float kPaPerDigit;                      /* sensitivity in kPa/digit */
+	float kPaOffset;                        /* pressure in kPa at raw value 0 */
+	int32_t minPa;                          /* pressure in Pa at P_MIN_VAL_PDUS */
+	int32_t spanPa;                         /* pressure range in Pa, P_MIN_VAL_PDUS .. P_MAX_VAL_PDUS */
+}PDUS_conversion_t;
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
 /* reads 4 bytes from the sensor, 16 bit raw pressure, 16 bit raw temperature */
-int8_t PDUS_readRawData(uint8_t *dataP);
+int8_t PDUS_readRawData(we_dev_t *dev, uint8_t *dataP);
 
 /* reads 2 bytes from the sensor, 16 bit raw pressure */
-int8_t PDUS_readRawPressure(uint8_t *dataP);
+int8_t PDUS_readRawPressure(we_dev_t *dev, uint8_t *dataP);
+
+/* reads the raw pressure and, if rawTempP is not NULL, the raw temperature; reports whether the data is stale */
+int8_t PDUS_getRawValues(we_dev_t *dev, uint16_t *rawPresP, uint16_t *rawTempP, bool *staleP);
+
+/* selects the conversion used by the PDUS_getPres* functions, call once after DeviceInit() */
+int8_t PDUS_setSensorType(we_dev_t *dev, PDUS_Sensor_Type typ);
+
+/* conversion of raw values, resolve the conversion of the sensor type once */
+const PDUS_conversion_t *PDUS_getConversion(PDUS_Sensor_Type typ);
+float PDUS_convertPressure(const PDUS_conversion_t *conversion, uint16_t rawPres);
+int32_t PDUS_convertPressureToPa(const PDUS_conversion_t *conversion, uint16_t rawPres);
+float PDUS_convertTemperature(uint16_t rawTemp);
+void PDUS_convertPressureBuffer(const PDUS_conversion_t *conversion, const uint16_t *rawPres, float *presskPa, int count);
+void PDUS_convertTemperatureBuffer(const uint16_t *rawTemp, float *tempDegC, int count);
+
+/* reads the pressure value from the sensor and converts it's raw value according to the sensor type of the device into kPa unit */
+int8_t PDUS_getPressure(we_dev_t *dev, float *presskPaP);
+
+/* reads the pressure value from the sensor and converts it according to the sensor type of the device into Pa, integer arithmetic only */
+int8_t PDUS_getPressurePa(we_dev_t *dev, int32_t *pressPaP);
 
-/* reads the pressure value from the sensor and converts it's raw value according to the selected type into kPa unit */
-int8_t PDUS_getPressure(PDUS_Sensor_Type typ, float *presskPaP);
+/* reads the pressure and ptemperature value from the sensor and converts it's raw value according to the sensor type of the device into kPa unit and °C */
+int8_t PDUS_getPresAndTemp(we_dev_t *dev, float *presskPaP, float *tempDegCP);
 
-/* reads the pressure and ptemperature value from the sensor and converts it's raw value according to the selected type into kPa unit and °C */
-int8_t PDUS_getPresAndTemp(PDUS_Sensor_Type typ, float *presskPaP, float *tempDegCP);
+/* reads the pressure and temperature value from the sensor and converts them into Pa and 0.01 °C, integer arithmetic only */
+int8_t PDUS_getPresAndTempInt(we_dev_t *dev, int32_t *pressPaP, int32_t *tempCentiDegCP);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,128 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "WSEN_PDUS_25131308XXX01_sim.h"
+#include "WSEN_PDUS_25131308XXX01.h"
+#include <string.h>
+
+#define PDUS_SIM_PERIOD_US           1000 /* conversion period */
+
+/*
+ * The reply of the sensor is modeled as registers 0 .. 3 read with auto increment:
+ * pressure MSB, pressure LSB, temperature MSB, temperature LSB
+ */
+#define PDUS_SIM_P_H                 0
+#define PDUS_SIM_P_L                 1
+#define PDUS_SIM_T_H                 2
+#define PDUS_SIM_T_L                 3
+
+
+/**
+* @brief  Store one sample in the output registers and clear the stale bit
+* @param  -sim : simulated device
+* @retval None
+*/
+static void PDUS_simSample(we_sim_device_t *sim)
+{
+	uint16_t pressure;
+	uint16_t temperature;
+
+	sim->sampleCount++;
+	/* around mid-scale of P_MIN_VAL_PDUS .. P_MAX_VAL_PDUS */
+	pressure = (uint16_t)((P_MIN_VAL_PDUS + P_MAX_VAL_PDUS) / 2 + SimWave(sim->sampleCount, 2000, 500));
+	/* 20 to 30 degC, 4.272 m°C per digit */
+	temperature = (uint16_t)(T_MIN_VAL_PDUS + 5852 + SimWave(sim->sampleCount, 1170, 2000));
+
+	sim->regs[PDUS_SIM_P_H] = (uint8_t)(pressure >> 8);
+	sim->regs[PDUS_SIM_P_L] = (uint8_t)(pressure & 0xFF);
+	sim->regs[PDUS_SIM_T_H] = (uint8_t)(temperature >> 8);
+	sim->regs[PDUS_SIM_T_L] = (uint8_t)(temperature & 0xFF);
+}
+
+/**
+* @brief  Power-on: the first conversion is available right away
+* @param  -sim : simulated device
+* @retval None
+*/
+static void PDUS_simReset(we_sim_device_t *sim)
+{
+	memset(sim->regs, 0, sizeof(sim->regs));
+	sim->periodUs = 0;
+	PDUS_simSample(sim);
+}
+
+/**
+* @brief  Produce the samples due up to the current time, the sensor converts continuously
+* @param  -sim : simulated device
+* @retval None
+*/
+static void PDUS_simUpdate(we_sim_device_t *sim)
+{
+	uint32_t due;
+
+	for (due = SimSamplesDue(sim, PDUS_SIM_PERIOD_US); due > 0; due--)
+	{
+		PDUS_simSample(sim);
+	}
+}
+
+/**
+* @brief  Read one byte of the reply, reading the pressure MSB marks the data as stale
+* @param  -sim : simulated device
+*         -RegAdr : byte index in the reply
+* @retval byte value
+*/
+static uint8_t PDUS_simRead(we_sim_device_t *sim, uint8_t RegAdr)
+{
+	uint8_t value = sim->regs[RegAdr];
+
+	if (RegAdr == PDUS_SIM_P_H)
+	{
+		sim->regs[PDUS_SIM_P_H] |= (uint8_t)(PDUS_STATUS_STALE_BIT >> 8);
+	}
+	return value;
+}
+
+/**
+* @brief  Address of the next byte, the sensor sends at most 4 bytes
+* @param  -sim : simulated device
+*         -RegAdr : current byte index
+* @retval next byte index
+*/
+static uint8_t PDUS_simNextAddress(we_sim_device_t *sim, uint8_t RegAdr)
+{
+	(void)sim;
+	return (RegAdr < PDUS_SIM_T_L) ? (uint8_t)(RegAdr + 1) : PDUS_SIM_T_L;
+}
+
+const we_sim_model_t PDUS_simModel = {
+	PDUS_simReset,
+	PDUS_simUpdate,
+	PDUS_simRead,
+	NULL,
+	PDUS_simNextAddress
+};
+
+/**         EOF         */
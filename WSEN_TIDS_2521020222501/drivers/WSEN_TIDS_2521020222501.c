@@ -24,40 +24,73 @@
 **/
 
 #include "WSEN_TIDS_2521020222501.h"
+#include "platform_convert.h"
 #include <stdio.h>
 
 
+/* images of the consecutive registers LIMIT_T_H, LIMIT_T_L and CTRL */
+typedef struct {
+	uint8_t highLimit;
+	uint8_t lowLimit;
+	TIDS_ctrl_t ctrl;
+} TIDS_ctrl_block_t;
+
+static int8_t TIDS_readCtrlBlock(we_dev_t *dev, TIDS_ctrl_block_t *ctrl);
+
+
 /**
 * @brief  Read the device ID
 * @param  Pointer to device ID.
 * @retval Error code
 */
-int8_t TIDS_getDeviceID(uint8_t *devID)
+int8_t TIDS_getDeviceID(we_dev_t *dev, uint8_t *devID)
 {
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_DEVICE_ID_REG, 1, devID))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_DEVICE_ID_REG, 1, devID))
 	return WE_FAIL;
 
 	return WE_SUCCESS; /* expected value is TIDS_DEVICE_ID_VALUE */
 
 }
 
+/* temperature limits (CTRL has the self-clearing one-shot bit and is read from the sensor every time) */
+static const uint8_t TIDS_cachedRegs[] = {
+	TIDS_LIMIT_T_H_REG, TIDS_LIMIT_T_L_REG
+};
+
+/**
+* @brief  Attach a register shadow cache and load it from the sensor
+*         Setters then need a single bus write, configuration getters are served from memory.
+* @param  Pointer to the cache storage, must stay valid as long as the device is used
+* @retval Error code
+*/
+int8_t TIDS_enableRegisterCache(we_dev_t *dev, we_reg_cache_t *cache)
+{
+	if (WE_FAIL == RegCacheInit(dev, cache, TIDS_cachedRegs, sizeof(TIDS_cachedRegs)))
+	return WE_FAIL;
+
+	return RegCacheSync(dev);
+}
+
 /**
 * @brief  Set software reset [enabled,disabled]
 * @param  state
 * @retval Error code
 */
-int8_t TIDS_setSwReset(TIDS_state_t mode)
+int8_t TIDS_setSwReset(we_dev_t *dev, TIDS_state_t mode)
 {
 	TIDS_soft_reset_t swRstReg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
 	return WE_FAIL;
 
 	swRstReg.reset = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
 	return WE_FAIL;
 
+	/* all registers are reloaded with their default values */
+	RegCacheInvalidate(dev);
+
 	return WE_SUCCESS;
 }
 
@@ -66,11 +99,11 @@ int8_t TIDS_setSwReset(TIDS_state_t mode)
 * @param  Pointer to software reset state
 * @retval Error code
 */
-int8_t TIDS_getSwReset(TIDS_state_t *mode)
+int8_t TIDS_getSwReset(we_dev_t *dev, TIDS_state_t *mode)
 {
 	TIDS_soft_reset_t swRstReg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_SOFT_RESET_REG, 1, (uint8_t *)&swRstReg))
 	return WE_FAIL;
 	
 	*mode = (TIDS_state_t)swRstReg.reset;
@@ -82,16 +115,16 @@ int8_t TIDS_getSwReset(TIDS_state_t *mode)
 * @param  mode
 * @retval Error code
 */
-int8_t TIDS_setContinuousMode(TIDS_state_t mode)
+int8_t TIDS_setContinuousMode(we_dev_t *dev, TIDS_state_t mode)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.freeRunBit = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -101,11 +134,11 @@ int8_t TIDS_setContinuousMode(TIDS_state_t mode)
 * @param  Pointer to Single Conversion Mode state
 * @retval Error code
 */
-int8_t TIDS_getContinuousMode(TIDS_state_t *mode)
+int8_t TIDS_getContinuousMode(we_dev_t *dev, TIDS_state_t *mode)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 	
 	*mode = (TIDS_state_t)ctrl_reg.freeRunBit;
@@ -117,16 +150,16 @@ int8_t TIDS_getContinuousMode(TIDS_state_t *mode)
 * @param  state
 * @retval Error code
 */
-int8_t TIDS_setBlockDataUpdate(TIDS_state_t bdu)
+int8_t TIDS_setBlockDataUpdate(we_dev_t *dev, TIDS_state_t bdu)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.blockDataUpdate = bdu;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -137,11 +170,11 @@ int8_t TIDS_setBlockDataUpdate(TIDS_state_t bdu)
 * @param  pointer to auto Increment state
 * @retval Error code
 */
-int8_t TIDS_getBlockDataUpdate(TIDS_state_t *bdu)
+int8_t TIDS_getBlockDataUpdate(we_dev_t *dev, TIDS_state_t *bdu)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 	
 	*bdu = (TIDS_state_t)ctrl_reg.blockDataUpdate;
@@ -153,16 +186,16 @@ int8_t TIDS_getBlockDataUpdate(TIDS_state_t *bdu)
 * @param  output data rate
 * @retval Error code
 */
-int8_t TIDS_setOutputDataRate(TIDS_output_data_rate_t odr)
+int8_t TIDS_setOutputDataRate(we_dev_t *dev, TIDS_output_data_rate_t odr)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.outputDataRate = odr;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -173,11 +206,11 @@ int8_t TIDS_setOutputDataRate(TIDS_output_data_rate_t odr)
 * @param  Pointer to Output Data Rate
 * @retval Error code
 */
-int8_t TIDS_getOutputDataRate(TIDS_output_data_rate_t* odr)
+int8_t TIDS_getOutputDataRate(we_dev_t *dev, TIDS_output_data_rate_t* odr)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	*odr = (TIDS_output_data_rate_t)ctrl_reg.outputDataRate;
@@ -189,16 +222,16 @@ int8_t TIDS_getOutputDataRate(TIDS_output_data_rate_t* odr)
 * @param  mode
 * @retval Error code
 */
-int8_t TIDS_setSingleConvMode(TIDS_state_t mode)
+int8_t TIDS_setSingleConvMode(we_dev_t *dev, TIDS_state_t mode)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.oneShotbit = mode;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -209,11 +242,11 @@ int8_t TIDS_setSingleConvMode(TIDS_state_t mode)
 * @param  Pointer to Single Conversion Mode state
 * @retval Error code
 */
-int8_t TIDS_getSingleConvMode(TIDS_state_t *mode)
+int8_t TIDS_getSingleConvMode(we_dev_t *dev, TIDS_state_t *mode)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 	
 	*mode = (TIDS_state_t)ctrl_reg.oneShotbit;
@@ -225,16 +258,16 @@ int8_t TIDS_getSingleConvMode(TIDS_state_t *mode)
 * @param  state
 * @retval Error code
 */
-int8_t TIDS_setAutoIncrement(TIDS_state_t inc)
+int8_t TIDS_setAutoIncrement(we_dev_t *dev, TIDS_state_t inc)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	ctrl_reg.autoAddIncr = inc;
 
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -245,11 +278,11 @@ int8_t TIDS_setAutoIncrement(TIDS_state_t inc)
 * @param  pointer to auto Increment state
 * @retval Error code
 */
-int8_t TIDS_getAutoIncrement(TIDS_state_t *inc)
+int8_t TIDS_getAutoIncrement(we_dev_t *dev, TIDS_state_t *inc)
 {
 	TIDS_ctrl_t ctrl_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
 	return WE_FAIL;
 	
 	*inc = (TIDS_state_t)ctrl_reg.autoAddIncr;
@@ -262,11 +295,11 @@ int8_t TIDS_getAutoIncrement(TIDS_state_t *inc)
 * @param  pointer to busy State
 * @retval error code
 */
-int8_t TIDS_getBusyStatus(TIDS_state_t *state)
+int8_t TIDS_getBusyStatus(we_dev_t *dev, TIDS_state_t *state)
 {
 	TIDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	
 	*state = (TIDS_state_t)status_reg.busy;
@@ -278,11 +311,11 @@ int8_t TIDS_getBusyStatus(TIDS_state_t *state)
 * @param  pointer to State
 * @retval error code
 */
-int8_t TIDS_getOverHighLimStatus(TIDS_state_t *state)
+int8_t TIDS_getOverHighLimStatus(we_dev_t *dev, TIDS_state_t *state)
 {
 	TIDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	
 	*state = (TIDS_state_t)status_reg.overLimit;
@@ -294,11 +327,11 @@ int8_t TIDS_getOverHighLimStatus(TIDS_state_t *state)
 * @param  pointer to State
 * @retval error code
 */
-int8_t TIDS_getUnderLowLimStatus(TIDS_state_t *state)
+int8_t TIDS_getUnderLowLimStatus(we_dev_t *dev, TIDS_state_t *state)
 {
 	TIDS_status_t status_reg;
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_STATUS_REG, 1, (uint8_t *)&status_reg))
 	return WE_FAIL;
 	
 	*state = (TIDS_state_t)status_reg.underlimit;
@@ -310,14 +343,14 @@ int8_t TIDS_getUnderLowLimStatus(TIDS_state_t *state)
 * @param  pointer to Temperature Measurement
 * @retval Error code
 */
-int8_t TIDS_getRAWTemperature(int16_t *rawTemp)
+int8_t TIDS_getRAWTemperature(we_dev_t *dev, int16_t *rawTemp)
 {
 	uint8_t tmp[2] = { 0 };
 
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_DATA_T_L_REG, 1, &tmp[0]))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_DATA_T_L_REG, 1, &tmp[0]))
 	return WE_FAIL;
 	
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_DATA_T_H_REG, 1, &tmp[1]))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_DATA_T_H_REG, 1, &tmp[1]))
 	return WE_FAIL;
 
 	*rawTemp = (int16_t)(tmp[1] << 8);
@@ -330,10 +363,10 @@ int8_t TIDS_getRAWTemperature(int16_t *rawTemp)
 * @param  Pointer to Temperature Measurement
 * @retval Error code
 */
-int8_t TIDS_getTemperature(float *tempdegC)
+int8_t TIDS_getTemperature(we_dev_t *dev, float *tempdegC)
 {
 	int16_t rawTemp = 0;
-	if(WE_FAIL == TIDS_getRAWTemperature(&rawTemp))
+	if(WE_FAIL == TIDS_getRAWTemperature(dev, &rawTemp))
 	return WE_FAIL;
 
 	*tempdegC = (float)rawTemp;
@@ -346,9 +379,9 @@ int8_t TIDS_getTemperature(float *tempdegC)
 * @param  High limit
 * @retval Error code
 */
-int8_t TIDS_setTempHighLimit(uint8_t hLimit)
+int8_t TIDS_setTempHighLimit(we_dev_t *dev, uint8_t hLimit)
 {
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_LIMIT_T_H_REG, 1, &hLimit))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)TIDS_LIMIT_T_H_REG, 1, &hLimit))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -358,9 +391,9 @@ int8_t TIDS_setTempHighLimit(uint8_t hLimit)
 * @param  pointer to temperature high limit
 * @retval Error code
 */
-int8_t TIDS_getTempHighLimit(uint8_t *hLimit)
+int8_t TIDS_getTempHighLimit(we_dev_t *dev, uint8_t *hLimit)
 {
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_LIMIT_T_H_REG, 1, hLimit))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_LIMIT_T_H_REG, 1, hLimit))
 	return WE_FAIL;
 	
 	return WE_SUCCESS;
@@ -372,9 +405,9 @@ int8_t TIDS_getTempHighLimit(uint8_t *hLimit)
 * @param  Low limit
 * @retval Error code
 */
-int8_t TIDS_setTempLowLimit(uint8_t lLimit)
+int8_t TIDS_setTempLowLimit(we_dev_t *dev, uint8_t lLimit)
 {
-	if (WE_FAIL == WriteReg((uint8_t)TIDS_LIMIT_T_L_REG, 1, &lLimit))
+	if (WE_FAIL == WriteReg(dev, (uint8_t)TIDS_LIMIT_T_L_REG, 1, &lLimit))
 	return WE_FAIL;
 
 	return WE_SUCCESS;
@@ -386,12 +419,490 @@ int8_t TIDS_setTempLowLimit(uint8_t lLimit)
 * @param  pointer to temperature low limit
 * @retval Error code
 */
-int8_t TIDS_getTempLowLimit(uint8_t *lLimit)
+int8_t TIDS_getTempLowLimit(we_dev_t *dev, uint8_t *lLimit)
 {
-	if (WE_FAIL == ReadReg((uint8_t)TIDS_LIMIT_T_L_REG, 1, lLimit))
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_LIMIT_T_L_REG, 1, lLimit))
 	return WE_FAIL;
 	
 	return WE_SUCCESS;
 }
 
+/* Integer output */
+
+/**
+* @brief  Read the measured temperature value in 0.01 °C, integer arithmetic only
+* @param  Pointer to temperature in 0.01 °C
+* @retval Error code
+*/
+int8_t TIDS_getTemperatureCentiDegC(we_dev_t *dev, int32_t *tempCentiDegC)
+{
+	int16_t rawTemp = 0;
+
+	if (WE_FAIL == TIDS_getRAWTemperature(dev, &rawTemp))
+	return WE_FAIL;
+
+	/* the raw value already is in 0.01 °C */
+	*tempCentiDegC = rawTemp;
+	return WE_SUCCESS;
+}
+
+/* Conversion of sample buffers */
+
+/**
+* @brief  Convert a buffer of raw temperature values to °C (100 digit/°C)
+*         Uses the SIMD kernel of the platform (ConvertInt16ToFloat()), the division is replaced by
+*         a multiplication with the reciprocal.
+* @param  Raw temperature values as returned by TIDS_getRAWTemperature()
+* @param  Converted temperature values in °C
+* @param  Number of values
+* @retval None
+*/
+void TIDS_convertTemperatureBuffer(const int16_t *rawTemp, float *tempdegC, int count)
+{
+	ConvertInt16ToFloat(rawTemp, tempdegC, count, 0, 1.0f / 100.0f, 0.0f);
+}
+
+/* Configuration */
+
+/**
+* @brief  Read LIMIT_T_H, LIMIT_T_L and CTRL in a single batch (one byte per register, independent of IF_ADD_INC)
+* @param  Pointer to the register images
+* @retval Error code
+*/
+static int8_t TIDS_readCtrlBlock(we_dev_t *dev, TIDS_ctrl_block_t *ctrl)
+{
+	we_reg_read_t reads[sizeof(TIDS_ctrl_block_t)];
+	int i;
+
+	for (i = 0; i < (int)sizeof(TIDS_ctrl_block_t); i++)
+	{
+		reads[i].RegAdr = (uint8_t)(TIDS_LIMIT_T_H_REG + i);
+		reads[i].NumByteToRead = 1;
+		reads[i].Data = (uint8_t *)ctrl + i;
+	}
+
+	return ReadRegBatch(dev, reads, sizeof(TIDS_ctrl_block_t));
+}
+
+/**
+* @brief  Apply a complete configuration, the bus lock is held by the caller
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+static int8_t TIDS_writeConfig(we_dev_t *dev, const TIDS_config_t *config)
+{
+	TIDS_ctrl_block_t current, target;
+	bool burst;
+
+	if (WE_FAIL == TIDS_readCtrlBlock(dev, &current))
+	return WE_FAIL;
+
+	target = current;
+
+	/* never re-trigger a single conversion */
+	target.ctrl.oneShotbit = 0;
+
+	target.highLimit = config->highLimit;
+	target.lowLimit = config->lowLimit;
+	target.ctrl.freeRunBit = config->freeRun;
+	target.ctrl.outputDataRate = config->outputDataRate;
+	target.ctrl.blockDataUpdate = config->blockDataUpdate;
+	target.ctrl.autoAddIncr = config->autoIncrement;
+
+	/* a burst needs the address auto increment before and after the write */
+	burst = current.ctrl.autoAddIncr && target.ctrl.autoAddIncr;
+
+	if (WE_FAIL == WriteRegDiff(dev, TIDS_LIMIT_T_H_REG, sizeof(TIDS_ctrl_block_t), (uint8_t *)&current, (uint8_t *)&target, burst))
+	return WE_FAIL;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Apply a complete configuration
+*         The final register images are computed first; only the registers that change are written, in one burst.
+*         Runs as one bus transaction, no other thread can access the bus between reading the current
+*         and writing the new register images.
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+int8_t TIDS_applyConfig(we_dev_t *dev, const TIDS_config_t *config)
+{
+	int8_t ret;
+
+	BusLock(dev->bus);
+	ret = TIDS_writeConfig(dev, config);
+	BusUnlock(dev->bus);
+
+	return ret;
+}
+
+/**
+* @brief  Read the current configuration in a single batch
+* @param  Pointer to the configuration
+* @retval Error code
+*/
+int8_t TIDS_readConfig(we_dev_t *dev, TIDS_config_t *config)
+{
+	TIDS_ctrl_block_t ctrl;
+
+	if (WE_FAIL == TIDS_readCtrlBlock(dev, &ctrl))
+	return WE_FAIL;
+
+	config->highLimit = ctrl.highLimit;
+	config->lowLimit = ctrl.lowLimit;
+	config->freeRun = (TIDS_state_t)ctrl.ctrl.freeRunBit;
+	config->outputDataRate = (TIDS_output_data_rate_t)ctrl.ctrl.outputDataRate;
+	config->blockDataUpdate = (TIDS_state_t)ctrl.ctrl.blockDataUpdate;
+	config->autoIncrement = (TIDS_state_t)ctrl.ctrl.autoAddIncr;
+
+	return WE_SUCCESS;
+}
+
+/* One-shot conversion */
+
+/**
+* @brief  Trigger a single conversion: one-shot bit set, free run cleared
+*         CTRL is read and written as one bus transaction.
+* @retval Error code
+*/
+int8_t TIDS_triggerOneShot(we_dev_t *dev)
+{
+	TIDS_ctrl_t ctrl_reg;
+	int8_t ret = WE_FAIL;
+
+	BusLock(dev->bus);
+	if (WE_SUCCESS == ReadReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg))
+	{
+		ctrl_reg.freeRunBit = 0;
+		ctrl_reg.oneShotbit = 1;
+		ret = WriteReg(dev, (uint8_t)TIDS_CTRL_REG, 1, (uint8_t *)&ctrl_reg);
+	}
+	BusUnlock(dev->bus);
+
+	return ret;
+}
+
+/**
+* @brief  Read the result of a single conversion triggered with TIDS_triggerOneShot()
+*         Call it TIDS_ONE_SHOT_TIME_MS after the trigger: STATUS and the output registers are read in
+*         a single batch instead of polling the busy bit. Reading STATUS clears the limit flags.
+* @param  Pointer to the raw temperature, unchanged if the conversion is not complete
+* @retval Error code, WE_FAIL if the sensor is still busy
+*/
+int8_t TIDS_readOneShotResult(we_dev_t *dev, int16_t *rawTemp)
+{
+	TIDS_status_t status_reg;
+	uint8_t tmp[2];
+	we_reg_read_t reads[3] = {
+		{ TIDS_STATUS_REG, 1, (uint8_t *)&status_reg },
+		{ TIDS_DATA_T_L_REG, 1, &tmp[0] },
+		{ TIDS_DATA_T_H_REG, 1, &tmp[1] }
+	};
+
+	if (WE_FAIL == ReadRegBatch(dev, reads, 3))
+	return WE_FAIL;
+
+	if (status_reg.busy)
+	return WE_FAIL;
+
+	*rawTemp = (int16_t)((tmp[1] << 8) | tmp[0]);
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Run a single conversion and read its result
+*         Waits the conversion time with BusDelay(), the busy bit is not polled.
+* @param  Pointer to the raw temperature (0.01 degC per digit)
+* @retval Error code
+*/
+int8_t TIDS_getOneShotTemperature(we_dev_t *dev, int16_t *rawTemp)
+{
+	if (WE_FAIL == TIDS_triggerOneShot(dev))
+	return WE_FAIL;
+
+	BusDelay(dev->bus, TIDS_ONE_SHOT_TIME_MS);
+
+	return TIDS_readOneShotResult(dev, rawTemp);
+}
+
+/**
+* @brief  Run a single conversion on several sensors at once
+*         All sensors are triggered first, the conversion time is waited once, then the results are
+*         collected. The sensors convert in parallel, so the whole batch takes one conversion time plus
+*         three bus transactions per sensor. Buses with a time base of their own (simulated clock) are
+*         advanced once each, all others share a single wall clock delay().
+*         Sensors whose trigger failed are not read and reported as WE_FAIL.
+* @param  Sensors
+* @param  Number of sensors, at most TIDS_ONE_SHOT_MAX_DEVICES
+* @param  Raw temperatures (0.01 degC per digit), one per sensor
+* @param  Result per sensor (WE_SUCCESS / WE_FAIL), or NULL
+* @retval Error code, WE_FAIL if any of the sensors failed
+*/
+int8_t TIDS_getOneShotTemperatures(we_dev_t *const *devs, int count, int16_t *rawTemp, int8_t *results)
+{
+	uint8_t triggered[TIDS_ONE_SHOT_MAX_DEVICES / 8] = {0};
+	int8_t ret = WE_SUCCESS;
+	int8_t devRet;
+	bool busDelayed;
+	bool wallClockDelay = false;
+	int i;
+	int j;
+
+	if ((count <= 0) || (count > TIDS_ONE_SHOT_MAX_DEVICES))
+	return WE_FAIL;
+
+	for (i = 0; i < count; i++)
+	{
+		devRet = TIDS_triggerOneShot(devs[i]);
+		if (devRet == WE_SUCCESS)
+		{
+			triggered[i / 8] |= (uint8_t)(1 << (i % 8));
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		if (!(triggered[i / 8] & (1 << (i % 8))))
+		{
+			continue;
+		}
+
+		if (devs[i]->bus->ops->delay == NULL)
+		{
+			wallClockDelay = true;
+			continue;
+		}
+
+		busDelayed = false;
+		for (j = 0; (j < i) && !busDelayed; j++)
+		{
+			busDelayed = (triggered[j / 8] & (1 << (j % 8))) && (devs[j]->bus == devs[i]->bus);
+		}
+		if (!busDelayed)
+		{
+			BusDelay(devs[i]->bus, TIDS_ONE_SHOT_TIME_MS);
+		}
+	}
+
+	if (wallClockDelay)
+	{
+		delay(TIDS_ONE_SHOT_TIME_MS);
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		if (triggered[i / 8] & (1 << (i % 8)))
+		{
+			devRet = TIDS_readOneShotResult(devs[i], &rawTemp[i]);
+		}
+		else
+		{
+			devRet = WE_FAIL;
+		}
+
+		if (results != NULL)
+		{
+			results[i] = devRet;
+		}
+		if (devRet == WE_FAIL)
+		{
+			ret = WE_FAIL;
+		}
+	}
+
+	return ret;
+}
+
+/* Interrupt driven acquisition */
+
+/**
+* @brief  Wait for a temperature limit event
+*         Sleeps on the interrupt line connected to INT (active when a limit set with TIDS_setTempHighLimit()
+*         or TIDS_setTempLowLimit() is crossed), then reads STATUS once to report which limit it was.
+*         Without an interrupt line (NULL) the status is polled once per ms.
+* @param  Interrupt line connected to INT, or NULL
+* @param  Maximum time to wait in ms, -1: no timeout
+* @param  Pointer to high limit exceeded state
+* @param  Pointer to low limit exceeded state; both TIDS_disable on timeout
+* @retval Error code
+*/
+int8_t TIDS_waitForLimitEvent(we_dev_t *dev, we_int_line_t *intLine, int timeoutMs, TIDS_state_t *overHighLimit, TIDS_state_t *underLowLimit)
+{
+	uint8_t status;
+	bool fired;
+	int elapsedMs = 0;
+
+	while (1)
+	{
+		if (intLine != NULL)
+		{
+			if (WE_FAIL == IntLineWait(intLine, timeoutMs, &fired))
+			return WE_FAIL;
+		}
+
+		/* a single read: the limit flags are cleared when STATUS is read */
+		if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_STATUS_REG, 1, &status))
+		return WE_FAIL;
+
+		*overHighLimit = (status & 0x02) ? TIDS_enable : TIDS_disable;
+		*underLowLimit = (status & 0x04) ? TIDS_enable : TIDS_disable;
+
+		if ((intLine != NULL) || (*overHighLimit == TIDS_enable) || (*underLowLimit == TIDS_enable) ||
+			((timeoutMs >= 0) && (elapsedMs >= timeoutMs)))
+		return WE_SUCCESS;
+
+		BusDelay(dev->bus, 1);
+		elapsedMs++;
+	}
+}
+
+/* Limit event mode */
+
+/**
+* @brief  Convert a temperature into a limit register value: (value - 63) * 0.64 degC
+* @param  Temperature in degC
+* @param  true: round up (high limit), false: round down (low limit)
+* @retval Limit register value, clamped to 1 .. 255 (0 disables the limit)
+*/
+static uint8_t TIDS_limitFromDegC(float degC, bool roundUp)
+{
+	/* limit steps of 64 in 0.01 degC, rounded towards the outside of the window */
+	int32_t centi = (int32_t)(degC * 100.0f + ((degC < 0) ? -0.5f : 0.5f));
+	int32_t steps = (centi >= 0) ? (centi / 64) : -((-centi + 63) / 64);
+
+	if (roundUp && (steps * 64 < centi))
+	{
+		steps++;
+	}
+
+	steps += 63;
+	if (steps < 1)
+	{
+		steps = 1;
+	}
+	else if (steps > 255)
+	{
+		steps = 255;
+	}
+	return (uint8_t)steps;
+}
+
+/**
+* @brief  Program the limits in degC, rounded to the 0.64 degC resolution of the limit registers so
+*         that the window [lowDegC, highDegC] is not narrowed
+* @param  Pointer to the monitor holding the current limit register values
+* @param  Low limit in degC
+* @param  High limit in degC
+* @retval Error code
+*/
+static int8_t TIDS_armLimits(we_dev_t *dev, TIDS_limit_monitor_t *monitor, float lowDegC, float highDegC)
+{
+	uint8_t target[2];
+
+	target[0] = TIDS_limitFromDegC(highDegC, true);
+	target[1] = TIDS_limitFromDegC(lowDegC, false);
+
+	/* only the limits that move are written */
+	if (WE_FAIL == WriteRegDiff(dev, TIDS_LIMIT_T_H_REG, 2, monitor->limits, target, false))
+	return WE_FAIL;
+
+	monitor->limits[0] = target[0];
+	monitor->limits[1] = target[1];
+	monitor->highLimitDegC = ((int32_t)monitor->limits[0] - 63) * 0.64f;
+	monitor->lowLimitDegC = ((int32_t)monitor->limits[1] - 63) * 0.64f;
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Start the limit event mode
+*         Enables free run (the limits are compared at the output data rate), programs the initial limits
+*         in one burst and clears pending limit flags. INT is then active as soon as a limit is crossed.
+* @param  Pointer to the monitor state, must stay valid as long as the event mode is used
+* @param  Initial low limit in degC
+* @param  Initial high limit in degC
+* @param  Hysteresis in degC: after an event the limits are re-armed this far below and above the
+*         current temperature
+* @retval Error code
+*/
+int8_t TIDS_startLimitMonitor(we_dev_t *dev, TIDS_limit_monitor_t *monitor, float lowDegC, float highDegC, float hysteresisDegC)
+{
+	TIDS_config_t config;
+	uint8_t status;
+
+	if ((hysteresisDegC <= 0) || (lowDegC >= highDegC))
+	return WE_FAIL;
+
+	if (WE_FAIL == TIDS_readConfig(dev, &config))
+	return WE_FAIL;
+
+	monitor->hysteresisDegC = hysteresisDegC;
+
+	config.highLimit = TIDS_limitFromDegC(highDegC, true);
+	config.lowLimit = TIDS_limitFromDegC(lowDegC, false);
+	config.freeRun = TIDS_enable;
+
+	if (WE_FAIL == TIDS_applyConfig(dev, &config))
+	return WE_FAIL;
+
+	monitor->limits[0] = config.highLimit;
+	monitor->limits[1] = config.lowLimit;
+	monitor->highLimitDegC = ((int32_t)config.highLimit - 63) * 0.64f;
+	monitor->lowLimitDegC = ((int32_t)config.lowLimit - 63) * 0.64f;
+
+	/* the limit flags are cleared on read */
+	if (WE_FAIL == ReadReg(dev, (uint8_t)TIDS_STATUS_REG, 1, &status))
+	return WE_FAIL;
+
+	return WE_SUCCESS;
+}
+
+/**
+* @brief  Wait for the next limit event of the limit event mode
+*         Sleeps in TIDS_waitForLimitEvent(); on an event the temperature is read and the limits are re-armed
+*         around it (temperature -/+ hysteresis), so the next event needs a change of at least the hysteresis.
+*         No bus traffic while the temperature stays within the limits (with an interrupt line).
+* @param  Pointer to the monitor state set up with TIDS_startLimitMonitor()
+* @param  Interrupt line connected to INT, or NULL (STATUS polled once per ms)
+* @param  Maximum time to wait in ms, -1: no timeout
+* @param  Pointer to the event, TIDS_noLimitEvent on timeout
+* @param  Pointer to the temperature at the event in degC, unchanged on timeout; NULL: not needed
+* @retval Error code
+*/
+int8_t TIDS_waitForLimitMonitorEvent(we_dev_t *dev, TIDS_limit_monitor_t *monitor, we_int_line_t *intLine, int timeoutMs,
+	TIDS_limit_event_t *event, float *tempDegC)
+{
+	TIDS_state_t overHighLimit, underLowLimit;
+	int16_t rawTemp;
+	float temperature;
+
+	if (WE_FAIL == TIDS_waitForLimitEvent(dev, intLine, timeoutMs, &overHighLimit, &underLowLimit))
+	return WE_FAIL;
+
+	if (overHighLimit == TIDS_enable)
+	{
+		*event = TIDS_overHighLimitEvent;
+	}
+	else if (underLowLimit == TIDS_enable)
+	{
+		*event = TIDS_underLowLimitEvent;
+	}
+	else
+	{
+		*event = TIDS_noLimitEvent;
+		return WE_SUCCESS;
+	}
+
+	if (WE_FAIL == TIDS_getRAWTemperature(dev, &rawTemp))
+	return WE_FAIL;
+
+	temperature = (float)rawTemp / 100;
+	if (tempDegC != NULL)
+	{
+		*tempDegC = temperature;
+	}
+
+	return TIDS_armLimits(dev, monitor, temperature - monitor->hysteresisDegC, temperature + monitor->hysteresisDegC);
+}
+
 /**         EOF         */
@@ -55,6 +55,10 @@
 #define TIDS_DATA_T_H_REG					(uint8_t)0x07 		/* Temperature Output MSB value Register */
 #define TIDS_SOFT_RESET_REG					(uint8_t)0x0C    	/* Software reset register */
 
+/**         Timing         */
+#define TIDS_ONE_SHOT_TIME_MS				10					/* maximum duration of a single conversion */
+#define TIDS_ONE_SHOT_MAX_DEVICES			128					/* maximum number of sensors per TIDS_getOneShotTemperatures() call */
+
 /**         Register type definitions         */
 /**
 * Control Register
@@ -121,55 +125,114 @@ typedef enum {
 } TIDS_output_data_rate_t;
 
 
+/**
+* Sensor configuration applied with TIDS_applyConfig() and read with TIDS_readConfig()
+* Covers LIMIT_T_H, LIMIT_T_L and CTRL.
+*/
+typedef struct {
+	uint8_t highLimit;                       /* LIMIT_T_H, 0: disabled */
+	uint8_t lowLimit;                        /* LIMIT_T_L, 0: disabled */
+	TIDS_state_t freeRun;                    /* CTRL FREERUN */
+	TIDS_output_data_rate_t outputDataRate;  /* CTRL AVG[1:0] */
+	TIDS_state_t blockDataUpdate;            /* CTRL BDU */
+	TIDS_state_t autoIncrement;              /* CTRL IF_ADD_INC */
+} TIDS_config_t;
+
+
+typedef enum {
+	TIDS_noLimitEvent = 0,                   /* timeout */
+	TIDS_overHighLimitEvent = 1,             /* temperature exceeded the high limit */
+	TIDS_underLowLimitEvent = 2              /* temperature fell below the low limit */
+} TIDS_limit_event_t;
+
+/**
+* State of the limit event mode, see TIDS_startLimitMonitor()
+*/
+typedef struct {
+	float hysteresisDegC;                    /* distance of the re-armed limits from the temperature at an event */
+	float highLimitDegC;                     /* armed limits after rounding to the 0.64 degC resolution */
+	float lowLimitDegC;
+	uint8_t limits[2];                       /* armed LIMIT_T_H, LIMIT_T_L register values */
+} TIDS_limit_monitor_t;
+
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
 	/**         Functions definition         */
+	/* all functions take the device context opened with DeviceInit() as first argument */
 
 	/* Device ID */
-	int8_t TIDS_getDeviceID(uint8_t *devID);
+	int8_t TIDS_getDeviceID(we_dev_t *dev, uint8_t *devID);
+
+	/* Register shadow cache (optional) */
+	int8_t TIDS_enableRegisterCache(we_dev_t *dev, we_reg_cache_t *cache);
+
+	/* Complete configuration in one batched read and a single burst write */
+	int8_t TIDS_applyConfig(we_dev_t *dev, const TIDS_config_t *config);
+	int8_t TIDS_readConfig(we_dev_t *dev, TIDS_config_t *config);
+
+	/* Interrupt driven acquisition: sleep on the GPIO connected to INT until a temperature limit is crossed */
+	int8_t TIDS_waitForLimitEvent(we_dev_t *dev, we_int_line_t *intLine, int timeoutMs, TIDS_state_t *overHighLimit, TIDS_state_t *underLowLimit);
+
+	/* Limit event mode: wake on limit crossings, limits re-armed around the temperature with hysteresis */
+	int8_t TIDS_startLimitMonitor(we_dev_t *dev, TIDS_limit_monitor_t *monitor, float lowDegC, float highDegC, float hysteresisDegC);
+	int8_t TIDS_waitForLimitMonitorEvent(we_dev_t *dev, TIDS_limit_monitor_t *monitor, we_int_line_t *intLine, int timeoutMs,
+		TIDS_limit_event_t *event, float *tempDegC);
 
 	/* Temperature limits */
-	int8_t TIDS_setTempHighLimit(uint8_t hLimit);
-	int8_t TIDS_setTempLowLimit(uint8_t lLimit);
+	int8_t TIDS_setTempHighLimit(we_dev_t *dev, uint8_t hLimit);
+	int8_t TIDS_setTempLowLimit(we_dev_t *dev, uint8_t lLimit);
 
-	int8_t TIDS_getTempHighLimit(uint8_t *hLimit);
-	int8_t TIDS_getTempLowLimit(uint8_t *lLimit);
+	int8_t TIDS_getTempHighLimit(we_dev_t *dev, uint8_t *hLimit);
+	int8_t TIDS_getTempLowLimit(we_dev_t *dev, uint8_t *lLimit);
 
 	/* Block data update */
-	int8_t TIDS_setBlockDataUpdate(TIDS_state_t bdu);
-	int8_t TIDS_getBlockDataUpdate(TIDS_state_t *bdu);
+	int8_t TIDS_setBlockDataUpdate(we_dev_t *dev, TIDS_state_t bdu);
+	int8_t TIDS_getBlockDataUpdate(we_dev_t *dev, TIDS_state_t *bdu);
 
 	/* Output data rate */
-	int8_t TIDS_setOutputDataRate(TIDS_output_data_rate_t odr);
-	int8_t TIDS_getOutputDataRate(TIDS_output_data_rate_t* odr);
+	int8_t TIDS_setOutputDataRate(we_dev_t *dev, TIDS_output_data_rate_t odr);
+	int8_t TIDS_getOutputDataRate(we_dev_t *dev, TIDS_output_data_rate_t* odr);
 
 	/* Address auto increment */
-	int8_t TIDS_setAutoIncrement(TIDS_state_t inc);
-	int8_t TIDS_getAutoIncrement(TIDS_state_t *inc);
+	int8_t TIDS_setAutoIncrement(we_dev_t *dev, TIDS_state_t inc);
+	int8_t TIDS_getAutoIncrement(we_dev_t *dev, TIDS_state_t *inc);
 
 	/* Free run mode */
-	int8_t TIDS_setContinuousMode(TIDS_state_t mode);
-	int8_t TIDS_getContinuousMode(TIDS_state_t *mode);
+	int8_t TIDS_setContinuousMode(we_dev_t *dev, TIDS_state_t mode);
+	int8_t TIDS_getContinuousMode(we_dev_t *dev, TIDS_state_t *mode);
 
 	/* One shot mode */
-	int8_t TIDS_setSingleConvMode(TIDS_state_t mode);
-	int8_t TIDS_getSingleConvMode(TIDS_state_t *mode);
+	int8_t TIDS_setSingleConvMode(we_dev_t *dev, TIDS_state_t mode);
+	int8_t TIDS_getSingleConvMode(we_dev_t *dev, TIDS_state_t *mode);
+
+	/* Single conversion scheduled by the conversion time instead of polling the busy bit */
+	int8_t TIDS_triggerOneShot(we_dev_t *dev);
+	int8_t TIDS_readOneShotResult(we_dev_t *dev, int16_t *rawTemp);
+	int8_t TIDS_getOneShotTemperature(we_dev_t *dev, int16_t *rawTemp);
+	int8_t TIDS_getOneShotTemperatures(we_dev_t *const *devs, int count, int16_t *rawTemp, int8_t *results);
 
 	/* Status */
-	int8_t TIDS_getOverHighLimStatus(TIDS_state_t *state);
-	int8_t TIDS_getUnderLowLimStatus(TIDS_state_t *state);
-	int8_t TIDS_getBusyStatus(TIDS_state_t *state);
+	int8_t TIDS_getOverHighLimStatus(we_dev_t *dev, TIDS_state_t *state);
+	int8_t TIDS_getUnderLowLimStatus(we_dev_t *dev, TIDS_state_t *state);
+	int8_t TIDS_getBusyStatus(we_dev_t *dev, TIDS_state_t *state);
 
 	/* Software reset */
-	int8_t TIDS_setSwReset(TIDS_state_t mode);
-	int8_t TIDS_getSwReset(TIDS_state_t *mode);
+	int8_t TIDS_setSwReset(we_dev_t *dev, TIDS_state_t mode);
+	int8_t TIDS_getSwReset(we_dev_t *dev, TIDS_state_t *mode);
 
 	/* standard Data Out */
-	int8_t TIDS_getRAWTemperature(int16_t *rawTemp);
-	int8_t TIDS_getTemperature(float *tempdegC);  // Temperature Value in °C
+	int8_t TIDS_getRAWTemperature(we_dev_t *dev, int16_t *rawTemp);
+	int8_t TIDS_getTemperature(we_dev_t *dev, float *tempdegC);  // Temperature Value in °C
+
+	/* Integer output */
+	int8_t TIDS_getTemperatureCentiDegC(we_dev_t *dev, int32_t *tempCentiDegC);  // Temperature Value in 0.01 °C
+
+	/* Conversion of sample buffers */
+	void TIDS_convertTemperatureBuffer(const int16_t *rawTemp, float *tempdegC, int count);
 
 #ifdef __cplusplus
 }
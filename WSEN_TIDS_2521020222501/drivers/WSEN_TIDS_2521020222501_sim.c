@@ -0,0 +1,172 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "WSEN_TIDS_2521020222501_sim.h"
+#include "WSEN_TIDS_2521020222501.h"
+#include <string.h>
+
+#define TIDS_SIM_ONE_SHOT_US         10000 /* duration of a one-shot conversion */
+
+/* output data period in us for AVG[1:0] */
+static const uint32_t TIDS_simPeriodUs[4] = { 40000, 20000, 10000, 5000 };
+
+
+/**
+* @brief  Store one sample in the output registers and update the limit flags
+* @param  -sim : simulated device
+* @retval None
+*/
+static void TIDS_simSample(we_sim_device_t *sim)
+{
+	int16_t temperature;
+	int32_t limit;
+
+	sim->sampleCount++;
+	temperature = (int16_t)(2500 + SimWave(sim->sampleCount, 500, 400)); /* 20 to 30 degC */
+
+	sim->regs[TIDS_DATA_T_L_REG] = (uint8_t)(temperature & 0xFF);
+	sim->regs[TIDS_DATA_T_H_REG] = (uint8_t)((uint16_t)temperature >> 8);
+
+	/* limit registers: (value - 63) * 0.64 degC, 0 disables the limit */
+	if (sim->regs[TIDS_LIMIT_T_H_REG] != 0)
+	{
+		limit = ((int32_t)sim->regs[TIDS_LIMIT_T_H_REG] - 63) * 64;
+		if (temperature > limit)
+		{
+			sim->regs[TIDS_STATUS_REG] |= 0x02;
+		}
+	}
+	if (sim->regs[TIDS_LIMIT_T_L_REG] != 0)
+	{
+		limit = ((int32_t)sim->regs[TIDS_LIMIT_T_L_REG] - 63) * 64;
+		if (temperature < limit)
+		{
+			sim->regs[TIDS_STATUS_REG] |= 0x04;
+		}
+	}
+}
+
+/**
+* @brief  Load the power-on register values
+* @param  -sim : simulated device
+* @retval None
+*/
+static void TIDS_simReset(we_sim_device_t *sim)
+{
+	memset(sim->regs, 0, sizeof(sim->regs));
+	sim->regs[TIDS_DEVICE_ID_REG] = TIDS_DEVICE_ID_VALUE;
+	sim->periodUs = 0;
+	sim->conversionDoneUs = 0;
+}
+
+/**
+* @brief  Produce the samples due up to the current time
+* @param  -sim : simulated device
+* @retval None
+*/
+static void TIDS_simUpdate(we_sim_device_t *sim)
+{
+	uint8_t ctrl = sim->regs[TIDS_CTRL_REG];
+	uint32_t due;
+
+	for (due = SimSamplesDue(sim, (ctrl & 0x04) ? TIDS_simPeriodUs[(ctrl >> 4) & 0x03] : 0); due > 0; due--)
+	{
+		TIDS_simSample(sim);
+	}
+
+	if (sim->conversionDoneUs != 0 && sim->conversionDoneUs <= sim->nowUs)
+	{
+		sim->conversionDoneUs = 0;
+		sim->regs[TIDS_CTRL_REG] &= (uint8_t)~0x01;
+		sim->regs[TIDS_STATUS_REG] &= (uint8_t)~0x01;
+		TIDS_simSample(sim);
+	}
+}
+
+/**
+* @brief  Read one register, the limit flags are cleared on read
+* @param  -sim : simulated device
+*         -RegAdr : register address
+* @retval register value
+*/
+static uint8_t TIDS_simRead(we_sim_device_t *sim, uint8_t RegAdr)
+{
+	uint8_t value = sim->regs[RegAdr];
+
+	if (RegAdr == TIDS_STATUS_REG)
+	{
+		sim->regs[TIDS_STATUS_REG] &= 0x01;
+	}
+	return value;
+}
+
+/**
+* @brief  Write one register including the one-shot trigger and the software reset
+* @param  -sim : simulated device
+*         -RegAdr : register address
+*         -value : value to write
+* @retval None
+*/
+static void TIDS_simWrite(we_sim_device_t *sim, uint8_t RegAdr, uint8_t value)
+{
+	switch (RegAdr)
+	{
+	case TIDS_DEVICE_ID_REG:
+	case TIDS_STATUS_REG:
+	case TIDS_DATA_T_L_REG:
+	case TIDS_DATA_T_H_REG:
+		return; /* read only */
+
+	case TIDS_SOFT_RESET_REG:
+		if (value & 0x02)
+		{
+			TIDS_simReset(sim);
+			return;
+		}
+		break;
+
+	case TIDS_CTRL_REG:
+		if ((value & 0x01) && !(value & 0x04))
+		{
+			sim->conversionDoneUs = sim->nowUs + TIDS_SIM_ONE_SHOT_US;
+			sim->regs[TIDS_STATUS_REG] |= 0x01;
+		}
+		break;
+
+	default:
+		break;
+	}
+	sim->regs[RegAdr] = value;
+}
+
+const we_sim_model_t TIDS_simModel = {
+	TIDS_simReset,
+	TIDS_simUpdate,
+	TIDS_simRead,
+	TIDS_simWrite,
+	NULL
+};
+
+/**         EOF         */
@@ -40,6 +40,9 @@
 bool AbortMainLoop = false;
 pthread_t thread_main;
 
+static we_bus_t bus;  /* bus the sensor is attached to */
+static we_dev_t tids; /* sensor device context */
+
 
 static void Application(void);
 void continuousMode(void);
@@ -143,7 +146,11 @@ static void Application()
 	uint8_t deviceIdValue = 0, retVal = WE_FAIL;
 
 	/* initialize the platform I2C drivers */
-	status = I2CInit(addr_wsen_tids);
+	status = I2CBusInit(&bus, &WE_wiringPiBusOps, 1); /* /dev/i2c-1 on the Raspberry Pi header */
+	if (status == WE_SUCCESS)
+	{
+		status = DeviceInit(&tids, &bus, addr_wsen_tids);
+	}
 
 	if (status != WE_SUCCESS)
 	{
@@ -152,7 +159,7 @@ static void Application()
 	}
 
 	/* first communication test */
-	retVal = TIDS_getDeviceID(&deviceIdValue);
+	retVal = TIDS_getDeviceID(&tids, &deviceIdValue);
 
 	if ((retVal == WE_SUCCESS)&&(deviceIdValue == TIDS_DEVICE_ID_VALUE))
 	{
@@ -166,11 +173,11 @@ static void Application()
 	}
 
 	/*Perform software reset */
-	TIDS_setSwReset(TIDS_enable);
-	TIDS_setSwReset(TIDS_disable);
+	TIDS_setSwReset(&tids, TIDS_enable);
+	TIDS_setSwReset(&tids, TIDS_disable);
 
 	/*Enable auto address increment */
-	TIDS_setAutoIncrement(TIDS_enable);
+	TIDS_setAutoIncrement(&tids, TIDS_enable);
 
 	/*Select one of the two mode by uncommenting/commenting*/
 	//continuousMode();
@@ -185,8 +192,7 @@ static void Application()
 
 void singleConversionMode()
 {
-	TIDS_state_t status = TIDS_disable;
-	float tempDegC = 0;
+	int16_t rawTemp = 0;
 
 	printf("\nStarting single conversion mode... \r\n");
 	printf("Press ENTER to trigger a new conversion\n");
@@ -194,18 +200,11 @@ void singleConversionMode()
 	while (1)
 	{
 		getchar();
-		/*Start a conversion*/
-		TIDS_setSingleConvMode(TIDS_enable);
-
-		/*Wait till the busy bit is set to 0*/
-		do
+		/*Start a conversion and read the result after the conversion time, no busy polling*/
+		if (TIDS_getOneShotTemperature(&tids, &rawTemp) == WE_SUCCESS)
 		{
-			TIDS_getBusyStatus(&status);
-		}while(status != TIDS_enable);
-
-
-		TIDS_getTemperature(&tempDegC);
-		printf("Temperature [C]= %f\r\n", tempDegC);
+			printf("Temperature [C]= %f\r\n", (float)rawTemp / 100);
+		}
 
 	}
 }
@@ -221,18 +220,18 @@ void continuousMode()
 	float tempDegC = 0;
 
 	/*Set ODR to 25Hz*/
-	TIDS_setOutputDataRate(outputDataRate25HZ);
+	TIDS_setOutputDataRate(&tids, outputDataRate25HZ);
 
 	/*Enable block data update*/
-	TIDS_setBlockDataUpdate(TIDS_enable);
+	TIDS_setBlockDataUpdate(&tids, TIDS_enable);
 
 	/*Enable continuous mode*/
-	TIDS_setContinuousMode(TIDS_enable);
+	TIDS_setContinuousMode(&tids, TIDS_enable);
 
 	printf("\nStarting continuous mode...\r\n");
 	while (1)
 	{
-		TIDS_getTemperature(&tempDegC);
+		TIDS_getTemperature(&tids, &tempDegC);
 		printf("Temperature [C]=%f\r\n", tempDegC);
 		delay(DELAY_1_HZ_IN_MS);
 	}
@@ -24,181 +24,635 @@
  **/
 
 #include "platform.h"
-#include <wiringPiI2C.h>
-#include <wiringPiSPI.h>
+#include "platform_trace.h"
 #include <stdio.h>
 #include <string.h>
-#include <pthread.h>
-#include <unistd.h>
+#include <time.h>
 
 
-#define DUMMY 0x00
+#define REG_CACHE_BIT(bits, RegAdr)      ((bits)[(RegAdr) >> 3] & (1 << ((RegAdr) & 0x07)))
+#define REG_CACHE_SYNC_BLOCKS            16  /* registers per batch when reloading the register cache */
 
-#ifdef USE_SPI
+#ifdef WE_TRACE
+/* the caller attribution macros of platform.h are for the callers, this file defines the functions */
+#undef ReadReg
+#undef ReadRegUncached
+#undef ReadRegBatch
+#undef WriteReg
+#undef ReadRaw
+#undef WriteRegDiff
+#endif
 
-static int spi_channel = 1;
-static int spi_handle = 0; // global handle to the  spi interface
+static int8_t ReadRegLocked(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+static int8_t ReadRegTransfer(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+static int8_t ReadRegBatchLocked(we_dev_t *dev, we_reg_read_t *reads, int count);
+static int8_t WriteRegLocked(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
 
-#else /* I2C is used */
 
-static int i2c_handle = 0; // global handle to the  i2c interface
+/**
+* @brief  Serve a register read from the register cache
+* @param  -cache : register cache of the device
+*         -RegAdr : the register address to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval true if all registers are shadowed and valid, false if the bus has to be accessed
+*/
+static bool RegCacheLookup(we_reg_cache_t *cache, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  int i;
+  bool cacheable = false;
+
+  if (RegAdr + NumByteToRead > WE_REG_CACHE_SIZE)
+  {
+    return false;
+  }
 
-#endif // USE_SPI
+  for (i = RegAdr; i < RegAdr + NumByteToRead; i++)
+  {
+    if (!REG_CACHE_BIT(cache->cacheable, i) || !REG_CACHE_BIT(cache->valid, i))
+    {
+      if (cacheable || REG_CACHE_BIT(cache->cacheable, i))
+      {
+        cache->misses++;
+      }
+      return false;
+    }
+    cacheable = true;
+  }
+
+  memcpy(Data, &cache->value[RegAdr], NumByteToRead);
+  cache->hits++;
+  return true;
+}
 
 /**
-* @brief  Initialize the I2C Interface
-* @param  I2C address
+* @brief  Store the values of shadowed registers after a successful transfer
+* @param  -cache : register cache of the device
+*         -RegAdr : start register address of the transfer
+*         -NumByte : number of bytes transferred
+*         -pointer Data : transferred data, NULL to invalidate the registers instead
+* @retval None
+*/
+static void RegCacheStore(we_reg_cache_t *cache, uint8_t RegAdr, int NumByte, const uint8_t *Data)
+{
+  int i;
+
+  for (i = 0; (i < NumByte) && (RegAdr + i < WE_REG_CACHE_SIZE); i++)
+  {
+    int adr = RegAdr + i;
+
+    if (!REG_CACHE_BIT(cache->cacheable, adr))
+    {
+      continue;
+    }
+    if (Data == NULL)
+    {
+      cache->valid[adr >> 3] &= (uint8_t)~(1 << (adr & 0x07));
+    }
+    else
+    {
+      cache->value[adr] = Data[i];
+      cache->valid[adr >> 3] |= (uint8_t)(1 << (adr & 0x07));
+    }
+  }
+}
+
+
+/**
+* @brief  Initialize the lock of a bus context
+* @param  -bus : bus context
 * @retval Error Code
 */
-int8_t I2CInit(int address)
+int8_t BusLockInit(we_bus_t *bus)
 {
-#ifdef USE_SPI
-	return WE_FAIL;
-	
-#else /* I2C is used */
-  if ((i2c_handle = wiringPiI2CSetup(address)) < 0)
+  pthread_mutexattr_t attr;
+  int8_t ret = WE_SUCCESS;
+
+  memset(&bus->lock, 0, sizeof(we_bus_lock_t));
+
+  if (pthread_mutexattr_init(&attr) != 0)
   {
-    fprintf(stdout, "wiringPiI2CSetup Error\n");
     return WE_FAIL;
   }
+  if ((pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE) != 0) ||
+      (pthread_mutex_init(&bus->lock.mutex, &attr) != 0))
+  {
+    ret = WE_FAIL;
+  }
+  pthread_mutexattr_destroy(&attr);
 
-  return WE_SUCCESS;
-#endif
+  return ret;
 }
 
+/**
+* @brief  Acquire the bus for the calling thread
+*         Uncontended, this is a single trylock without a system call; only a busy bus makes the thread sleep.
+* @param  -bus : bus to lock
+* @retval None
+*/
+void BusLock(we_bus_t *bus)
+{
+  if (pthread_mutex_trylock(&bus->lock.mutex) != 0)
+  {
+    pthread_mutex_lock(&bus->lock.mutex);
+    bus->lock.contended++;
+  }
+  bus->lock.acquisitions++;
+}
 
-int8_t SpiInit(int channel)
+/**
+* @brief  Release the bus
+* @param  -bus : bus locked by the calling thread
+* @retval None
+*/
+void BusUnlock(we_bus_t *bus)
 {
-#ifdef USE_SPI
-  int speed = 4000000; /* 4MHz */
-  int spi_mode = 0;
-  spi_channel = channel;
+  pthread_mutex_unlock(&bus->lock.mutex);
+}
 
-  if ((spi_handle = wiringPiSPISetupMode(spi_channel, speed, spi_mode)) < 0)
+/**
+* @brief  Initialize a bus context for an I2C adapter
+* @param  -bus : bus context to initialize
+*         -ops : backend serving the bus
+*         -adapter : number N of the i2c adapter /dev/i2c-N
+* @retval Error Code
+*/
+int8_t I2CBusInit(we_bus_t *bus, const we_bus_ops_t *ops, int adapter)
+{
+  if ((bus == NULL) || (ops == NULL) || (adapter < 0))
   {
-    fprintf(stdout, "wiringPiSPISetup Error\n");
     return WE_FAIL;
   }
-  return WE_SUCCESS;
 
-#else /* I2C is used */
-  return WE_FAIL;
-#endif
+  memset(bus, 0, sizeof(we_bus_t));
+  bus->type = WE_i2c;
+  bus->ops = ops;
+  bus->adapter = adapter;
+
+  return BusLockInit(bus);
+}
+
+/**
+* @brief  Initialize a bus context for a SPI controller
+* @param  -bus : bus context to initialize
+*         -ops : backend serving the bus
+*         -adapter : number B of the SPI controller /dev/spidevB.x
+*         -speed : SPI clock in Hz
+*         -spiMode : SPI mode 0..3
+* @retval Error Code
+*/
+int8_t SpiBusInit(we_bus_t *bus, const we_bus_ops_t *ops, int adapter, int speed, int spiMode)
+{
+  if ((bus == NULL) || (ops == NULL) || (adapter < 0) || (speed <= 0) || (spiMode < 0) || (spiMode > 3))
+  {
+    return WE_FAIL;
+  }
+
+  memset(bus, 0, sizeof(we_bus_t));
+  bus->type = WE_spi;
+  bus->ops = ops;
+  bus->adapter = adapter;
+  bus->speed = speed;
+  bus->spiMode = spiMode;
+
+  return BusLockInit(bus);
+}
+
+/**
+* @brief  Open a device on a bus
+* @param  -dev : device context to initialize
+*         -bus : initialized bus context the device is attached to
+*         -address : I2C slave address, or SPI channel (chip select)
+* @retval Error Code
+*/
+int8_t DeviceInit(we_dev_t *dev, we_bus_t *bus, int address)
+{
+  if ((dev == NULL) || (bus == NULL) || (bus->ops == NULL))
+  {
+    return WE_FAIL;
+  }
+
+  memset(dev, 0, sizeof(we_dev_t));
+  dev->bus = bus;
+  dev->address = address;
+  dev->handle = -1;
+
+  return bus->ops->open(dev);
 }
 
 
 
 /**
 * @brief   Read data starting from the addressed register
-* @param  -RegAdr : the register address to read from
+* @param  -dev : device to read from
+*         -RegAdr : the register address to read from
 *         -NumByteToRead : number of bytes to read
 *         -pointer Data : the address store the data
 * @retval Error Code
 */
-int8_t ReadReg(uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+int8_t ReadReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
 {
-#ifdef USE_SPI
-  RegAdr |= SPI_READ_MASK;
-  uint8_t fulldata[2];
-  int i=0 ;
-  while(i<NumByteToRead)
+  int8_t ret;
+
+  if ((NumByteToRead <= 0) || (NumByteToRead > WE_MAX_BURST_LEN))
   {
-	fulldata[0] = RegAdr+i;
-	fulldata[1] = DUMMY;
+    return WE_FAIL;
+  }
 
-	if (wiringPiSPIDataRW(spi_channel, fulldata, 2) == -1)
-	{
+  BusLock(dev->bus);
+  ret = ReadRegLocked(dev, RegAdr, NumByteToRead, Data);
+  BusUnlock(dev->bus);
+
+  return ret;
+}
+
+/**
+* @brief  Read data starting from the addressed register, bypassing the register cache
+* @param  -dev : device to read from
+*         -RegAdr : the register address to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+int8_t ReadRegUncached(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  int8_t ret;
+
+  if ((NumByteToRead <= 0) || (NumByteToRead > WE_MAX_BURST_LEN))
+  {
+    return WE_FAIL;
+  }
+
+  BusLock(dev->bus);
+  ret = ReadRegTransfer(dev, RegAdr, NumByteToRead, Data);
+  BusUnlock(dev->bus);
+
+  return ret;
+}
+
+/**
+* @brief  Read several register blocks of a device in as few bus transactions as possible
+* @param  -dev : device to read from
+*         -reads : list of register blocks (start address, length, destination)
+*         -count : number of entries in reads
+* @retval Error Code
+*/
+int8_t ReadRegBatch(we_dev_t *dev, we_reg_read_t *reads, int count)
+{
+  int8_t ret;
+  int i;
+
+  for (i = 0; i < count; i++)
+  {
+    if ((reads[i].NumByteToRead <= 0) || (reads[i].NumByteToRead > WE_MAX_BURST_LEN))
+    {
       return WE_FAIL;
-	}
+    }
+  }
+
+  BusLock(dev->bus);
+  ret = ReadRegBatchLocked(dev, reads, count);
+  BusUnlock(dev->bus);
+
+  return ret;
+}
+
+/**
+* @brief  Write data starting from the addressed register
+* @param  -dev : device to write to
+*         -RegAdr : Address to write in
+*         -NumByteToWrite : number of bytes to write
+*         -pointer Data : Address of the data to be written
+* @retval Error Code
+*/
+int8_t WriteReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+  int8_t ret;
 
-	/* read out the received response of the sensor */
-	Data[i] = fulldata[1];
-	i++ ;
+  if ((NumByteToWrite <= 0) || (NumByteToWrite > WE_MAX_BURST_LEN))
+  {
+    return WE_FAIL;
   }
+
+  BusLock(dev->bus);
+  ret = WriteRegLocked(dev, RegAdr, NumByteToWrite, Data);
+  BusUnlock(dev->bus);
+
+  return ret;
+}
+
+/**
+* @brief  Read data from a device without register addressing
+* @param  -dev : device to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+int8_t ReadRaw(we_dev_t *dev, int NumByteToRead, uint8_t *Data)
+{
+  int8_t ret;
+
+  if ((NumByteToRead <= 0) || (NumByteToRead > WE_MAX_BURST_LEN) || (dev->bus->ops->read == NULL))
+  {
+    return WE_FAIL;
+  }
+
+  BusLock(dev->bus);
+  WE_TRACE_START(t0);
+  ret = dev->bus->ops->read(dev, NumByteToRead, Data);
+  WE_TRACE_RECORD(dev, WE_traceRead, 0, NumByteToRead, t0, ret == WE_SUCCESS);
+  BusUnlock(dev->bus);
+
+  return ret;
+}
+
+/*
+ * The *Locked functions do the transfers of ReadReg()/ReadRegBatch()/WriteReg() with validated arguments,
+ * the bus lock is held by the caller. ReadRegTransfer() is the bus access of ReadRegLocked() without the cache.
+ */
+
+static int8_t ReadRegLocked(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  if ((dev->cache != NULL) && RegCacheLookup(dev->cache, RegAdr, NumByteToRead, Data))
+  {
+    return WE_SUCCESS;
+  }
+
+  if (WE_FAIL == ReadRegTransfer(dev, RegAdr, NumByteToRead, Data))
+  {
+    return WE_FAIL;
+  }
+
+  if (dev->cache != NULL)
+  {
+    RegCacheStore(dev->cache, RegAdr, NumByteToRead, Data);
+  }
+
   return WE_SUCCESS;
+}
+
+static int8_t ReadRegTransfer(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  int8_t ret;
+
+  WE_TRACE_START(t0);
+  ret = dev->bus->ops->readReg(dev, (NumByteToRead > 1) ? (uint8_t)(RegAdr | dev->multiByteMask) : RegAdr, NumByteToRead, Data);
+  WE_TRACE_RECORD(dev, WE_traceRead, RegAdr, NumByteToRead, t0, ret == WE_SUCCESS);
 
-#else /* I2C is used */
+  return ret;
+}
 
-  int ret = 0;
+static int8_t ReadRegBatchLocked(we_dev_t *dev, we_reg_read_t *reads, int count)
+{
+  int8_t ret;
+  int i;
 
-  if (NumByteToRead > 1)
+  if (dev->bus->ops->readRegBatch != NULL)
   {
+    if (dev->cache != NULL)
+    {
+      /* skip the bus if every block is served by the register cache */
+      for (i = 0; i < count; i++)
+      {
+        if (!RegCacheLookup(dev->cache, reads[i].RegAdr, reads[i].NumByteToRead, reads[i].Data))
+        {
+          break;
+        }
+      }
+      if (i == count)
+      {
+        return WE_SUCCESS;
+      }
+    }
 
-    /*Write the start address to initiate the read*/
-    ret = wiringPiI2CWrite(i2c_handle, RegAdr);
-    if (ret == -1)
+    WE_TRACE_START(t0);
+    ret = dev->bus->ops->readRegBatch(dev, reads, count);
+    WE_TRACE_RECORD_BATCH(dev, reads, count, t0, ret == WE_SUCCESS);
+
+    if (WE_FAIL == ret)
     {
       return WE_FAIL;
     }
-    else
+
+    if (dev->cache != NULL)
     {
-      /* Read the necessary number of bytes to an array */
-      read(i2c_handle, Data, NumByteToRead);
+      for (i = 0; i < count; i++)
+      {
+        RegCacheStore(dev->cache, reads[i].RegAdr, reads[i].NumByteToRead, reads[i].Data);
+      }
     }
+    return WE_SUCCESS;
   }
-  else
+
+  /* backend has no batch transfer, execute the blocks one after the other */
+  for (i = 0; i < count; i++)
   {
-    ret = wiringPiI2CReadReg8(i2c_handle, RegAdr);
-    if (ret == -1)
+    if (WE_FAIL == ReadReg(dev, reads[i].RegAdr, reads[i].NumByteToRead, reads[i].Data))
     {
       return WE_FAIL;
     }
-    else
+  }
+
+  return WE_SUCCESS;
+}
+
+static int8_t WriteRegLocked(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+  int8_t ret;
+
+  WE_TRACE_START(t0);
+  ret = dev->bus->ops->writeReg(dev, (NumByteToWrite > 1) ? (uint8_t)(RegAdr | dev->multiByteMask) : RegAdr, NumByteToWrite, Data);
+  WE_TRACE_RECORD(dev, WE_traceWrite, RegAdr, NumByteToWrite, t0, ret == WE_SUCCESS);
+
+  if (WE_FAIL == ret)
+  {
+    /* the device state is unknown after a failed write */
+    if (dev->cache != NULL)
     {
-      Data[0] = (uint8_t)ret;
+      RegCacheStore(dev->cache, RegAdr, NumByteToWrite, NULL);
     }
+    return WE_FAIL;
+  }
+
+  /* write-through */
+  if (dev->cache != NULL)
+  {
+    RegCacheStore(dev->cache, RegAdr, NumByteToWrite, Data);
   }
 
   return WE_SUCCESS;
+}
 
-#endif
+/**
+* @brief  Write the changed registers of a block of register images
+* @param  -dev : device to write to
+*         -RegAdr : address of the first register of the block
+*         -count : number of registers in the block
+*         -current : register values currently in the device
+*         -target : register values to be written
+*         -burst : true: one multi-byte write covering all changes; false: one single byte write per change
+* @retval Error Code
+*/
+int8_t WriteRegDiff(we_dev_t *dev, uint8_t RegAdr, int count, const uint8_t *current, uint8_t *target, bool burst)
+{
+  int8_t ret = WE_SUCCESS;
+  int first = 0;
+  int last = count - 1;
+  int i;
+
+  while ((first < count) && (current[first] == target[first]))
+  {
+    first++;
+  }
+  if (first == count)
+  {
+    return WE_SUCCESS;
+  }
+  while (current[last] == target[last])
+  {
+    last--;
+  }
+
+  BusLock(dev->bus);
+
+  if (burst)
+  {
+    ret = WriteReg(dev, (uint8_t)(RegAdr + first), last - first + 1, &target[first]);
+  }
+  else
+  {
+    for (i = first; i <= last; i++)
+    {
+      if ((current[i] != target[i]) && (WE_FAIL == WriteReg(dev, (uint8_t)(RegAdr + i), 1, &target[i])))
+      {
+        ret = WE_FAIL;
+        break;
+      }
+    }
+  }
+
+  BusUnlock(dev->bus);
+
+  return ret;
 }
 
 /**
-* @brief  Write data starting from the addressed register
-* @param  -RegAdr : Address to write in
-*         -NumByteToWrite : number of bytes to write
-*         -pointer Data : Address of the data to be written
+* @brief  Attach a register shadow cache to a device
+* @param  -dev : device the cache belongs to
+*         -cache : cache storage, owned by the caller for the lifetime of the device
+*         -regs : addresses of the cacheable registers
+*         -count : number of entries in regs
 * @retval Error Code
 */
-int8_t WriteReg(uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+int8_t RegCacheInit(we_dev_t *dev, we_reg_cache_t *cache, const uint8_t *regs, int count)
 {
-#ifdef USE_SPI
-  uint8_t fulldata[2];
-  int i=0 ;
-  while(i<NumByteToWrite)
+  int i;
+
+  if ((dev == NULL) || (cache == NULL) || ((regs == NULL) && (count > 0)))
   {
-	fulldata[0] = RegAdr+i;
-	fulldata[1] = Data [i];
+    return WE_FAIL;
+  }
 
-	if (wiringPiSPIDataRW(spi_channel, fulldata, 2) == -1)
-	{
-      return WE_FAIL;
-	}
-	i++ ;
+  memset(cache, 0, sizeof(we_reg_cache_t));
+  for (i = 0; i < count; i++)
+  {
+    cache->cacheable[regs[i] >> 3] |= (uint8_t)(1 << (regs[i] & 0x07));
   }
+  dev->cache = cache;
+
   return WE_SUCCESS;
+}
+
+/**
+* @brief  Mark all shadowed registers of a device invalid
+* @param  -dev : device whose cache is invalidated
+* @retval None
+*/
+void RegCacheInvalidate(we_dev_t *dev)
+{
+  if (dev->cache != NULL)
+  {
+    BusLock(dev->bus);
+    memset(dev->cache->valid, 0, sizeof(dev->cache->valid));
+    BusUnlock(dev->bus);
+  }
+}
 
-#else /* I2C is used */
+/**
+* @brief  Reload all shadowed registers of a device
+*         Registers are read one byte per block, so the result does not depend on the auto increment setting.
+* @param  -dev : device whose cache is reloaded
+* @retval Error Code
+*/
+int8_t RegCacheSync(we_dev_t *dev)
+{
+  we_reg_read_t reads[REG_CACHE_SYNC_BLOCKS];
+  we_reg_cache_t *cache = dev->cache;
+  int8_t ret = WE_SUCCESS;
+  int count = 0;
+  int adr;
 
-  if (0x00 != wiringPiI2CWriteReg8(i2c_handle, RegAdr, Data[0]))
+  if (cache == NULL)
   {
     return WE_FAIL;
   }
-  else
+
+  BusLock(dev->bus);
+
+  RegCacheInvalidate(dev);
+
+  for (adr = 0; adr < WE_REG_CACHE_SIZE; adr++)
   {
-    int i;
-    for (i = 1; i < NumByteToWrite; i++)
+    if (!REG_CACHE_BIT(cache->cacheable, adr))
+    {
+      continue;
+    }
+
+    reads[count].RegAdr = (uint8_t)adr;
+    reads[count].NumByteToRead = 1;
+    reads[count].Data = &cache->value[adr];
+    count++;
+
+    if (count == REG_CACHE_SYNC_BLOCKS)
     {
-      if (0x00 != wiringPiI2CWrite(i2c_handle, Data[i]))
+      if (WE_FAIL == ReadRegBatch(dev, reads, count))
       {
-        return WE_FAIL;
+        ret = WE_FAIL;
+        break;
       }
+      count = 0;
     }
   }
 
-  return WE_SUCCESS;
-#endif
+  if ((ret == WE_SUCCESS) && (count > 0) && (WE_FAIL == ReadRegBatch(dev, reads, count)))
+  {
+    ret = WE_FAIL;
+  }
+
+  BusUnlock(dev->bus);
+
+  return ret;
+}
+
+/**
+* @brief  Sleep for specified time on the time base of the bus
+* @param  -bus : bus whose time base is used
+*         -sleepForMs : time period in ms
+* @retval None
+*/
+void BusDelay(we_bus_t *bus, unsigned int sleepForMs)
+{
+  if (bus->ops->delay != NULL)
+  {
+    /* backend time base (simulated clock) is bus state; wall clock delays below sleep without holding the bus */
+    BusLock(bus);
+    bus->ops->delay(bus, sleepForMs);
+    BusUnlock(bus);
+  }
+  else
+  {
+    delay(sleepForMs);
+  }
 }
 
 /**
@@ -30,6 +30,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <pthread.h>
 
 /* colors */
 #define COLOR_RESET   		"\033[0m"
@@ -53,27 +54,257 @@
 #define WE_SUCCESS   0
 #define WE_FAIL     -1
 #define SPI_READ_MASK (1 << 7)
-//#define USE_SPI
+#define WE_MAX_BURST_LEN  1024  /* maximum number of data bytes of a single ReadReg()/WriteReg() transfer */
+#define WE_REG_CACHE_SIZE 256   /* register address space covered by the register shadow cache */
+#define WE_DIV_ROUND(n, d) (((n) < 0) ? (((n) - (d) / 2) / (d)) : (((n) + (d) / 2) / (d)))  /* integer n / d, d > 0, rounded half away from zero */
+//#define USE_SPI /* define to run the examples on the SPI bus instead of I2C */
+//#define WE_TRACE /* define to record bus transfer statistics and latencies, see platform_trace.h */
+
+
+/**         Type definitions         */
+
+typedef enum {
+	WE_i2c = 0,
+	WE_spi = 1
+} we_bus_type_t;
+
+typedef struct we_bus_ops_s we_bus_ops_t;
+
+/**
+* Bus lock, see BusLock()
+* Recursive, so a thread holding a transaction scope can still call the driver functions.
+*/
+typedef struct {
+	pthread_mutex_t mutex;
+	uint32_t acquisitions;    /* BusLock() calls, nested ones included */
+	uint32_t contended;       /* acquisitions that had to wait for another thread */
+} we_bus_lock_t;
+
+/**
+* Bus context
+* One instance per physical adapter (i2c-dev adapter or SPI controller).
+* Any number of devices may be attached to the same bus.
+*/
+typedef struct {
+	we_bus_type_t type;       /* I2C or SPI */
+	const we_bus_ops_t *ops;  /* backend implementing the bus access */
+	void *context;            /* backend specific bus state, e.g. the simulated clock */
+	int adapter;              /* I2C: number N of /dev/i2c-N; SPI: number B of /dev/spidevB.C */
+	int speed;                /* SPI: clock in Hz; I2C: not used */
+	int spiMode;              /* SPI: clock polarity/phase mode 0..3; I2C: not used */
+	we_bus_lock_t lock;       /* serializes the transfers of all threads on this bus */
+} we_bus_t;
+
+/**
+* Register shadow cache of a device, see RegCacheInit()
+* Holds the last value written to / read from the cacheable registers. Only registers without self-clearing
+* or hardware-updated bits may be marked cacheable (control registers, calibration constants).
+*/
+typedef struct {
+	uint8_t value[WE_REG_CACHE_SIZE];           /* shadow register values */
+	uint8_t cacheable[WE_REG_CACHE_SIZE / 8];   /* bit set: register is shadowed */
+	uint8_t valid[WE_REG_CACHE_SIZE / 8];       /* bit set: shadow value matches the device */
+	uint32_t hits;                              /* register reads served from the shadow */
+	uint32_t misses;                            /* register reads of cacheable registers that went to the bus */
+} we_reg_cache_t;
+
+/**
+* Device context
+* One instance per sensor. Passed as first argument to ReadReg()/WriteReg() and to every driver function.
+* The handle is opened once by DeviceInit(), so switching between devices has no re-init cost.
+*/
+typedef struct {
+	we_bus_t *bus;            /* bus the device is attached to */
+	int address;              /* I2C: 7 bit slave address; SPI: channel (chip select) */
+	int handle;               /* file descriptor of the opened device */
+	void *context;            /* backend specific device state, e.g. the simulated register file */
+	uint8_t multiByteMask;    /* ORed into the register address of multi-byte transfers (e.g. HIDS auto increment bit), 0 by default */
+	we_reg_cache_t *cache;    /* optional register shadow, NULL: every access goes to the bus */
+	void *driverData;         /* optional sensor driver state, e.g. cached calibration coefficients, NULL by default */
+#ifdef WE_TRACE
+	struct we_trace_dev_s *trace; /* transfer statistics, see TraceDeviceInit(), NULL: not recorded per device */
+#endif
+} we_dev_t;
+
+/**
+* One block of a batched register read, see ReadRegBatch()
+*/
+typedef struct {
+	uint8_t RegAdr;           /* start register address */
+	int NumByteToRead;        /* number of bytes to read */
+	uint8_t *Data;            /* destination of the read bytes */
+} we_reg_read_t;
+
+/**
+* Bus backend
+* ReadReg()/WriteReg()/ReadRegBatch()/BusDelay() dispatch to the backend of the device's bus.
+* Register addresses passed to readReg/writeReg already contain the multiByteMask of multi-byte transfers.
+* readRegBatch gets the plain block addresses and ORs the multiByteMask into the blocks longer than one byte itself.
+* No address contains the SPI read bit. The ops are called with the bus locked and must not call ReadReg() & co.
+* readRegBatch and delay are optional (NULL): batches then fall back to one readReg per block,
+* delays to delay(). read is optional (NULL): the backend does not support register-less devices.
+*/
+struct we_bus_ops_s {
+	int8_t (*open)(we_dev_t *dev);
+	int8_t (*readReg)(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+	int8_t (*writeReg)(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
+	int8_t (*readRegBatch)(we_dev_t *dev, we_reg_read_t *reads, int count);
+	void (*delay)(we_bus_t *bus, unsigned int sleepForMs);
+	int8_t (*read)(we_dev_t *dev, int NumByteToRead, uint8_t *Data);   /* plain read without register address */
+};
+
+/**
+* Edge of an interrupt line that signals an event
+*/
+typedef enum {
+	WE_risingEdge = 1,        /* active high interrupt pin */
+	WE_fallingEdge = 2,       /* active low interrupt pin */
+	WE_bothEdges = 3
+} we_int_edge_t;
+
+/**
+* Interrupt line: a GPIO connected to a sensor interrupt pin (INT, INT_0, INT_1, DRDY),
+* requested from the Linux GPIO character device /dev/gpiochipN, see IntLineInit().
+*/
+typedef struct {
+	int fd;                   /* line event file descriptor, -1: not requested */
+	int chip;                 /* number N of /dev/gpiochipN */
+	unsigned int offset;      /* line offset on the chip (BCM GPIO number on the Raspberry Pi) */
+	we_int_edge_t edge;       /* edge(s) reported as events */
+	uint32_t events;          /* number of edges received since IntLineInit() */
+	uint64_t timestampNs;     /* kernel timestamp of the last edge (CLOCK_MONOTONIC on kernels >= 5.7) */
+} we_int_line_t;
+
+/**         Available backends         */
+
+extern const we_bus_ops_t WE_wiringPiBusOps;  /* wiringPi (platform_wiringpi.c) */
+extern const we_bus_ops_t WE_linuxBusOps;     /* raw Linux i2c-dev / spidev (platform_linux.c) */
+extern const we_bus_ops_t WE_simBusOps;       /* in-memory register file simulator (platform_sim.c) */
 
 
 /**         Functions definition         */
 
 
+/* Initializes a bus context for an i2c adapter (/dev/i2c-<adapter>) served by the given backend. Does not access the hardware. */
+int8_t I2CBusInit(we_bus_t *bus, const we_bus_ops_t *ops, int adapter);
 
-/* Initializes i2c periphheral for communicaiton with a sensor. either use I2CInit() or SpiInit(). */
-int8_t I2CInit(int address);
+/* 
+ * Initializes a bus context for a SPI controller (/dev/spidev<adapter>.x) served by the given backend.
+ * Does not access the hardware. The wiringPi backend always uses SPI controller 0.
+ */
+int8_t SpiBusInit(we_bus_t *bus, const we_bus_ops_t *ops, int adapter, int speed, int spiMode);
 
 /* 
- * Initalizes SPI peripheral for communicaiton with a sensor. either use I2CInit() or SpiInit(). 
- * USE_SPI (this file, line 56) must be defined to use the SPI as communication interface. 
+ * Opens a device on a bus. address is the I2C slave address, or the SPI channel (chip select) on a SPI bus.
+ * Call once per sensor; the device handle then stays valid for the lifetime of the process.
  */
-int8_t SpiInit(int channel);
+int8_t DeviceInit(we_dev_t *dev, we_bus_t *bus, int address);
+
+/* 
+ * Initializes the lock of a bus context. Called by the bus init functions, only needed by custom backends
+ * that set up a we_bus_t themselves.
+ */
+int8_t BusLockInit(we_bus_t *bus);
+
+/* 
+ * Transaction scope: holds the bus across several register accesses (e.g. a read-modify-write sequence or
+ * a multi-register configuration), other threads wait in their next access to this bus.
+ * Every ReadReg()/ReadRegBatch()/WriteReg() takes the lock on its own, so single accesses need no scope.
+ * Nestable; each BusLock() needs one BusUnlock() on the same thread. Keep scopes short and do not sleep in them.
+ */
+void BusLock(we_bus_t *bus);
+void BusUnlock(we_bus_t *bus);
 
 /* Read a register's content */
-int8_t ReadReg(uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+int8_t ReadReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+
+/* 
+ * Read a register without the register cache: the data is neither served from nor stored in the shadow.
+ * For bursts whose register address does not advance linearly, e.g. FIFO output registers with address rollover.
+ */
+int8_t ReadRegUncached(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+
+/* 
+ * Read several register blocks of one device. On I2C all blocks are combined into a single 
+ * repeated-start I2C_RDWR transaction (up to 21 blocks per ioctl).
+ */
+int8_t ReadRegBatch(we_dev_t *dev, we_reg_read_t *reads, int count);
 
 /* write a register's content */
-int8_t WriteReg(uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
+int8_t WriteReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
+
+/* 
+ * Read from a device without registers (e.g. PDUS): a single I2C read message, no register address is sent.
+ * Not served by the register cache. Fails if the backend has no read operation.
+ */
+int8_t ReadRaw(we_dev_t *dev, int NumByteToRead, uint8_t *Data);
+
+/* 
+ * Write the registers RegAdr .. RegAdr + count - 1 whose target image differs from the current image.
+ * burst: one write from the first to the last changed register (the device must auto increment);
+ * otherwise one write per changed register. Nothing is written if the images are equal.
+ */
+int8_t WriteRegDiff(we_dev_t *dev, uint8_t RegAdr, int count, const uint8_t *current, uint8_t *target, bool burst);
+
+/* 
+ * Attaches a register shadow cache to a device. regs lists the cacheable register addresses.
+ * Reads of valid shadowed registers are served from memory, writes go to the device and update the shadow (write-through).
+ * All entries start invalid; call RegCacheSync() to preload them. Drivers provide <SENSOR>_enableRegisterCache().
+ */
+int8_t RegCacheInit(we_dev_t *dev, we_reg_cache_t *cache, const uint8_t *regs, int count);
+
+/* Marks all shadowed registers invalid, e.g. after a software reset or reboot of the device. */
+void RegCacheInvalidate(we_dev_t *dev);
+
+/* Reloads all shadowed registers from the device in batched transfers. */
+int8_t RegCacheSync(we_dev_t *dev);
+
+/* 
+ * Requests GPIO line <offset> of /dev/gpiochip<chip> as an edge event source for a sensor interrupt pin.
+ * The sensor side (routing of the signal to the pin, active level) is configured with the driver functions.
+ */
+int8_t IntLineInit(we_int_line_t *intLine, int chip, unsigned int offset, we_int_edge_t edge);
+
+/* 
+ * Sleeps until an edge is reported or timeoutMs expires (-1: no timeout). Does not access the sensor bus.
+ * fired is false on timeout. All queued edges are consumed, timestampNs holds the time of the latest one.
+ */
+int8_t IntLineWait(we_int_line_t *intLine, int timeoutMs, bool *fired);
+
+/* Releases the GPIO line */
+void IntLineClose(we_int_line_t *intLine);
+
+#ifdef WE_TRACE
+/* 
+ * Attribute the transfers to the driver function calling ReadReg()/ReadRegUncached()/ReadRegBatch()/WriteReg()/WriteRegDiff().
+ * The outermost caller wins, so transfers issued by platform helpers count for the driver function using them.
+ */
+extern __thread const char *WE_traceCaller;
+
+#define WE_TRACE_CALL(call) \
+	({ bool we_outer = (WE_traceCaller == NULL); int8_t we_ret; \
+	   if (we_outer) WE_traceCaller = __func__; \
+	   we_ret = (call); \
+	   if (we_outer) WE_traceCaller = NULL; \
+	   we_ret; })
+
+#define ReadReg(dev, RegAdr, NumByteToRead, Data)      WE_TRACE_CALL((ReadReg)(dev, RegAdr, NumByteToRead, Data))
+#define ReadRegUncached(dev, RegAdr, NumByteToRead, Data) WE_TRACE_CALL((ReadRegUncached)(dev, RegAdr, NumByteToRead, Data))
+#define ReadRegBatch(dev, reads, count)                WE_TRACE_CALL((ReadRegBatch)(dev, reads, count))
+#define WriteReg(dev, RegAdr, NumByteToWrite, Data)    WE_TRACE_CALL((WriteReg)(dev, RegAdr, NumByteToWrite, Data))
+#define ReadRaw(dev, NumByteToRead, Data)              WE_TRACE_CALL((ReadRaw)(dev, NumByteToRead, Data))
+#define WriteRegDiff(dev, RegAdr, count, current, target, burst) \
+	WE_TRACE_CALL((WriteRegDiff)(dev, RegAdr, count, current, target, burst))
+#endif
+
+/* delay in 1 ms resolution on the time base of the bus (wall clock, or simulated time). blocking. */
+void BusDelay(we_bus_t *bus, unsigned int sleepForMs);
+
+/* i2c-dev transfers shared by the Linux based backends (platform_linux.c) */
+int8_t LinuxI2CReadReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+int8_t LinuxI2CWriteReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
+int8_t LinuxI2CReadRegBatch(we_dev_t *dev, we_reg_read_t *reads, int count);
+int8_t LinuxI2CRead(we_dev_t *dev, int NumByteToRead, uint8_t *Data);
 
 /* debug output */
 void Debug_out(char *str, bool status);
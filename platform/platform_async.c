@@ -0,0 +1,379 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform_async.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/**
+* @brief  Current CLOCK_MONOTONIC time
+* @retval time in ns
+*/
+uint64_t AsyncNowNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+* @brief  Complete a request: final state and counters under the engine lock, then callback and eventfd
+*         The completion fields are copied first: once the state is final the request belongs to the caller
+*         again and may be resubmitted or freed, even before the callback runs.
+* @param  -engine : engine the request was queued on
+*         -req : request
+*         -state : final state
+* @retval None
+*/
+static void asyncComplete(we_async_engine_t *engine, we_async_req_t *req, we_async_state_t state)
+{
+  we_async_cb_t callback;
+  void *userData;
+  int eventFd;
+  uint64_t one = 1;
+
+  pthread_mutex_lock(&engine->lock);
+  callback = req->callback;
+  userData = req->userData;
+  eventFd = req->eventFd;
+  req->state = state;
+  if (state == WE_asyncDone)
+  {
+    engine->done++;
+  }
+  else if (state == WE_asyncExpired)
+  {
+    engine->expired++;
+  }
+  else if (state == WE_asyncFailed)
+  {
+    engine->failed++;
+  }
+  pthread_cond_broadcast(&engine->completed);
+  pthread_mutex_unlock(&engine->lock);
+
+  if (callback != NULL)
+  {
+    callback(req, state, userData);
+  }
+
+  if (eventFd >= 0)
+  {
+    if (write(eventFd, &one, sizeof(one)) != sizeof(one))
+    {
+      fprintf(stderr, "async: eventfd write failed\n");
+    }
+  }
+}
+
+/**
+* @brief  Execute a request with the synchronous access functions
+* @param  -req : request
+* @retval Error Code
+*/
+static int8_t asyncExecute(we_async_req_t *req)
+{
+  switch (req->op)
+  {
+  case WE_asyncRead:
+    return ReadReg(req->dev, req->RegAdr, req->NumBytes, req->Data);
+  case WE_asyncWrite:
+    return WriteReg(req->dev, req->RegAdr, req->NumBytes, req->Data);
+  case WE_asyncReadBatch:
+    return ReadRegBatch(req->dev, req->reads, req->count);
+  default:
+    return WE_FAIL;
+  }
+}
+
+/**
+* @brief  Worker thread of a bus: executes the queued requests in submission order
+* @param  -arg : engine
+* @retval None
+*/
+static void *asyncWorker(void *arg)
+{
+  we_async_engine_t *engine = (we_async_engine_t *)arg;
+  we_async_req_t *req;
+
+  while (1)
+  {
+    pthread_mutex_lock(&engine->lock);
+    while (engine->running && (engine->head == NULL))
+    {
+      pthread_cond_wait(&engine->queued, &engine->lock);
+    }
+    if (!engine->running)
+    {
+      pthread_mutex_unlock(&engine->lock);
+      break;
+    }
+    req = engine->head;
+    engine->head = req->next;
+    if (engine->head == NULL)
+    {
+      engine->tail = NULL;
+    }
+    pthread_mutex_unlock(&engine->lock);
+
+    if ((req->deadlineNs != 0) && (AsyncNowNs() > req->deadlineNs))
+    {
+      /* too late to be useful, keep the bus free for the requests behind it */
+      asyncComplete(engine, req, WE_asyncExpired);
+    }
+    else
+    {
+      asyncComplete(engine, req, (asyncExecute(req) == WE_SUCCESS) ? WE_asyncDone : WE_asyncFailed);
+    }
+  }
+
+  return NULL;
+}
+
+/**
+* @brief  Start the engine of a bus
+* @param  -engine : engine to initialize
+*         -bus : bus whose devices are accessed by the engine
+* @retval Error Code
+*/
+int8_t AsyncEngineStart(we_async_engine_t *engine, we_bus_t *bus)
+{
+  memset(engine, 0, sizeof(we_async_engine_t));
+  engine->bus = bus;
+  engine->running = true;
+
+  if ((pthread_mutex_init(&engine->lock, NULL) != 0) ||
+      (pthread_cond_init(&engine->queued, NULL) != 0) ||
+      (pthread_cond_init(&engine->completed, NULL) != 0))
+  {
+    return WE_FAIL;
+  }
+
+  if (pthread_create(&engine->worker, NULL, asyncWorker, engine) != 0)
+  {
+    engine->running = false;
+    return WE_FAIL;
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Stop the engine of a bus, requests not yet started are cancelled
+* @param  -engine : running engine
+* @retval None
+*/
+void AsyncEngineStop(we_async_engine_t *engine)
+{
+  we_async_req_t *req;
+
+  pthread_mutex_lock(&engine->lock);
+  if (!engine->running)
+  {
+    pthread_mutex_unlock(&engine->lock);
+    return;
+  }
+  engine->running = false;
+  pthread_cond_signal(&engine->queued);
+  pthread_mutex_unlock(&engine->lock);
+
+  pthread_join(engine->worker, NULL);
+
+  while ((req = engine->head) != NULL)
+  {
+    engine->head = req->next;
+    asyncComplete(engine, req, WE_asyncCancelled);
+  }
+  engine->tail = NULL;
+
+  /* threads woken in AsyncWait() still need the mutex and the condition variable */
+  pthread_mutex_lock(&engine->lock);
+  while (engine->waiters > 0)
+  {
+    pthread_cond_wait(&engine->completed, &engine->lock);
+  }
+  pthread_mutex_unlock(&engine->lock);
+
+  pthread_cond_destroy(&engine->queued);
+  pthread_cond_destroy(&engine->completed);
+  pthread_mutex_destroy(&engine->lock);
+}
+
+/**
+* @brief  Reset the completion fields of a request
+* @param  -req : request
+*         -op : operation
+*         -dev : device accessed
+* @retval None
+*/
+static void asyncPrepare(we_async_req_t *req, we_async_op_t op, we_dev_t *dev)
+{
+  memset(req, 0, sizeof(we_async_req_t));
+  req->op = op;
+  req->dev = dev;
+  req->eventFd = -1;
+  req->state = WE_asyncIdle;
+}
+
+/**
+* @brief  Prepare an asynchronous ReadReg()
+* @retval None
+*/
+void AsyncPrepareRead(we_async_req_t *req, we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  asyncPrepare(req, WE_asyncRead, dev);
+  req->RegAdr = RegAdr;
+  req->NumBytes = NumByteToRead;
+  req->Data = Data;
+}
+
+/**
+* @brief  Prepare an asynchronous WriteReg()
+* @retval None
+*/
+void AsyncPrepareWrite(we_async_req_t *req, we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+  asyncPrepare(req, WE_asyncWrite, dev);
+  req->RegAdr = RegAdr;
+  req->NumBytes = NumByteToWrite;
+  req->Data = Data;
+}
+
+/**
+* @brief  Prepare an asynchronous ReadRegBatch()
+* @retval None
+*/
+void AsyncPrepareReadBatch(we_async_req_t *req, we_dev_t *dev, we_reg_read_t *reads, int count)
+{
+  asyncPrepare(req, WE_asyncReadBatch, dev);
+  req->reads = reads;
+  req->count = count;
+}
+
+/**
+* @brief  Set the deadline of a request relative to now
+* @param  -req : prepared request
+*         -timeoutMs : time the transfer must be started within
+* @retval None
+*/
+void AsyncSetDeadline(we_async_req_t *req, unsigned int timeoutMs)
+{
+  req->deadlineNs = AsyncNowNs() + ((uint64_t)timeoutMs * 1000000ULL);
+}
+
+/**
+* @brief  Queue a request
+* @param  -engine : engine of the bus the request's device is attached to
+*         -req : prepared request, not pending
+* @retval Error Code
+*/
+int8_t AsyncSubmit(we_async_engine_t *engine, we_async_req_t *req)
+{
+  if ((req->dev == NULL) || (req->dev->bus != engine->bus))
+  {
+    return WE_FAIL;
+  }
+
+  pthread_mutex_lock(&engine->lock);
+  if (req->state == WE_asyncPending)
+  {
+    pthread_mutex_unlock(&engine->lock);
+    return WE_FAIL;
+  }
+  if (!engine->running)
+  {
+    req->state = WE_asyncCancelled;
+    pthread_mutex_unlock(&engine->lock);
+    return WE_FAIL;
+  }
+  req->next = NULL;
+  req->state = WE_asyncPending;
+  if (engine->tail != NULL)
+  {
+    engine->tail->next = req;
+  }
+  else
+  {
+    engine->head = req;
+  }
+  engine->tail = req;
+  pthread_cond_signal(&engine->queued);
+  pthread_mutex_unlock(&engine->lock);
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Wait for the completion of a request
+* @param  -engine : engine the request was submitted to
+*         -req : submitted request
+*         -timeoutMs : maximum time to wait in ms, -1 waits forever
+* @retval Error Code
+*/
+int8_t AsyncWait(we_async_engine_t *engine, we_async_req_t *req, int timeoutMs)
+{
+  struct timespec until;
+  uint64_t untilNs = 0;
+  int ret = 0;
+
+  if (timeoutMs >= 0)
+  {
+    /* the condition variables use CLOCK_REALTIME */
+    clock_gettime(CLOCK_REALTIME, &until);
+    untilNs = ((uint64_t)until.tv_sec * 1000000000ULL) + (uint64_t)until.tv_nsec + ((uint64_t)timeoutMs * 1000000ULL);
+    until.tv_sec = (time_t)(untilNs / 1000000000ULL);
+    until.tv_nsec = (long)(untilNs % 1000000000ULL);
+  }
+
+  pthread_mutex_lock(&engine->lock);
+  engine->waiters++;
+  while ((req->state == WE_asyncPending) && (ret == 0))
+  {
+    if (timeoutMs >= 0)
+    {
+      ret = pthread_cond_timedwait(&engine->completed, &engine->lock, &until);
+    }
+    else
+    {
+      ret = pthread_cond_wait(&engine->completed, &engine->lock);
+    }
+  }
+  ret = (req->state == WE_asyncDone) ? WE_SUCCESS : WE_FAIL;
+  engine->waiters--;
+  if (!engine->running && (engine->waiters == 0))
+  {
+    /* AsyncEngineStop() waits for the last waiter to leave */
+    pthread_cond_broadcast(&engine->completed);
+  }
+  pthread_mutex_unlock(&engine->lock);
+
+  return (int8_t)ret;
+}
+
+/**         EOF         */
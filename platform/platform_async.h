@@ -0,0 +1,148 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef _WE_PLATFORM_ASYNC_H
+#define _WE_PLATFORM_ASYNC_H
+
+/*
+ * #### INFORMATIVE ####
+ * Asynchronous register access. Requests are queued on the engine of a bus and executed in submission order
+ * by one worker thread per bus (i2c adapter or SPI controller), using the synchronous ReadReg()/WriteReg()/
+ * ReadRegBatch() of the device. The submitting thread does not block on the transfer, so a single thread
+ * can keep several buses busy at the same time by submitting to their engines and waiting for the completions.
+ * A request completes by callback (on the worker thread), by incrementing an eventfd (shareable between
+ * requests and engines, e.g. one eventfd polled for all buses) and/or by AsyncWait().
+ * The worker takes the bus lock per request like any other thread, so asynchronous and direct driver calls
+ * can be mixed on the same bus.
+ */
+
+/**         Includes         */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "platform.h"
+
+
+/**         Type definitions         */
+
+typedef enum {
+	WE_asyncRead,             /* ReadReg() */
+	WE_asyncWrite,            /* WriteReg() */
+	WE_asyncReadBatch         /* ReadRegBatch() */
+} we_async_op_t;
+
+typedef enum {
+	WE_asyncIdle,             /* prepared, not submitted */
+	WE_asyncPending,          /* queued or in progress */
+	WE_asyncDone,             /* transfer succeeded */
+	WE_asyncFailed,           /* transfer returned WE_FAIL */
+	WE_asyncExpired,          /* deadline passed before the transfer was started, the bus was not accessed */
+	WE_asyncCancelled         /* engine stopped before the transfer was started */
+} we_async_state_t;
+
+typedef struct we_async_req_s we_async_req_t;
+
+/* 
+ * Completion callback, runs on the worker thread of the bus and must not block. state is the final state,
+ * req->state is already set to it: the request belongs to the caller again and may be resubmitted (also from
+ * the callback) or freed; the callback must not access it after that.
+ */
+typedef void (*we_async_cb_t)(we_async_req_t *req, we_async_state_t state, void *userData);
+
+/**
+* Asynchronous request
+* Owned by the caller and must stay valid (together with its data buffer) while it is pending; it belongs to
+* the caller again as soon as its state is final.
+*/
+struct we_async_req_s {
+	we_async_op_t op;
+	we_dev_t *dev;
+	uint8_t RegAdr;           /* WE_asyncRead, WE_asyncWrite */
+	int NumBytes;             /* WE_asyncRead, WE_asyncWrite */
+	uint8_t *Data;            /* WE_asyncRead, WE_asyncWrite */
+	we_reg_read_t *reads;     /* WE_asyncReadBatch */
+	int count;                /* WE_asyncReadBatch */
+	uint64_t deadlineNs;      /* CLOCK_MONOTONIC time the transfer must be started by, 0: none */
+	we_async_cb_t callback;   /* NULL: no callback */
+	void *userData;
+	int eventFd;              /* eventfd incremented on completion, -1: none */
+	volatile we_async_state_t state;
+	we_async_req_t *next;     /* queue link, engine internal */
+};
+
+/**
+* Engine of one bus: request queue and worker thread
+*/
+typedef struct {
+	we_bus_t *bus;
+	pthread_t worker;
+	pthread_mutex_t lock;
+	pthread_cond_t queued;    /* signalled when a request is queued or the engine is stopped */
+	pthread_cond_t completed; /* broadcast when a request completes, see AsyncWait() */
+	we_async_req_t *head;
+	we_async_req_t *tail;
+	bool running;
+	uint32_t done;            /* completion counters */
+	uint32_t failed;
+	uint32_t expired;
+	uint32_t waiters;         /* threads inside AsyncWait(), AsyncEngineStop() waits for them to leave */
+} we_async_engine_t;
+
+
+/**         Functions definition         */
+
+/* Starts the worker thread of a bus */
+int8_t AsyncEngineStart(we_async_engine_t *engine, we_bus_t *bus);
+
+/* 
+ * Stops the worker after the request in progress; queued requests complete as WE_asyncCancelled.
+ * Returns once the threads waiting in AsyncWait() have left; AsyncWait() must not be called after the stop.
+ */
+void AsyncEngineStop(we_async_engine_t *engine);
+
+/* Prepare a request. Completion defaults to AsyncWait() only: no callback, no eventfd, no deadline. */
+void AsyncPrepareRead(we_async_req_t *req, we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data);
+void AsyncPrepareWrite(we_async_req_t *req, we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data);
+void AsyncPrepareReadBatch(we_async_req_t *req, we_dev_t *dev, we_reg_read_t *reads, int count);
+
+/* Sets the deadline of a prepared request to now + timeoutMs */
+void AsyncSetDeadline(we_async_req_t *req, unsigned int timeoutMs);
+
+/* Queues a prepared request on the engine of the device's bus. Does not block on the bus. */
+int8_t AsyncSubmit(we_async_engine_t *engine, we_async_req_t *req);
+
+/* 
+ * Blocks until the request is completed or timeoutMs expires (-1: no timeout).
+ * Returns WE_SUCCESS only if the request completed as WE_asyncDone.
+ */
+int8_t AsyncWait(we_async_engine_t *engine, we_async_req_t *req, int timeoutMs);
+
+/* CLOCK_MONOTONIC time in ns, the time base of the request deadlines */
+uint64_t AsyncNowNs(void);
+
+#endif /* _WE_PLATFORM_ASYNC_H */
+/**         EOF         */
@@ -0,0 +1,166 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform_convert.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CONVERT_KERNEL          "avx2"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define CONVERT_KERNEL          "sse2"
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CONVERT_NEON
+#define CONVERT_KERNEL          "neon"
+#else
+#define CONVERT_KERNEL          "scalar"
+#endif
+
+
+/**
+* @brief  Convert a buffer of signed 16 bit raw values
+*         out[i] = (float)(raw[i] >> shift) * scale + offset, the shift is arithmetic (left aligned raw values)
+* @param  Raw values
+* @param  Converted values
+* @param  Number of values
+* @param  Right shift applied to the raw values, 0..15
+* @param  Factor, i.e. reciprocal of the sensitivity
+* @param  Offset added after scaling
+* @retval None
+*/
+void ConvertInt16ToFloat(const int16_t *raw, float *out, int count, uint8_t shift, float scale, float offset)
+{
+  int i = 0;
+
+#if defined(__AVX2__)
+  const __m256 vScale = _mm256_set1_ps(scale);
+  const __m256 vOffset = _mm256_set1_ps(offset);
+  const __m128i vShift = _mm_cvtsi32_si128(shift);
+
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256i v = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(raw + i)));
+
+    v = _mm256_sra_epi32(v, vShift);
+    _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(v), vScale), vOffset));
+  }
+#elif defined(__SSE2__)
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vOffset = _mm_set1_ps(offset);
+  const __m128i vShift = _mm_cvtsi32_si128(shift);
+
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i v = _mm_sra_epi16(_mm_loadu_si128((const __m128i *)(raw + i)), vShift);
+    /* sign extend to 32 bit: place each value in the upper half and shift back */
+    __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+    __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+
+    _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), vScale), vOffset));
+    _mm_storeu_ps(out + i + 4, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), vScale), vOffset));
+  }
+#elif defined(CONVERT_NEON)
+  const float32x4_t vScale = vdupq_n_f32(scale);
+  const float32x4_t vOffset = vdupq_n_f32(offset);
+  const int16x8_t vShift = vdupq_n_s16((int16_t)-shift);  /* negative left shift: arithmetic right shift */
+
+  for (; i + 8 <= count; i += 8)
+  {
+    int16x8_t v = vshlq_s16(vld1q_s16(raw + i), vShift);
+    float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v)));
+    float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v)));
+
+    vst1q_f32(out + i, vmlaq_f32(vOffset, lo, vScale));
+    vst1q_f32(out + i + 4, vmlaq_f32(vOffset, hi, vScale));
+  }
+#endif
+
+  for (; i < count; i++)
+  {
+    out[i] = (float)(raw[i] >> shift) * scale + offset;
+  }
+}
+
+/**
+* @brief  Convert a buffer of signed 32 bit raw values (e.g. sign extended 24 bit values)
+*         out[i] = (float)raw[i] * scale + offset
+* @param  Raw values
+* @param  Converted values
+* @param  Number of values
+* @param  Factor, i.e. reciprocal of the sensitivity
+* @param  Offset added after scaling
+* @retval None
+*/
+void ConvertInt32ToFloat(const int32_t *raw, float *out, int count, float scale, float offset)
+{
+  int i = 0;
+
+#if defined(__AVX2__)
+  const __m256 vScale = _mm256_set1_ps(scale);
+  const __m256 vOffset = _mm256_set1_ps(offset);
+
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256 v = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(raw + i)));
+
+    _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(v, vScale), vOffset));
+  }
+#elif defined(__SSE2__)
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vOffset = _mm_set1_ps(offset);
+
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128 v = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(raw + i)));
+
+    _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(v, vScale), vOffset));
+  }
+#elif defined(CONVERT_NEON)
+  const float32x4_t vScale = vdupq_n_f32(scale);
+  const float32x4_t vOffset = vdupq_n_f32(offset);
+
+  for (; i + 4 <= count; i += 4)
+  {
+    vst1q_f32(out + i, vmlaq_f32(vOffset, vcvtq_f32_s32(vld1q_s32(raw + i)), vScale));
+  }
+#endif
+
+  for (; i < count; i++)
+  {
+    out[i] = (float)raw[i] * scale + offset;
+  }
+}
+
+/**
+* @brief  Name of the kernel selected at compile time
+* @retval "avx2", "sse2", "neon" or "scalar"
+*/
+const char *ConvertKernelName(void)
+{
+  return CONVERT_KERNEL;
+}
+
+/**         EOF         */
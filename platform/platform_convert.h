@@ -0,0 +1,63 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef _WE_PLATFORM_CONVERT_H
+#define _WE_PLATFORM_CONVERT_H
+
+/*
+ * #### INFORMATIVE ####
+ * Batch conversion kernels for buffers of raw sensor values, used by the drivers' *Buffer / *XYZ conversion functions.
+ * Every conversion in the SDK is linear: out = (float)(raw >> shift) * scale + offset. Divisions by the sensitivity
+ * are replaced by a multiplication with its reciprocal, the result may therefore differ from the single value
+ * getters in the last bit of the mantissa.
+ * The kernel is chosen at compile time from the target's instruction set (AVX2 with -mavx2, SSE2 on every x86-64,
+ * NEON on ARMv7 with -mfpu=neon and AArch64); buffer tails and other targets use the scalar loop.
+ * Input and output buffers need no particular alignment and must not overlap.
+ */
+
+/**         Includes         */
+
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+	/* **********************/
+	/* Functions definition */
+	/* **********************/
+
+	void ConvertInt16ToFloat(const int16_t *raw, float *out, int count, uint8_t shift, float scale, float offset);
+	void ConvertInt32ToFloat(const int32_t *raw, float *out, int count, float scale, float offset);
+	const char *ConvertKernelName(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WE_PLATFORM_CONVERT_H */
+/**         EOF         */
@@ -0,0 +1,182 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+
+/*
+ * #### INFORMATIVE ####
+ * Interrupt lines use the GPIO character device (line event ABI v1, Linux >= 4.8), no sysfs and no wiringPi.
+ * The kernel timestamps every edge in the interrupt handler, so the time of the event does not depend on
+ * the wake up latency of the waiting thread.
+ */
+
+#define INT_LINE_CONSUMER       "we-sensor-int"
+#define INT_LINE_MAX_EVENTS     16  /* edges consumed per read() */
+
+
+/**
+* @brief  Request a GPIO line as edge event source
+* @param  -intLine : interrupt line to initialize
+*         -chip : number N of /dev/gpiochipN
+*         -offset : line offset on the chip
+*         -edge : edge(s) to report
+* @retval Error Code
+*/
+int8_t IntLineInit(we_int_line_t *intLine, int chip, unsigned int offset, we_int_edge_t edge)
+{
+  struct gpioevent_request request;
+  char devName[32];
+  int chipFd;
+  int flags;
+
+  if ((intLine == NULL) || (chip < 0) || (edge < WE_risingEdge) || (edge > WE_bothEdges))
+  {
+    return WE_FAIL;
+  }
+
+  memset(intLine, 0, sizeof(we_int_line_t));
+  intLine->fd = -1;
+  intLine->chip = chip;
+  intLine->offset = offset;
+  intLine->edge = edge;
+
+  snprintf(devName, sizeof(devName), "/dev/gpiochip%d", chip);
+  chipFd = open(devName, O_RDONLY | O_CLOEXEC);
+  if (chipFd < 0)
+  {
+    fprintf(stderr, "%s: %s\n", devName, strerror(errno));
+    return WE_FAIL;
+  }
+
+  memset(&request, 0, sizeof(request));
+  request.lineoffset = offset;
+  request.handleflags = GPIOHANDLE_REQUEST_INPUT;
+  request.eventflags = ((edge & WE_risingEdge) ? GPIOEVENT_REQUEST_RISING_EDGE : 0) |
+                       ((edge & WE_fallingEdge) ? GPIOEVENT_REQUEST_FALLING_EDGE : 0);
+  strncpy(request.consumer_label, INT_LINE_CONSUMER, sizeof(request.consumer_label) - 1);
+
+  if (ioctl(chipFd, GPIO_GET_LINEEVENT_IOCTL, &request) < 0)
+  {
+    fprintf(stderr, "%s line %u: %s\n", devName, offset, strerror(errno));
+    close(chipFd);
+    return WE_FAIL;
+  }
+  close(chipFd);
+
+  /* edges are drained without blocking once poll() reported them */
+  flags = fcntl(request.fd, F_GETFL);
+  if ((flags < 0) || (fcntl(request.fd, F_SETFL, flags | O_NONBLOCK) < 0))
+  {
+    close(request.fd);
+    return WE_FAIL;
+  }
+
+  intLine->fd = request.fd;
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Wait for an edge on an interrupt line
+* @param  -intLine : requested interrupt line
+*         -timeoutMs : maximum time to wait in ms, -1 waits forever
+*         -fired : set to true if at least one edge has been received
+* @retval Error Code
+*/
+int8_t IntLineWait(we_int_line_t *intLine, int timeoutMs, bool *fired)
+{
+  struct gpioevent_data events[INT_LINE_MAX_EVENTS];
+  struct pollfd pfd;
+  ssize_t len;
+  int ret;
+
+  *fired = false;
+
+  if (intLine->fd < 0)
+  {
+    return WE_FAIL;
+  }
+
+  pfd.fd = intLine->fd;
+  pfd.events = POLLIN | POLLPRI;
+  pfd.revents = 0;
+
+  do
+  {
+    ret = poll(&pfd, 1, timeoutMs);
+  } while ((ret < 0) && (errno == EINTR));
+
+  if (ret < 0)
+  {
+    return WE_FAIL;
+  }
+  if (ret == 0)
+  {
+    return WE_SUCCESS; /* timeout */
+  }
+
+  /* consume all queued edges, the latest one carries the timestamp */
+  while ((len = read(intLine->fd, events, sizeof(events))) > 0)
+  {
+    int n = (int)(len / sizeof(struct gpioevent_data));
+
+    if (n > 0)
+    {
+      intLine->events += (uint32_t)n;
+      intLine->timestampNs = events[n - 1].timestamp;
+      *fired = true;
+    }
+  }
+
+  if ((len < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+  {
+    return WE_FAIL;
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Release an interrupt line
+* @param  -intLine : interrupt line
+* @retval None
+*/
+void IntLineClose(we_int_line_t *intLine)
+{
+  if (intLine->fd >= 0)
+  {
+    close(intLine->fd);
+    intLine->fd = -1;
+  }
+}
+
+/**         EOF         */
@@ -0,0 +1,385 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform.h"
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+
+
+#define DUMMY 0x00
+
+#define SPI_MAX_BATCH  16  /* maximum number of SPI transfers combined into one ioctl */
+
+
+/**
+* @brief  Read data starting from the addressed register using one repeated-start I2C_RDWR transaction
+* @param  -dev : device to read from, handle must be an opened i2c-dev file
+*         -RegAdr : the register address to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+int8_t LinuxI2CReadReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  struct i2c_msg msgs[2];
+  struct i2c_rdwr_ioctl_data transfer;
+
+  msgs[0].addr = (uint16_t)dev->address;
+  msgs[0].flags = 0;
+  msgs[0].len = 1;
+  msgs[0].buf = &RegAdr;
+
+  msgs[1].addr = (uint16_t)dev->address;
+  msgs[1].flags = I2C_M_RD;
+  msgs[1].len = (uint16_t)NumByteToRead;
+  msgs[1].buf = Data;
+
+  transfer.msgs = msgs;
+  transfer.nmsgs = 2;
+
+  if (ioctl(dev->handle, I2C_RDWR, &transfer) != 2)
+  {
+    return WE_FAIL;
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Read several register blocks, up to I2C_RDWR_IOCTL_MAX_MSGS / 2 blocks per I2C_RDWR transaction
+* @param  -dev : device to read from, handle must be an opened i2c-dev file
+*         -reads : list of register blocks (start address, length, destination)
+*         -count : number of entries in reads
+* @retval Error Code
+*/
+int8_t LinuxI2CReadRegBatch(we_dev_t *dev, we_reg_read_t *reads, int count)
+{
+  struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+  uint8_t regAddresses[I2C_RDWR_IOCTL_MAX_MSGS / 2];
+  struct i2c_rdwr_ioctl_data transfer;
+  int i = 0;
+
+  while (i < count)
+  {
+    int nmsgs = 0;
+
+    while ((i < count) && (nmsgs < I2C_RDWR_IOCTL_MAX_MSGS))
+    {
+      regAddresses[nmsgs / 2] = reads[i].RegAdr;
+      if (reads[i].NumByteToRead > 1)
+      {
+        regAddresses[nmsgs / 2] |= dev->multiByteMask;
+      }
+
+      msgs[nmsgs].addr = (uint16_t)dev->address;
+      msgs[nmsgs].flags = 0;
+      msgs[nmsgs].len = 1;
+      msgs[nmsgs].buf = &regAddresses[nmsgs / 2];
+
+      msgs[nmsgs + 1].addr = (uint16_t)dev->address;
+      msgs[nmsgs + 1].flags = I2C_M_RD;
+      msgs[nmsgs + 1].len = (uint16_t)reads[i].NumByteToRead;
+      msgs[nmsgs + 1].buf = reads[i].Data;
+
+      nmsgs += 2;
+      i++;
+    }
+
+    transfer.msgs = msgs;
+    transfer.nmsgs = nmsgs;
+
+    if (ioctl(dev->handle, I2C_RDWR, &transfer) != nmsgs)
+    {
+      return WE_FAIL;
+    }
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Write data starting from the addressed register, start address and data in one I2C message
+* @param  -dev : device to write to, handle must be an opened i2c-dev file
+*         -RegAdr : Address to write in
+*         -NumByteToWrite : number of bytes to write
+*         -pointer Data : Address of the data to be written
+* @retval Error Code
+*/
+int8_t LinuxI2CWriteReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+  uint8_t fulldata[WE_MAX_BURST_LEN + 1];
+  struct i2c_msg msg;
+  struct i2c_rdwr_ioctl_data transfer;
+
+  fulldata[0] = RegAdr;
+  memcpy(&fulldata[1], Data, NumByteToWrite);
+
+  msg.addr = (uint16_t)dev->address;
+  msg.flags = 0;
+  msg.len = (uint16_t)(NumByteToWrite + 1);
+  msg.buf = fulldata;
+
+  transfer.msgs = &msg;
+  transfer.nmsgs = 1;
+
+  if (ioctl(dev->handle, I2C_RDWR, &transfer) != 1)
+  {
+    return WE_FAIL;
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Read data without a register address, a single I2C read message (register-less devices)
+*         One ioctl on the stack, no retries: returns as soon as the transfer is done or has failed.
+* @param  -dev : device to read from, handle must be an opened i2c-dev file
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+int8_t LinuxI2CRead(we_dev_t *dev, int NumByteToRead, uint8_t *Data)
+{
+  struct i2c_msg msg;
+  struct i2c_rdwr_ioctl_data transfer;
+
+  msg.addr = (uint16_t)dev->address;
+  msg.flags = I2C_M_RD;
+  msg.len = (uint16_t)NumByteToRead;
+  msg.buf = Data;
+
+  transfer.msgs = &msg;
+  transfer.nmsgs = 1;
+
+  if (ioctl(dev->handle, I2C_RDWR, &transfer) != 1)
+  {
+    return WE_FAIL;
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Open /dev/i2c-N or /dev/spidevB.C for the device and configure the SPI mode and clock
+* @param  -dev : device to open
+* @retval Error Code
+*/
+static int8_t linuxOpen(we_dev_t *dev)
+{
+  char devicePath[32];
+
+  if (dev->bus->type == WE_spi)
+  {
+    uint8_t mode = (uint8_t)dev->bus->spiMode;
+    uint8_t bits = 8;
+    uint32_t speed = (uint32_t)dev->bus->speed;
+
+    snprintf(devicePath, sizeof(devicePath), "/dev/spidev%d.%d", dev->bus->adapter, dev->address);
+    if ((dev->handle = open(devicePath, O_RDWR)) < 0)
+    {
+      fprintf(stdout, "spidev open Error\n");
+      return WE_FAIL;
+    }
+
+    if ((ioctl(dev->handle, SPI_IOC_WR_MODE, &mode) < 0) ||
+        (ioctl(dev->handle, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0) ||
+        (ioctl(dev->handle, SPI_IOC_WR_MAX_SPEED_HZ, &speed) < 0))
+    {
+      fprintf(stdout, "spidev setup Error\n");
+      close(dev->handle);
+      dev->handle = -1;
+      return WE_FAIL;
+    }
+
+    return WE_SUCCESS;
+  }
+
+  /* I2C: the slave address is part of every I2C_RDWR message, no I2C_SLAVE binding required */
+  snprintf(devicePath, sizeof(devicePath), "/dev/i2c-%d", dev->bus->adapter);
+  if ((dev->handle = open(devicePath, O_RDWR)) < 0)
+  {
+    fprintf(stdout, "i2c-dev open Error\n");
+    return WE_FAIL;
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Read registers: I2C_RDWR on I2C, one full duplex spidev transfer on SPI
+* @param  -dev : device to read from
+*         -RegAdr : the register address to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+static int8_t linuxReadReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    uint8_t fulldata[WE_MAX_BURST_LEN + 1];
+    struct spi_ioc_transfer transfer;
+
+    fulldata[0] = RegAdr | SPI_READ_MASK;
+    memset(&fulldata[1], DUMMY, NumByteToRead);
+
+    memset(&transfer, 0, sizeof(transfer));
+    transfer.tx_buf = (unsigned long)fulldata;
+    transfer.rx_buf = (unsigned long)fulldata;
+    transfer.len = (uint32_t)(NumByteToRead + 1);
+
+    if (ioctl(dev->handle, SPI_IOC_MESSAGE(1), &transfer) < 0)
+    {
+      return WE_FAIL;
+    }
+
+    memcpy(Data, &fulldata[1], NumByteToRead);
+    return WE_SUCCESS;
+  }
+
+  return LinuxI2CReadReg(dev, RegAdr, NumByteToRead, Data);
+}
+
+/**
+* @brief  Read several register blocks. On SPI up to SPI_MAX_BATCH chip select cycles are combined into one ioctl.
+* @param  -dev : device to read from
+*         -reads : list of register blocks (start address, length, destination)
+*         -count : number of entries in reads
+* @retval Error Code
+*/
+static int8_t linuxReadRegBatch(we_dev_t *dev, we_reg_read_t *reads, int count)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    struct spi_ioc_transfer transfers[SPI_MAX_BATCH * 2];
+    uint8_t addresses[SPI_MAX_BATCH];
+    int i = 0;
+
+    while (i < count)
+    {
+      int n = 0;
+
+      memset(transfers, 0, sizeof(transfers));
+      while ((i < count) && (n < SPI_MAX_BATCH))
+      {
+        /* address byte followed by the data bytes, chip select released after each block */
+        addresses[n] = reads[i].RegAdr | SPI_READ_MASK;
+        if (reads[i].NumByteToRead > 1)
+        {
+          addresses[n] |= dev->multiByteMask;
+        }
+
+        transfers[2 * n].tx_buf = (unsigned long)&addresses[n];
+        transfers[2 * n].len = 1;
+
+        transfers[2 * n + 1].rx_buf = (unsigned long)reads[i].Data;
+        transfers[2 * n + 1].len = (uint32_t)reads[i].NumByteToRead;
+        transfers[2 * n + 1].cs_change = 1;
+
+        n++;
+        i++;
+      }
+
+      /* cs_change on the last transfer would keep chip select asserted after the message */
+      transfers[2 * n - 1].cs_change = 0;
+
+      if (ioctl(dev->handle, SPI_IOC_MESSAGE(2 * n), transfers) < 0)
+      {
+        return WE_FAIL;
+      }
+    }
+
+    return WE_SUCCESS;
+  }
+
+  return LinuxI2CReadRegBatch(dev, reads, count);
+}
+
+/**
+* @brief  Write registers: one I2C message on I2C, one spidev transfer on SPI
+* @param  -dev : device to write to
+*         -RegAdr : Address to write in
+*         -NumByteToWrite : number of bytes to write
+*         -pointer Data : Address of the data to be written
+* @retval Error Code
+*/
+static int8_t linuxWriteReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    uint8_t fulldata[WE_MAX_BURST_LEN + 1];
+    struct spi_ioc_transfer transfer;
+
+    fulldata[0] = RegAdr;
+    memcpy(&fulldata[1], Data, NumByteToWrite);
+
+    memset(&transfer, 0, sizeof(transfer));
+    transfer.tx_buf = (unsigned long)fulldata;
+    transfer.len = (uint32_t)(NumByteToWrite + 1);
+
+    if (ioctl(dev->handle, SPI_IOC_MESSAGE(1), &transfer) < 0)
+    {
+      return WE_FAIL;
+    }
+
+    return WE_SUCCESS;
+  }
+
+  return LinuxI2CWriteReg(dev, RegAdr, NumByteToWrite, Data);
+}
+
+/**
+* @brief  Read without register address, I2C only
+* @param  -dev : device to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+static int8_t linuxRead(we_dev_t *dev, int NumByteToRead, uint8_t *Data)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    return WE_FAIL;
+  }
+
+  return LinuxI2CRead(dev, NumByteToRead, Data);
+}
+
+const we_bus_ops_t WE_linuxBusOps = {
+  linuxOpen,
+  linuxReadReg,
+  linuxWriteReg,
+  linuxReadRegBatch,
+  NULL,
+  linuxRead
+};
+
+/**         EOF         */
@@ -0,0 +1,172 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform_ring.h"
+#include "platform.h"
+#include <string.h>
+
+
+/**
+* @brief  Initialize an empty ring
+* @param  -ring : ring buffer
+*         -storage : memory for capacity * recordSize bytes, must stay valid as long as the ring is used
+*         -capacity : number of records, power of 2
+*         -recordSize : size of one record in bytes
+* @retval Error Code
+*/
+int8_t RingInit(we_ring_t *ring, void *storage, uint32_t capacity, uint32_t recordSize)
+{
+  if ((ring == NULL) || (storage == NULL) || (recordSize == 0) || (capacity == 0) || ((capacity & (capacity - 1)) != 0))
+  {
+    return WE_FAIL;
+  }
+
+  ring->storage = (uint8_t *)storage;
+  ring->capacity = capacity;
+  ring->recordSize = recordSize;
+  ring->head = 0;
+  ring->tail = 0;
+  ring->overruns = 0;
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Copy records between a linear buffer and the ring storage, wrapping at the end of the storage
+* @param  -ring : ring buffer
+*         -index : free running index of the first record
+*         -records : linear buffer
+*         -count : number of records
+*         -toRing : true: linear buffer to ring; false: ring to linear buffer
+* @retval None
+*/
+static void RingCopy(we_ring_t *ring, uint32_t index, uint8_t *records, uint32_t count, bool toRing)
+{
+  uint32_t first = index & (ring->capacity - 1);
+  uint32_t chunk = ring->capacity - first;
+  uint8_t *slot = ring->storage + (size_t)first * ring->recordSize;
+
+  if (chunk > count)
+  {
+    chunk = count;
+  }
+
+  if (toRing)
+  {
+    memcpy(slot, records, (size_t)chunk * ring->recordSize);
+    memcpy(ring->storage, records + (size_t)chunk * ring->recordSize, (size_t)(count - chunk) * ring->recordSize);
+  }
+  else
+  {
+    memcpy(records, slot, (size_t)chunk * ring->recordSize);
+    memcpy(records + (size_t)chunk * ring->recordSize, ring->storage, (size_t)(count - chunk) * ring->recordSize);
+  }
+}
+
+/**
+* @brief  Append records, producer side
+*         The records are copied before the new head is published (release), so the consumer never sees a
+*         partially written record. Records that do not fit are dropped and counted.
+* @param  -ring : ring buffer
+*         -records : records to append
+*         -count : number of records
+* @retval number of records appended
+*/
+uint32_t RingPush(we_ring_t *ring, const void *records, uint32_t count)
+{
+  uint32_t head = ring->head;
+  uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+  uint32_t space = ring->capacity - (head - tail);
+
+  if (count > space)
+  {
+    __atomic_store_n(&ring->overruns, ring->overruns + (count - space), __ATOMIC_RELAXED);
+    count = space;
+  }
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  RingCopy(ring, head, (uint8_t *)records, count, true);
+  __atomic_store_n(&ring->head, head + count, __ATOMIC_RELEASE);
+
+  return count;
+}
+
+/**
+* @brief  Remove records, consumer side
+*         The records are copied out before the new tail is published (release), so the producer never
+*         overwrites a record that is still being read.
+* @param  -ring : ring buffer
+*         -records : buffer for the records
+*         -maxCount : size of the buffer in records
+* @retval number of records removed
+*/
+uint32_t RingPop(we_ring_t *ring, void *records, uint32_t maxCount)
+{
+  uint32_t tail = ring->tail;
+  uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+  uint32_t count = head - tail;
+
+  if (count > maxCount)
+  {
+    count = maxCount;
+  }
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  RingCopy(ring, tail, (uint8_t *)records, count, false);
+  __atomic_store_n(&ring->tail, tail + count, __ATOMIC_RELEASE);
+
+  return count;
+}
+
+/**
+* @brief  Number of records in the ring
+* @param  -ring : ring buffer
+* @retval number of records
+*/
+uint32_t RingCount(const we_ring_t *ring)
+{
+  uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+  uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+  return head - tail;
+}
+
+/**
+* @brief  Number of records dropped because the ring was full
+* @param  -ring : ring buffer
+* @retval number of records dropped since RingInit()
+*/
+uint32_t RingOverruns(const we_ring_t *ring)
+{
+  return __atomic_load_n(&ring->overruns, __ATOMIC_RELAXED);
+}
+
+/**         EOF         */
@@ -0,0 +1,89 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef _WE_PLATFORM_RING_H
+#define _WE_PLATFORM_RING_H
+
+/*
+ * #### INFORMATIVE ####
+ * Lock-free single-producer single-consumer ring buffer of fixed-size records, e.g. ITDS_sample_t, PADS_sample_t
+ * or a struct of HIDS humidity/temperature, TIDS temperature or PDUS pressure/temperature values.
+ * One thread (the acquisition) pushes and one other thread (logger, network) pops; neither ever blocks or takes
+ * a lock. A full ring drops the newest records and counts them as overruns, so the producer is never held up by
+ * a slow consumer. The producer and consumer indices live on separate cache lines.
+ * Built on the GCC/Clang __atomic builtins (acquire/release ordering), no C11 <stdatomic.h> needed.
+ */
+
+/**         Includes         */
+
+#include <stdint.h>
+
+#define WE_RING_CACHE_LINE          64    /* alignment of the producer and consumer indices */
+
+
+/**         Type definitions         */
+
+/**
+* Ring buffer, see RingInit()
+* The indices run freely and are taken modulo the capacity (a power of 2).
+*/
+typedef struct {
+	uint8_t *storage;             /* capacity * recordSize bytes, owned by the caller */
+	uint32_t capacity;            /* number of records, power of 2 */
+	uint32_t recordSize;          /* size of one record in bytes */
+	uint32_t head __attribute__((aligned(WE_RING_CACHE_LINE)));   /* written by the producer only */
+	uint32_t overruns;            /* records dropped on a full ring, written by the producer only */
+	uint32_t tail __attribute__((aligned(WE_RING_CACHE_LINE)));   /* written by the consumer only */
+} we_ring_t;
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+	/**         Functions definition         */
+
+	/* Initializes an empty ring on caller provided storage of capacity * recordSize bytes, capacity a power of 2 */
+	int8_t RingInit(we_ring_t *ring, void *storage, uint32_t capacity, uint32_t recordSize);
+
+	/* Producer: appends up to count records, returns the number appended; the others are counted as overruns */
+	uint32_t RingPush(we_ring_t *ring, const void *records, uint32_t count);
+
+	/* Consumer: removes up to maxCount records, oldest first, returns the number removed */
+	uint32_t RingPop(we_ring_t *ring, void *records, uint32_t maxCount);
+
+	/* Number of records in the ring, exact from either side, a snapshot from any other thread */
+	uint32_t RingCount(const we_ring_t *ring);
+
+	/* Number of records dropped since RingInit() */
+	uint32_t RingOverruns(const we_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WE_PLATFORM_RING_H */
+/**         EOF         */
@@ -0,0 +1,491 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform_sim.h"
+#include <string.h>
+
+
+/**
+* @brief  Advance the bus clock by the duration of a transfer and count it
+* @param  -bus : simulated bus
+*         -numBytes : number of data bytes moved after the register addresses
+*         -blocks : number of register blocks (1, or more for a batched read)
+* @retval None
+*/
+static void simChargeTransfer(we_bus_t *bus, int numBytes, int blocks)
+{
+  we_sim_bus_t *simBus = (we_sim_bus_t *)bus->context;
+  uint64_t bits;
+
+  if (bus->type == WE_spi)
+  {
+    /* address byte and data bytes, 8 clocks each; every block is a chip select cycle of its own */
+    bits = 8 * (uint64_t)(numBytes + blocks);
+    simBus->transactions += (uint32_t)blocks;
+  }
+  else
+  {
+    /* per block slave address, register address, repeated start slave address and data bytes, 9 clocks each; one start/stop */
+    bits = 9 * (uint64_t)(numBytes + 3 * blocks) + 2;
+    simBus->transactions++;
+  }
+
+  simBus->nowUs += (bits * 1000000 + simBus->clockHz - 1) / simBus->clockHz;
+  simBus->bytes += (uint32_t)(numBytes + blocks);
+}
+
+/**
+* @brief  Bring the model of a device up to the current time of its bus
+* @param  -dev : simulated device
+* @retval simulated device state
+*/
+static we_sim_device_t *simSync(we_dev_t *dev)
+{
+  we_sim_device_t *sim = (we_sim_device_t *)dev->context;
+
+  sim->nowUs = ((we_sim_bus_t *)dev->bus->context)->nowUs;
+  sim->model->update(sim);
+  return sim;
+}
+
+/**
+* @brief  Address of the next byte of a multi-byte access
+* @param  -sim : simulated device state
+*         -RegAdr : current register address
+*         -increment : false if the access does not auto increment (multi-byte address bit not set)
+* @retval next register address
+*/
+static uint8_t simNextAddress(we_sim_device_t *sim, uint8_t RegAdr, bool increment)
+{
+  if (!increment)
+  {
+    return RegAdr;
+  }
+  if (sim->model->nextAddress != NULL)
+  {
+    return sim->model->nextAddress(sim, RegAdr);
+  }
+  return (uint8_t)(RegAdr + 1);
+}
+
+/**
+* @brief  Read a block of registers from the register file, without charging bus time
+* @param  -dev : device to read from
+*         -sim : simulated device state, synchronized to the bus time
+*         -RegAdr : the register address to read from, including the multiByteBit of the model
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval None
+*/
+static void simReadBlock(we_dev_t *dev, we_sim_device_t *sim, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  uint8_t multiByteBit = sim->model->multiByteBit[dev->bus->type];
+  bool increment = (multiByteBit == 0) || ((RegAdr & multiByteBit) != 0);
+  int i;
+
+  RegAdr &= (uint8_t)~multiByteBit;
+  for (i = 0; i < NumByteToRead; i++)
+  {
+    Data[i] = (sim->model->read != NULL) ? sim->model->read(sim, RegAdr) : sim->regs[RegAdr];
+    RegAdr = simNextAddress(sim, RegAdr, increment);
+  }
+}
+
+/**
+* @brief  Attach the register file, there is nothing to open
+* @param  -dev : device to open, context must point to its we_sim_device_t
+* @retval Error Code
+*/
+static int8_t simOpen(we_dev_t *dev)
+{
+  if ((dev->bus->context == NULL) || (((we_sim_bus_t *)dev->bus->context)->clockHz == 0))
+  {
+    return WE_FAIL;
+  }
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Read registers from the simulated register file
+* @param  -dev : device to read from
+*         -RegAdr : the register address to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+static int8_t simReadReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  if (dev->context == NULL)
+  {
+    return WE_FAIL;
+  }
+
+  simChargeTransfer(dev->bus, NumByteToRead, 1);
+  simReadBlock(dev, simSync(dev), RegAdr, NumByteToRead, Data);
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Read several register blocks, charged as one repeated-start transaction on I2C
+* @param  -dev : device to read from
+*         -reads : list of register blocks (start address, length, destination)
+*         -count : number of entries in reads
+* @retval Error Code
+*/
+static int8_t simReadRegBatch(we_dev_t *dev, we_reg_read_t *reads, int count)
+{
+  we_sim_device_t *sim;
+  int numBytes = 0;
+  int i;
+
+  if (dev->context == NULL)
+  {
+    return WE_FAIL;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    numBytes += reads[i].NumByteToRead;
+  }
+  simChargeTransfer(dev->bus, numBytes, count);
+  sim = simSync(dev);
+
+  for (i = 0; i < count; i++)
+  {
+    uint8_t RegAdr = reads[i].RegAdr;
+
+    if (reads[i].NumByteToRead > 1)
+    {
+      RegAdr |= dev->multiByteMask;
+    }
+    simReadBlock(dev, sim, RegAdr, reads[i].NumByteToRead, reads[i].Data);
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Write registers of the simulated register file
+* @param  -dev : device to write to
+*         -RegAdr : Address to write in
+*         -NumByteToWrite : number of bytes to write
+*         -pointer Data : Address of the data to be written
+* @retval Error Code
+*/
+static int8_t simWriteReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+  we_sim_device_t *sim;
+  uint8_t multiByteBit;
+  bool increment;
+  int i;
+
+  if (dev->context == NULL)
+  {
+    return WE_FAIL;
+  }
+
+  simChargeTransfer(dev->bus, NumByteToWrite, 1);
+  sim = simSync(dev);
+
+  multiByteBit = sim->model->multiByteBit[dev->bus->type];
+  increment = (multiByteBit == 0) || ((RegAdr & multiByteBit) != 0);
+  RegAdr &= (uint8_t)~multiByteBit;
+  for (i = 0; i < NumByteToWrite; i++)
+  {
+    if (sim->model->write != NULL)
+    {
+      sim->model->write(sim, RegAdr, Data[i]);
+    }
+    else
+    {
+      sim->regs[RegAdr] = Data[i];
+    }
+    RegAdr = simNextAddress(sim, RegAdr, increment);
+  }
+
+  /* apply the new configuration right away, e.g. a changed output data rate */
+  sim->model->update(sim);
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Read without register address: the bytes of a register-less device are registers 0, 1, ... of its model
+* @param  -dev : device to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+static int8_t simRead(we_dev_t *dev, int NumByteToRead, uint8_t *Data)
+{
+  we_sim_bus_t *simBus = (we_sim_bus_t *)dev->bus->context;
+  we_sim_device_t *sim;
+  uint8_t RegAdr = 0;
+  int i;
+
+  if ((dev->context == NULL) || (dev->bus->type == WE_spi))
+  {
+    return WE_FAIL;
+  }
+
+  /* slave address and data bytes, 9 clocks each; start/stop */
+  simBus->nowUs += ((9 * (uint64_t)(NumByteToRead + 1) + 2) * 1000000 + simBus->clockHz - 1) / simBus->clockHz;
+  simBus->transactions++;
+  simBus->bytes += (uint32_t)NumByteToRead;
+
+  sim = simSync(dev);
+  for (i = 0; i < NumByteToRead; i++)
+  {
+    Data[i] = (sim->model->read != NULL) ? sim->model->read(sim, RegAdr) : sim->regs[RegAdr];
+    RegAdr = simNextAddress(sim, RegAdr, true);
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Advance the simulated time instead of sleeping
+* @param  -bus : simulated bus
+*         -sleepForMs : time period in ms
+* @retval None
+*/
+static void simDelay(we_bus_t *bus, unsigned int sleepForMs)
+{
+  SimAdvance(bus, (uint64_t)sleepForMs * 1000);
+}
+
+const we_bus_ops_t WE_simBusOps = {
+  simOpen,
+  simReadReg,
+  simWriteReg,
+  simReadRegBatch,
+  simDelay,
+  simRead
+};
+
+
+/**
+* @brief  Initialize a simulated bus
+* @param  -bus : bus context to initialize
+*         -simBus : simulated clock and counters of the bus
+*         -type : simulated bus type, used for the transfer durations
+*         -clockHz : simulated bus clock
+* @retval Error Code
+*/
+int8_t SimBusInit(we_bus_t *bus, we_sim_bus_t *simBus, we_bus_type_t type, uint32_t clockHz)
+{
+  if ((bus == NULL) || (simBus == NULL) || (clockHz == 0))
+  {
+    return WE_FAIL;
+  }
+
+  memset(simBus, 0, sizeof(we_sim_bus_t));
+  simBus->clockHz = clockHz;
+
+  memset(bus, 0, sizeof(we_bus_t));
+  bus->type = type;
+  bus->ops = &WE_simBusOps;
+  bus->context = simBus;
+  bus->speed = (int)clockHz;
+
+  return BusLockInit(bus);
+}
+
+/**
+* @brief  Attach a simulated sensor to a simulated bus
+* @param  -dev : device context to initialize
+*         -bus : simulated bus
+*         -address : I2C slave address or SPI channel, informative only
+*         -sim : register file and state of the simulated sensor
+*         -model : sensor model, e.g. ITDS_simModel
+* @retval Error Code
+*/
+int8_t SimDeviceInit(we_dev_t *dev, we_bus_t *bus, int address, we_sim_device_t *sim, const we_sim_model_t *model)
+{
+  if ((sim == NULL) || (model == NULL) || (bus == NULL) || (bus->ops != &WE_simBusOps))
+  {
+    return WE_FAIL;
+  }
+
+  if (WE_FAIL == DeviceInit(dev, bus, address))
+  {
+    return WE_FAIL;
+  }
+
+  memset(sim, 0, sizeof(we_sim_device_t));
+  sim->model = model;
+  sim->nowUs = ((we_sim_bus_t *)bus->context)->nowUs;
+  model->reset(sim);
+  dev->context = sim;
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Advance the simulated time of a bus
+* @param  -bus : simulated bus
+*         -us : time to add in us
+* @retval None
+*/
+void SimAdvance(we_bus_t *bus, uint64_t us)
+{
+  ((we_sim_bus_t *)bus->context)->nowUs += us;
+}
+
+/**
+* @brief  Number of output data updates due since the last call. Restarts the sample clock when the period changes.
+* @param  -sim : simulated device
+*         -periodUs : current output data period, 0 if the sensor does not convert continuously
+* @retval number of samples the model has to produce
+*/
+uint32_t SimSamplesDue(we_sim_device_t *sim, uint32_t periodUs)
+{
+  uint32_t due = 0;
+
+  if (periodUs != sim->periodUs)
+  {
+    sim->periodUs = periodUs;
+    sim->nextSampleUs = sim->nowUs + periodUs;
+    return 0;
+  }
+
+  if (periodUs == 0)
+  {
+    return 0;
+  }
+
+  while (sim->nextSampleUs <= sim->nowUs)
+  {
+    sim->nextSampleUs += periodUs;
+    if (due < WE_SIM_MAX_SAMPLES_DUE)
+    {
+      due++;
+    }
+  }
+
+  return due;
+}
+
+/**
+* @brief  Store one entry in the FIFO
+* @param  -sim : simulated device
+*         -record : entry to store
+*         -recordLen : size of the entry in bytes
+*         -depth : current FIFO depth
+*         -overwrite : true: a full FIFO drops its oldest entry (continuous mode); false: a full FIFO stops (FIFO mode)
+* @retval true if the entry has been stored
+*/
+bool SimFifoPush(we_sim_device_t *sim, const uint8_t *record, int recordLen, int depth, bool overwrite)
+{
+  uint16_t tail;
+
+  if (depth > WE_SIM_FIFO_DEPTH)
+  {
+    depth = WE_SIM_FIFO_DEPTH;
+  }
+
+  if (sim->fifoLevel >= depth)
+  {
+    if (!overwrite)
+    {
+      return false;
+    }
+    sim->fifoHead = (sim->fifoHead + 1) % WE_SIM_FIFO_DEPTH;
+    sim->fifoLevel--;
+    sim->fifoOverrun = true;
+  }
+
+  tail = (sim->fifoHead + sim->fifoLevel) % WE_SIM_FIFO_DEPTH;
+  memcpy(sim->fifo[tail], record, recordLen);
+  sim->fifoLevel++;
+
+  return true;
+}
+
+/**
+* @brief  Read one byte of the oldest FIFO entry. Reading the last byte of the entry removes it.
+* @param  -sim : simulated device
+*         -index : byte of the entry to read
+*         -recordLen : size of an entry in bytes
+* @retval byte read, 0 if the FIFO is empty
+*/
+uint8_t SimFifoReadByte(we_sim_device_t *sim, int index, int recordLen)
+{
+  uint8_t value;
+
+  if (sim->fifoLevel == 0)
+  {
+    return 0;
+  }
+
+  value = sim->fifo[sim->fifoHead][index];
+  if (index == recordLen - 1)
+  {
+    sim->fifoHead = (sim->fifoHead + 1) % WE_SIM_FIFO_DEPTH;
+    sim->fifoLevel--;
+    sim->fifoOverrun = false;
+  }
+
+  return value;
+}
+
+/**
+* @brief  Empty the FIFO
+* @param  -sim : simulated device
+* @retval None
+*/
+void SimFifoClear(we_sim_device_t *sim)
+{
+  sim->fifoHead = 0;
+  sim->fifoLevel = 0;
+  sim->fifoOverrun = false;
+}
+
+/**
+* @brief  Deterministic triangle waveform used as simulated signal
+* @param  -n : sample number
+*         -amplitude : peak value
+*         -period : period in samples
+* @retval waveform value in [-amplitude, amplitude]
+*/
+int32_t SimWave(uint32_t n, int32_t amplitude, uint32_t period)
+{
+  int32_t phase;
+
+  if (period < 4)
+  {
+    return 0;
+  }
+
+  phase = (int32_t)(n % period);
+  if (phase < (int32_t)(period / 2))
+  {
+    return -amplitude + (4 * amplitude * phase) / (int32_t)period;
+  }
+  return 3 * amplitude - (4 * amplitude * phase) / (int32_t)period;
+}
+
+/**         EOF         */
@@ -0,0 +1,124 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef _WE_PLATFORM_SIM_H
+#define _WE_PLATFORM_SIM_H
+
+/*
+ * #### INFORMATIVE ####
+ * In-memory register file simulator backend (WE_simBusOps).
+ * Every simulated device owns a register file and a sensor model that produces samples at the configured
+ * output data rate, fills the FIFO and sets the data-ready/status bits. Time is simulated: each transfer
+ * advances the bus clock by its duration at the configured bus clock and BusDelay() advances it by the
+ * requested time, so driver throughput can be profiled without hardware and without sleeping.
+ */
+
+/**         Includes         */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "platform.h"
+
+#define WE_SIM_REG_COUNT          256   /* size of the simulated register file */
+#define WE_SIM_FIFO_DEPTH         128   /* maximum FIFO depth of the simulated sensors */
+#define WE_SIM_FIFO_RECORD_LEN    6     /* maximum size of one FIFO entry in bytes */
+#define WE_SIM_MAX_SAMPLES_DUE    1024  /* maximum number of samples produced by one model update */
+
+
+/**         Type definitions         */
+
+typedef struct we_sim_device_s we_sim_device_t;
+
+/**
+* Sensor model
+* reset and update are mandatory, the other hooks are optional (NULL: plain register file access, address + 1).
+* A model with a multiByteBit repeats the addressed register in multi-byte accesses without that bit, like the device.
+*/
+typedef struct {
+	void (*reset)(we_sim_device_t *sim);                                /* load the power-on register values */
+	void (*update)(we_sim_device_t *sim);                               /* advance the model to sim->nowUs: produce samples, fill FIFO, set status bits */
+	uint8_t (*read)(we_sim_device_t *sim, uint8_t RegAdr);              /* read one register byte including side effects (FIFO pop, clear on read) */
+	void (*write)(we_sim_device_t *sim, uint8_t RegAdr, uint8_t value); /* write one register byte including side effects (one-shot trigger, reset) */
+	uint8_t (*nextAddress)(we_sim_device_t *sim, uint8_t RegAdr);       /* address of the next byte of a multi-byte access (auto increment, FIFO rollover) */
+	uint8_t multiByteBit[2];                                            /* register address bit enabling auto increment, per we_bus_type_t; 0: always auto increments */
+} we_sim_model_t;
+
+/**
+* Simulated bus: clock and traffic counters
+*/
+typedef struct {
+	uint64_t nowUs;               /* simulated time in us */
+	uint32_t clockHz;             /* bus clock used to compute the duration of a transfer */
+	uint32_t transactions;        /* number of transfers */
+	uint32_t bytes;               /* number of bytes moved, address bytes included */
+} we_sim_bus_t;
+
+/**
+* Simulated device: register file and model state
+*/
+struct we_sim_device_s {
+	const we_sim_model_t *model;
+	uint64_t nowUs;                                          /* current simulated time, set before every model hook */
+	uint8_t regs[WE_SIM_REG_COUNT];                          /* register file */
+	uint32_t periodUs;                                       /* current output data period, 0: no continuous conversion */
+	uint64_t nextSampleUs;                                   /* time of the next output data update */
+	uint32_t sampleCount;                                    /* number of samples produced so far, drives the waveform */
+	uint64_t conversionDoneUs;                               /* end of a pending single conversion, 0: none */
+	uint8_t fifo[WE_SIM_FIFO_DEPTH][WE_SIM_FIFO_RECORD_LEN]; /* FIFO entries, oldest at fifoHead */
+	uint16_t fifoHead;
+	uint16_t fifoLevel;
+	bool fifoOverrun;                                        /* an entry has been overwritten since the last FIFO read */
+};
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+	/**         Functions definition         */
+
+	/* Initializes a simulated bus with the given bus clock (e.g. 400000 for fast mode I2C). */
+	int8_t SimBusInit(we_bus_t *bus, we_sim_bus_t *simBus, we_bus_type_t type, uint32_t clockHz);
+
+	/* Attaches a simulated sensor to a simulated bus and loads its power-on register values. */
+	int8_t SimDeviceInit(we_dev_t *dev, we_bus_t *bus, int address, we_sim_device_t *sim, const we_sim_model_t *model);
+
+	/* Advances the simulated time of the bus without a bus transfer. */
+	void SimAdvance(we_bus_t *bus, uint64_t us);
+
+	/* helpers for sensor models */
+	uint32_t SimSamplesDue(we_sim_device_t *sim, uint32_t periodUs);
+	bool SimFifoPush(we_sim_device_t *sim, const uint8_t *record, int recordLen, int depth, bool overwrite);
+	uint8_t SimFifoReadByte(we_sim_device_t *sim, int index, int recordLen);
+	void SimFifoClear(we_sim_device_t *sim);
+	int32_t SimWave(uint32_t n, int32_t amplitude, uint32_t period);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WE_PLATFORM_SIM_H */
+/**         EOF         */
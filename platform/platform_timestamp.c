@@ -0,0 +1,128 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform_timestamp.h"
+#include <time.h>
+
+
+/**
+* @brief  Current CLOCK_MONOTONIC time
+* @retval time in ns
+*/
+uint64_t SampleClockNowNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+* @brief  Initialize a sample clock
+* @param  -clock : sample clock
+*         -periodNs : nominal output data period in ns
+* @retval None
+*/
+void SampleClockInit(we_sample_clock_t *clock, uint64_t periodNs)
+{
+  clock->nominalPeriodNs = periodNs;
+  clock->periodNs = periodNs;
+  clock->lastNs = 0;
+  clock->windowStartNs = 0;
+  clock->windowSamples = 0;
+}
+
+/**
+* @brief  Timestamps of the samples of a FIFO drain
+*         The samples continue the timestamps of the previous drain with the current period. The newest sample cannot
+*         be younger than the drain: if it would be, the timestamps are moved back to the drain, otherwise they are
+*         pulled towards it by 1/WE_SAMPLE_CLOCK_GAIN of the gap, so they settle on the drains with the lowest latency.
+*         The period is then measured as the time since the start of the window over the samples drained since,
+*         measurements beyond the tolerance (e.g. samples left in the FIFO) are not used.
+* @param  -clock : sample clock
+*         -drainNs : CLOCK_MONOTONIC time of the drain, e.g. SampleClockNowNs() right after the FIFO read
+*         -count : number of samples drained
+*         -overrun : samples have been lost since the last drain
+*         -firstNs : timestamp of the oldest sample of the drain
+*         -periodNs : time between two samples of the drain
+* @retval None
+*/
+void SampleClockDrain(we_sample_clock_t *clock, uint64_t drainNs, int count, bool overrun, uint64_t *firstNs, uint64_t *periodNs)
+{
+  uint64_t measuredNs;
+  uint64_t lastNs;
+
+  *periodNs = clock->periodNs;
+
+  if (count <= 0)
+  {
+    *firstNs = drainNs;
+    return;
+  }
+
+  if (overrun || (clock->lastNs == 0))
+  {
+    /* (re)start: the newest sample is dated at the drain */
+    *firstNs = drainNs - (uint64_t)(count - 1) * clock->periodNs;
+    clock->lastNs = drainNs;
+    clock->windowStartNs = drainNs;
+    clock->windowSamples = 0;
+    return;
+  }
+
+  *firstNs = clock->lastNs + clock->periodNs;
+  lastNs = *firstNs + (uint64_t)(count - 1) * clock->periodNs;
+  if (lastNs > drainNs)
+  {
+    *firstNs -= lastNs - drainNs;
+    lastNs = drainNs;
+  }
+  else
+  {
+    *firstNs += (drainNs - lastNs) / WE_SAMPLE_CLOCK_GAIN;
+    lastNs += (drainNs - lastNs) / WE_SAMPLE_CLOCK_GAIN;
+  }
+  clock->lastNs = lastNs;
+
+  clock->windowSamples += (uint32_t)count;
+  if (drainNs > clock->windowStartNs)
+  {
+    measuredNs = (drainNs - clock->windowStartNs) / clock->windowSamples;
+    if ((measuredNs > clock->nominalPeriodNs - clock->nominalPeriodNs / WE_SAMPLE_CLOCK_TOLERANCE) &&
+        (measuredNs < clock->nominalPeriodNs + clock->nominalPeriodNs / WE_SAMPLE_CLOCK_TOLERANCE))
+    {
+      clock->periodNs = measuredNs;
+    }
+  }
+
+  /* slide the window: drop the older half */
+  if (clock->windowSamples > WE_SAMPLE_CLOCK_WINDOW)
+  {
+    clock->windowStartNs += (uint64_t)(clock->windowSamples / 2) * clock->periodNs;
+    clock->windowSamples -= clock->windowSamples / 2;
+  }
+}
+
+/**         EOF         */
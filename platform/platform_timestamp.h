@@ -0,0 +1,88 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef _WE_PLATFORM_TIMESTAMP_H
+#define _WE_PLATFORM_TIMESTAMP_H
+
+/*
+ * #### INFORMATIVE ####
+ * Sample timestamps on CLOCK_MONOTONIC, the time base of the interrupt line timestamps and the async deadlines.
+ * A sample clock assigns timestamps to the samples of a FIFO drain from a single clock reading per drain:
+ * the samples continue the timestamps of the previous drain and are corrected towards the drain time, the newest
+ * sample is never dated after the drain.
+ * The period is not taken from the nominal output data rate alone: the sensor's oscillator is off by up to a
+ * few percent, so the period is measured as the time between drains over the number of samples drained,
+ * averaged over the last WE_SAMPLE_CLOCK_WINDOW samples.
+ */
+
+/**         Includes         */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define WE_SAMPLE_CLOCK_WINDOW      1024  /* number of samples the period is measured over */
+#define WE_SAMPLE_CLOCK_TOLERANCE   8     /* measured period accepted within nominal period +/- 1/8 */
+#define WE_SAMPLE_CLOCK_GAIN        16    /* timestamps pulled towards a late drain by 1/16 of the gap */
+
+
+/**         Type definitions         */
+
+/**
+* Sample clock of one sensor FIFO, see SampleClockDrain()
+*/
+typedef struct {
+	uint64_t nominalPeriodNs;     /* from the configured output data rate */
+	uint64_t periodNs;            /* measured (drift corrected) period */
+	uint64_t lastNs;              /* timestamp of the newest sample of the last drain, 0: no drain yet */
+	uint64_t windowStartNs;       /* drain the period is measured from */
+	uint32_t windowSamples;       /* samples drained since windowStartNs */
+} we_sample_clock_t;
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+	/**         Functions definition         */
+
+	/* CLOCK_MONOTONIC time in ns */
+	uint64_t SampleClockNowNs(void);
+
+	/* Initializes a sample clock for the output data period in ns, call again after the output data rate is changed */
+	void SampleClockInit(we_sample_clock_t *clock, uint64_t periodNs);
+
+	/* 
+	 * Dates the count samples of a drain taken at drainNs (oldest first): sample i has firstNs + i * periodNs.
+	 * overrun: samples have been lost since the last drain, the timestamps restart from the drain time.
+	 */
+	void SampleClockDrain(we_sample_clock_t *clock, uint64_t drainNs, int count, bool overrun, uint64_t *firstNs, uint64_t *periodNs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WE_PLATFORM_TIMESTAMP_H */
+/**         EOF         */
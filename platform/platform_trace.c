@@ -0,0 +1,514 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform_trace.h"
+
+#ifdef WE_TRACE
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TRACE_SUB_COUNT         (1 << WE_TRACE_SUB_BITS)
+
+__thread const char *WE_traceCaller = NULL;
+static __thread int traceDepth = 0;  /* transfers in progress on this thread */
+
+static we_dev_t *traceDevices[WE_TRACE_MAX_DEVICES];
+static int traceDeviceCount = 0;
+
+static we_trace_func_t traceFunctions[WE_TRACE_MAX_FUNCTIONS];
+static pthread_mutex_t traceLock = PTHREAD_MUTEX_INITIALIZER;  /* devices list and function table, shared by all buses */
+
+
+/**
+* @brief  Current CLOCK_MONOTONIC time
+* @retval time in ns
+*/
+uint64_t TraceNowNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+* @brief  Histogram bucket of a latency
+* @param  -ns : latency
+* @retval bucket index
+*/
+static int traceBucket(uint64_t ns)
+{
+  int msb;
+  int shift;
+  int idx;
+
+  if (ns < TRACE_SUB_COUNT)
+  {
+    return (int)ns;
+  }
+
+  msb = 63 - __builtin_clzll(ns);
+  shift = msb - WE_TRACE_SUB_BITS;
+  idx = ((shift + 1) << WE_TRACE_SUB_BITS) + (int)((ns >> shift) & (TRACE_SUB_COUNT - 1));
+
+  return (idx < WE_TRACE_BUCKETS) ? idx : (WE_TRACE_BUCKETS - 1);
+}
+
+/**
+* @brief  Smallest latency of a histogram bucket
+* @param  -idx : bucket index
+* @retval latency in ns
+*/
+static uint64_t traceBucketStart(int idx)
+{
+  int shift;
+
+  if (idx < TRACE_SUB_COUNT)
+  {
+    return (uint64_t)idx;
+  }
+
+  shift = (idx >> WE_TRACE_SUB_BITS) - 1;
+  return (uint64_t)(TRACE_SUB_COUNT + (idx & (TRACE_SUB_COUNT - 1))) << shift;
+}
+
+/**
+* @brief  Add a latency to a histogram
+* @param  -hist : histogram
+*         -ns : latency
+* @retval None
+*/
+static void traceHistAdd(we_trace_hist_t *hist, uint64_t ns)
+{
+  hist->count++;
+  hist->sumNs += ns;
+  if (ns > hist->maxNs)
+  {
+    hist->maxNs = ns;
+  }
+  hist->bucket[traceBucket(ns)]++;
+}
+
+/**
+* @brief  Latency percentile of a histogram
+* @param  -hist : histogram
+*         -p : fraction of the recorded latencies, 0.0 .. 1.0
+* @retval upper bound of the bucket holding the percentile in ns, 0 if the histogram is empty
+*/
+uint64_t TracePercentile(const we_trace_hist_t *hist, double p)
+{
+  uint64_t rank;
+  uint64_t seen = 0;
+  uint64_t upper;
+  int i;
+
+  if (hist->count == 0)
+  {
+    return 0;
+  }
+
+  rank = (uint64_t)(p * (double)hist->count + 0.5);
+  if (rank < 1)
+  {
+    rank = 1;
+  }
+
+  for (i = 0; i < WE_TRACE_BUCKETS; i++)
+  {
+    seen += hist->bucket[i];
+    if (seen >= rank)
+    {
+      break;
+    }
+  }
+
+  upper = (i < WE_TRACE_BUCKETS - 1) ? (traceBucketStart(i + 1) - 1) : hist->maxNs;
+  return (upper < hist->maxNs) ? upper : hist->maxNs;
+}
+
+/**
+* @brief  Attach statistics storage to a device
+* @param  -dev : initialized device
+*         -stats : storage, owned by the caller for the lifetime of the device
+*         -name : name used in the text dump
+* @retval Error Code
+*/
+int8_t TraceDeviceInit(we_dev_t *dev, we_trace_dev_t *stats, const char *name)
+{
+  int i;
+
+  if ((dev == NULL) || (stats == NULL))
+  {
+    return WE_FAIL;
+  }
+
+  memset(stats, 0, sizeof(we_trace_dev_t));
+  stats->name = (name != NULL) ? name : "device";
+
+  pthread_mutex_lock(&traceLock);
+  for (i = 0; i < traceDeviceCount; i++)
+  {
+    if (traceDevices[i] == dev)
+    {
+      break;
+    }
+  }
+  if (i == traceDeviceCount)
+  {
+    if (traceDeviceCount == WE_TRACE_MAX_DEVICES)
+    {
+      pthread_mutex_unlock(&traceLock);
+      return WE_FAIL;
+    }
+    traceDevices[traceDeviceCount++] = dev;
+  }
+  pthread_mutex_unlock(&traceLock);
+
+  BusLock(dev->bus);
+  dev->trace = stats;
+  BusUnlock(dev->bus);
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Copy the statistics of a device
+* @param  -dev : device with attached statistics
+*         -snapshot : destination
+* @retval Error Code
+*/
+int8_t TraceGetDevice(we_dev_t *dev, we_trace_dev_t *snapshot)
+{
+  int8_t ret = WE_FAIL;
+
+  BusLock(dev->bus);
+  if (dev->trace != NULL)
+  {
+    memcpy(snapshot, dev->trace, sizeof(we_trace_dev_t));
+    ret = WE_SUCCESS;
+  }
+  BusUnlock(dev->bus);
+
+  return ret;
+}
+
+/**
+* @brief  Copy the per-function statistics
+* @param  -snapshot : destination array
+*         -max : number of entries of the destination
+* @retval number of entries copied
+*/
+int TraceGetFunctions(we_trace_func_t *snapshot, int max)
+{
+  int count = 0;
+  int i;
+
+  pthread_mutex_lock(&traceLock);
+  for (i = 0; (i < WE_TRACE_MAX_FUNCTIONS) && (count < max); i++)
+  {
+    if (traceFunctions[i].name != NULL)
+    {
+      snapshot[count++] = traceFunctions[i];
+    }
+  }
+  pthread_mutex_unlock(&traceLock);
+
+  return count;
+}
+
+/**
+* @brief  Start of a transfer
+* @retval start time in ns
+*/
+uint64_t TraceStart(void)
+{
+  traceDepth++;
+  return TraceNowNs();
+}
+
+/**
+* @brief  Account a transfer to the calling driver function
+* @param  -dir : read or write
+*         -NumBytes : data bytes transferred
+*         -ns : latency
+*         -ok : transfer succeeded
+* @retval None
+*/
+static void traceFunctionAdd(we_trace_dir_t dir, uint64_t NumBytes, uint64_t ns, bool ok)
+{
+  const char *caller = (WE_traceCaller != NULL) ? WE_traceCaller : "(unknown)";
+  we_trace_func_t *func = NULL;
+  unsigned int slot;
+  int i;
+
+  /* function names are the __func__ string of the caller, the pointer identifies the function */
+  slot = (unsigned int)(((uintptr_t)caller >> 3) % WE_TRACE_MAX_FUNCTIONS);
+
+  pthread_mutex_lock(&traceLock);
+  for (i = 0; i < WE_TRACE_MAX_FUNCTIONS; i++)
+  {
+    we_trace_func_t *entry = &traceFunctions[(slot + i) % WE_TRACE_MAX_FUNCTIONS];
+
+    if ((entry->name == caller) || (entry->name == NULL))
+    {
+      entry->name = caller;
+      func = entry;
+      break;
+    }
+  }
+  if (func != NULL)
+  {
+    if (dir == WE_traceRead)
+    {
+      func->reads++;
+      func->bytesRead += NumBytes;
+    }
+    else
+    {
+      func->writes++;
+      func->bytesWritten += NumBytes;
+    }
+    if (!ok)
+    {
+      func->errors++;
+    }
+    traceHistAdd(&func->latency, ns);
+  }
+  pthread_mutex_unlock(&traceLock);
+}
+
+/**
+* @brief  Account a transfer to the device totals
+* @retval None
+*/
+static void traceDeviceAdd(we_trace_dev_t *stats, we_trace_dir_t dir, uint64_t NumBytes, uint64_t ns, bool ok)
+{
+  if (dir == WE_traceRead)
+  {
+    stats->reads++;
+    stats->bytesRead += NumBytes;
+    traceHistAdd(&stats->readLatency, ns);
+  }
+  else
+  {
+    stats->writes++;
+    stats->bytesWritten += NumBytes;
+    traceHistAdd(&stats->writeLatency, ns);
+  }
+  if (!ok)
+  {
+    stats->errors++;
+  }
+}
+
+/**
+* @brief  Record one transfer
+* @param  -dev : device accessed, its bus is locked by the caller
+*         -dir : read or write
+*         -RegAdr : start register
+*         -NumBytes : data bytes transferred
+*         -startNs : TraceStart() before the transfer
+*         -ok : transfer succeeded
+* @retval None
+*/
+void TraceRecord(we_dev_t *dev, we_trace_dir_t dir, uint8_t RegAdr, int NumBytes, uint64_t startNs, bool ok)
+{
+  uint64_t ns = TraceNowNs() - startNs;
+
+  if (--traceDepth > 0)
+  {
+    return;
+  }
+
+  if (dev->trace != NULL)
+  {
+    if (dir == WE_traceRead)
+    {
+      dev->trace->regReads[RegAdr]++;
+    }
+    else
+    {
+      dev->trace->regWrites[RegAdr]++;
+    }
+    traceDeviceAdd(dev->trace, dir, (uint64_t)NumBytes, ns, ok);
+  }
+
+  traceFunctionAdd(dir, (uint64_t)NumBytes, ns, ok);
+}
+
+/**
+* @brief  Record a batched read: one transaction, each block counts for its start register
+* @param  -dev : device accessed, its bus is locked by the caller
+*         -reads : blocks of the batch
+*         -count : number of blocks
+*         -startNs : TraceStart() before the transfer
+*         -ok : transfer succeeded
+* @retval None
+*/
+void TraceRecordBatch(we_dev_t *dev, const we_reg_read_t *reads, int count, uint64_t startNs, bool ok)
+{
+  uint64_t ns = TraceNowNs() - startNs;
+  uint64_t bytes = 0;
+  int i;
+
+  if (--traceDepth > 0)
+  {
+    return;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    bytes += (uint64_t)reads[i].NumByteToRead;
+    if (dev->trace != NULL)
+    {
+      dev->trace->regReads[reads[i].RegAdr]++;
+    }
+  }
+
+  if (dev->trace != NULL)
+  {
+    traceDeviceAdd(dev->trace, WE_traceRead, bytes, ns, ok);
+  }
+
+  traceFunctionAdd(WE_traceRead, bytes, ns, ok);
+}
+
+/**
+* @brief  Print one histogram as mean/p50/p99/max in us
+* @retval None
+*/
+static void traceDumpHist(FILE *out, const we_trace_hist_t *hist)
+{
+  fprintf(out, " %9.1f %9.1f %9.1f %9.1f",
+          (hist->count > 0) ? ((double)hist->sumNs / hist->count / 1000.0) : 0.0,
+          TracePercentile(hist, 0.50) / 1000.0,
+          TracePercentile(hist, 0.99) / 1000.0,
+          hist->maxNs / 1000.0);
+}
+
+/**
+* @brief  Order functions by total transfer time, largest first
+*/
+static int traceCompareFunctions(const void *a, const void *b)
+{
+  uint64_t ta = ((const we_trace_func_t *)a)->latency.sumNs;
+  uint64_t tb = ((const we_trace_func_t *)b)->latency.sumNs;
+
+  return (ta < tb) ? 1 : ((ta > tb) ? -1 : 0);
+}
+
+/**
+* @brief  Print all statistics as text tables, latencies in us
+* @param  -out : output stream
+* @retval None
+*/
+void TraceDump(FILE *out)
+{
+  static we_trace_func_t funcs[WE_TRACE_MAX_FUNCTIONS];
+  static we_trace_dev_t stats;
+  we_dev_t *devices[WE_TRACE_MAX_DEVICES];
+  int deviceCount;
+  int count;
+  int i;
+  int adr;
+
+  pthread_mutex_lock(&traceLock);
+  deviceCount = traceDeviceCount;
+  memcpy(devices, traceDevices, sizeof(devices));
+  pthread_mutex_unlock(&traceLock);
+
+  fprintf(out, "%-16s %-5s %9s %11s %6s %9s %9s %9s %9s\n", "device", "dir", "transfers", "bytes", "errors", "mean", "p50", "p99", "max");
+  for (i = 0; i < deviceCount; i++)
+  {
+    if (WE_FAIL == TraceGetDevice(devices[i], &stats))
+    {
+      continue;
+    }
+
+    fprintf(out, "%-16s %-5s %9u %11llu %6u", stats.name, "read", stats.reads, (unsigned long long)stats.bytesRead, stats.errors);
+    traceDumpHist(out, &stats.readLatency);
+    fprintf(out, "\n%-16s %-5s %9u %11llu %6s", "", "write", stats.writes, (unsigned long long)stats.bytesWritten, "");
+    traceDumpHist(out, &stats.writeLatency);
+    fprintf(out, "\n");
+
+    for (adr = 0; adr < WE_REG_CACHE_SIZE; adr++)
+    {
+      if ((stats.regReads[adr] != 0) || (stats.regWrites[adr] != 0))
+      {
+        fprintf(out, "%-16s   reg 0x%02X  read %9u  write %9u\n", "", adr, stats.regReads[adr], stats.regWrites[adr]);
+      }
+    }
+  }
+
+  count = TraceGetFunctions(funcs, WE_TRACE_MAX_FUNCTIONS);
+  qsort(funcs, (size_t)count, sizeof(we_trace_func_t), traceCompareFunctions);
+
+  fprintf(out, "\n%-32s %9s %9s %11s %6s %9s %9s %9s %9s %11s\n", "function", "reads", "writes", "bytes", "errors", "mean", "p50", "p99", "max", "total");
+  for (i = 0; i < count; i++)
+  {
+    fprintf(out, "%-32s %9u %9u %11llu %6u", funcs[i].name, funcs[i].reads, funcs[i].writes,
+            (unsigned long long)(funcs[i].bytesRead + funcs[i].bytesWritten), funcs[i].errors);
+    traceDumpHist(out, &funcs[i].latency);
+    fprintf(out, " %11.1f\n", funcs[i].latency.sumNs / 1000.0);
+  }
+}
+
+/**
+* @brief  Clear all statistics
+* @retval None
+*/
+void TraceReset(void)
+{
+  we_dev_t *devices[WE_TRACE_MAX_DEVICES];
+  int deviceCount;
+  int i;
+
+  pthread_mutex_lock(&traceLock);
+  memset(traceFunctions, 0, sizeof(traceFunctions));
+  deviceCount = traceDeviceCount;
+  memcpy(devices, traceDevices, sizeof(devices));
+  pthread_mutex_unlock(&traceLock);
+
+  for (i = 0; i < deviceCount; i++)
+  {
+    BusLock(devices[i]->bus);
+    if (devices[i]->trace != NULL)
+    {
+      const char *name = devices[i]->trace->name;
+
+      memset(devices[i]->trace, 0, sizeof(we_trace_dev_t));
+      devices[i]->trace->name = name;
+    }
+    BusUnlock(devices[i]->bus);
+  }
+}
+
+#endif /* WE_TRACE */
+
+/**         EOF         */
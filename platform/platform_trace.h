@@ -0,0 +1,149 @@
+/**
+ ***************************************************************************************************
+ * This file is part of Sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#ifndef _WE_PLATFORM_TRACE_H
+#define _WE_PLATFORM_TRACE_H
+
+/*
+ * #### INFORMATIVE ####
+ * Bus transfer statistics, enabled by defining WE_TRACE (platform.h or compiler flag, for all files).
+ * Every transfer that reaches the bus backend (register cache hits do not) is recorded with its start register,
+ * byte count and latency, per device (TraceDeviceInit()) and per calling driver function (automatic).
+ * Latencies go into log-linear histograms (8 buckets per power of two, <= 12.5% error) from which
+ * TracePercentile() derives p50/p99. Results are available as struct snapshots or as a text dump.
+ * Without WE_TRACE the recording compiles to nothing and the functions below reduce to no-op macros.
+ */
+
+/**         Includes         */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "platform.h"
+
+
+/**         Type definitions         */
+
+#define WE_TRACE_SUB_BITS        3                                    /* 2^3 buckets per power of two */
+#define WE_TRACE_BUCKETS         ((40 - WE_TRACE_SUB_BITS + 2) << WE_TRACE_SUB_BITS)  /* up to 2^41 ns */
+#define WE_TRACE_MAX_DEVICES     32
+#define WE_TRACE_MAX_FUNCTIONS   128
+
+typedef enum {
+	WE_traceRead,
+	WE_traceWrite
+} we_trace_dir_t;
+
+/**
+* Latency histogram
+*/
+typedef struct {
+	uint32_t count;
+	uint64_t sumNs;
+	uint64_t maxNs;
+	uint32_t bucket[WE_TRACE_BUCKETS];
+} we_trace_hist_t;
+
+/**
+* Statistics of one device, storage owned by the caller, see TraceDeviceInit()
+*/
+typedef struct we_trace_dev_s {
+	const char *name;
+	uint32_t regReads[WE_REG_CACHE_SIZE];   /* read transfers starting at each register */
+	uint32_t regWrites[WE_REG_CACHE_SIZE];  /* write transfers starting at each register */
+	uint32_t reads;
+	uint32_t writes;
+	uint32_t errors;
+	uint64_t bytesRead;
+	uint64_t bytesWritten;
+	we_trace_hist_t readLatency;
+	we_trace_hist_t writeLatency;
+} we_trace_dev_t;
+
+/**
+* Statistics of the transfers issued by one driver function
+*/
+typedef struct {
+	const char *name;                       /* function name, NULL: unused entry */
+	uint32_t reads;
+	uint32_t writes;
+	uint32_t errors;
+	uint64_t bytesRead;
+	uint64_t bytesWritten;
+	we_trace_hist_t latency;
+} we_trace_func_t;
+
+
+/**         Functions definition         */
+
+#ifdef WE_TRACE
+
+/* Attaches statistics storage to a device (any time after DeviceInit()) and adds it to the text dump */
+int8_t TraceDeviceInit(we_dev_t *dev, we_trace_dev_t *stats, const char *name);
+
+/* Copies the statistics of a device, consistent with respect to transfers on its bus */
+int8_t TraceGetDevice(we_dev_t *dev, we_trace_dev_t *snapshot);
+
+/* Copies up to max per-function entries, returns the number copied */
+int TraceGetFunctions(we_trace_func_t *snapshot, int max);
+
+/* Latency below which the fraction p (0.0 .. 1.0, e.g. 0.99) of the recorded transfers lie, in ns */
+uint64_t TracePercentile(const we_trace_hist_t *hist, double p);
+
+/* Prints the per-device and per-function tables (count, bytes, mean/p50/p99/max latency) */
+void TraceDump(FILE *out);
+
+/* Clears all statistics, the device registrations are kept */
+void TraceReset(void);
+
+/* 
+ * Recording, used by the platform with the bus locked. TraceStart() returns the start time; transfers started
+ * while another one of the same thread is in progress (backend batch fallbacks) are covered by the outer one.
+ */
+uint64_t TraceStart(void);
+void TraceRecord(we_dev_t *dev, we_trace_dir_t dir, uint8_t RegAdr, int NumBytes, uint64_t startNs, bool ok);
+void TraceRecordBatch(we_dev_t *dev, const we_reg_read_t *reads, int count, uint64_t startNs, bool ok);
+
+/* CLOCK_MONOTONIC time in ns */
+uint64_t TraceNowNs(void);
+
+#define WE_TRACE_START(t0)                                    uint64_t t0 = TraceStart()
+#define WE_TRACE_RECORD(dev, dir, RegAdr, NumBytes, t0, ok)   TraceRecord(dev, dir, RegAdr, NumBytes, t0, ok)
+#define WE_TRACE_RECORD_BATCH(dev, reads, count, t0, ok)      TraceRecordBatch(dev, reads, count, t0, ok)
+
+#else
+
+#define TraceDeviceInit(dev, stats, name)                     (WE_SUCCESS)
+#define TraceDump(out)                                        ((void)0)
+#define TraceReset()                                          ((void)0)
+
+#define WE_TRACE_START(t0)
+#define WE_TRACE_RECORD(dev, dir, RegAdr, NumBytes, t0, ok)
+#define WE_TRACE_RECORD_BATCH(dev, reads, count, t0, ok)
+
+#endif /* WE_TRACE */
+
+#endif /* _WE_PLATFORM_TRACE_H */
+/**         EOF         */
@@ -0,0 +1,185 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WE sensors SDK:
+ * https://www.we-online.com/sensors, https://github.com/WurthElektronik/Sensors-SDK
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2020 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+#include "platform.h"
+#include <wiringPiI2C.h>
+#include <wiringPiSPI.h>
+#include <stdio.h>
+#include <string.h>
+
+
+#define DUMMY 0x00
+
+
+/**
+* @brief  Open the device with wiringPi
+* @param  -dev : device to open
+* @retval Error Code
+*/
+static int8_t wiringPiOpen(we_dev_t *dev)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    if ((dev->handle = wiringPiSPISetupMode(dev->address, dev->bus->speed, dev->bus->spiMode)) < 0)
+    {
+      fprintf(stdout, "wiringPiSPISetup Error\n");
+      return WE_FAIL;
+    }
+  }
+  else
+  {
+    char i2cDevice[20];
+
+    snprintf(i2cDevice, sizeof(i2cDevice), "/dev/i2c-%d", dev->bus->adapter);
+    if ((dev->handle = wiringPiI2CSetupInterface(i2cDevice, dev->address)) < 0)
+    {
+      fprintf(stdout, "wiringPiI2CSetup Error\n");
+      return WE_FAIL;
+    }
+  }
+
+  return WE_SUCCESS;
+}
+
+/**
+* @brief  Read registers: one wiringPi full duplex transfer on SPI, I2C_RDWR on the wiringPi i2c-dev handle on I2C
+* @param  -dev : device to read from
+*         -RegAdr : the register address to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+static int8_t wiringPiReadReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToRead, uint8_t *Data)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    /* send the address once and clock in all bytes in a single full duplex transfer */
+    uint8_t fulldata[WE_MAX_BURST_LEN + 1];
+
+    fulldata[0] = RegAdr | SPI_READ_MASK;
+    memset(&fulldata[1], DUMMY, NumByteToRead);
+
+    if (wiringPiSPIDataRW(dev->address, fulldata, NumByteToRead + 1) == -1)
+    {
+      return WE_FAIL;
+    }
+
+    /* read out the received response of the sensor */
+    memcpy(Data, &fulldata[1], NumByteToRead);
+    return WE_SUCCESS;
+  }
+
+  /* wiringPi has no combined write/read, use the i2c-dev transaction on its handle */
+  return LinuxI2CReadReg(dev, RegAdr, NumByteToRead, Data);
+}
+
+/**
+* @brief  Read several register blocks, batched into I2C_RDWR transactions on I2C
+* @param  -dev : device to read from
+*         -reads : list of register blocks (start address, length, destination)
+*         -count : number of entries in reads
+* @retval Error Code
+*/
+static int8_t wiringPiReadRegBatch(we_dev_t *dev, we_reg_read_t *reads, int count)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    int i;
+
+    /* SPI transfers are independent chip select cycles, execute them one after the other */
+    for (i = 0; i < count; i++)
+    {
+      uint8_t RegAdr = reads[i].RegAdr;
+
+      if (reads[i].NumByteToRead > 1)
+      {
+        RegAdr |= dev->multiByteMask;
+      }
+      if (WE_FAIL == wiringPiReadReg(dev, RegAdr, reads[i].NumByteToRead, reads[i].Data))
+      {
+        return WE_FAIL;
+      }
+    }
+    return WE_SUCCESS;
+  }
+
+  return LinuxI2CReadRegBatch(dev, reads, count);
+}
+
+/**
+* @brief  Write registers: one wiringPi transfer on SPI, one I2C message on I2C
+* @param  -dev : device to write to
+*         -RegAdr : Address to write in
+*         -NumByteToWrite : number of bytes to write
+*         -pointer Data : Address of the data to be written
+* @retval Error Code
+*/
+static int8_t wiringPiWriteReg(we_dev_t *dev, uint8_t RegAdr, int NumByteToWrite, uint8_t *Data)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    /* send the address once followed by all data bytes in a single transfer */
+    uint8_t fulldata[WE_MAX_BURST_LEN + 1];
+
+    fulldata[0] = RegAdr;
+    memcpy(&fulldata[1], Data, NumByteToWrite);
+
+    if (wiringPiSPIDataRW(dev->address, fulldata, NumByteToWrite + 1) == -1)
+    {
+      return WE_FAIL;
+    }
+    return WE_SUCCESS;
+  }
+
+  return LinuxI2CWriteReg(dev, RegAdr, NumByteToWrite, Data);
+}
+
+/**
+* @brief  Read without register address: single I2C read message on the wiringPi i2c-dev handle, I2C only
+* @param  -dev : device to read from
+*         -NumByteToRead : number of bytes to read
+*         -pointer Data : the address store the data
+* @retval Error Code
+*/
+static int8_t wiringPiRead(we_dev_t *dev, int NumByteToRead, uint8_t *Data)
+{
+  if (dev->bus->type == WE_spi)
+  {
+    return WE_FAIL;
+  }
+
+  return LinuxI2CRead(dev, NumByteToRead, Data);
+}
+
+const we_bus_ops_t WE_wiringPiBusOps = {
+  wiringPiOpen,
+  wiringPiReadReg,
+  wiringPiWriteReg,
+  wiringPiReadRegBatch,
+  NULL,
+  wiringPiRead
+};
+
+/**         EOF         */